@@ -0,0 +1,799 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "Release".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "HPXInternal::hpx_full" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_full APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_full PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx.so.1.9.0"
+  IMPORTED_SONAME_RELEASE "libhpx.so.1"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_full )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_full "${_IMPORT_PREFIX}/lib/libhpx.so.1.9.0" )
+
+# Import target "HPXInternal::hpx_core" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_core APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_core PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_core.so"
+  IMPORTED_SONAME_RELEASE "libhpx_core.so"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_core )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_core "${_IMPORT_PREFIX}/lib/libhpx_core.so" )
+
+# Import target "HPXInternal::hpx_affinity" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_affinity APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_affinity PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_affinity.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_affinity )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_affinity "${_IMPORT_PREFIX}/lib/libhpx_affinity.a" )
+
+# Import target "HPXInternal::hpx_algorithms" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_algorithms APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_algorithms PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_algorithms.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_algorithms )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_algorithms "${_IMPORT_PREFIX}/lib/libhpx_algorithms.a" )
+
+# Import target "HPXInternal::hpx_allocator_support" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_allocator_support APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_allocator_support PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_allocator_support.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_allocator_support )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_allocator_support "${_IMPORT_PREFIX}/lib/libhpx_allocator_support.a" )
+
+# Import target "HPXInternal::hpx_asio" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_asio APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_asio PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_asio.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_asio )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_asio "${_IMPORT_PREFIX}/lib/libhpx_asio.a" )
+
+# Import target "HPXInternal::hpx_assertion" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_assertion APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_assertion PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_assertion.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_assertion )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_assertion "${_IMPORT_PREFIX}/lib/libhpx_assertion.a" )
+
+# Import target "HPXInternal::hpx_async_base" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_async_base APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_async_base PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_async_base.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_async_base )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_async_base "${_IMPORT_PREFIX}/lib/libhpx_async_base.a" )
+
+# Import target "HPXInternal::hpx_async_combinators" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_async_combinators APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_async_combinators PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_async_combinators.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_async_combinators )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_async_combinators "${_IMPORT_PREFIX}/lib/libhpx_async_combinators.a" )
+
+# Import target "HPXInternal::hpx_async_local" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_async_local APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_async_local PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_async_local.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_async_local )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_async_local "${_IMPORT_PREFIX}/lib/libhpx_async_local.a" )
+
+# Import target "HPXInternal::hpx_batch_environments" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_batch_environments APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_batch_environments PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_batch_environments.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_batch_environments )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_batch_environments "${_IMPORT_PREFIX}/lib/libhpx_batch_environments.a" )
+
+# Import target "HPXInternal::hpx_cache" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_cache APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_cache PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_cache.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_cache )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_cache "${_IMPORT_PREFIX}/lib/libhpx_cache.a" )
+
+# Import target "HPXInternal::hpx_command_line_handling_local" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_command_line_handling_local APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_command_line_handling_local PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_command_line_handling_local.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_command_line_handling_local )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_command_line_handling_local "${_IMPORT_PREFIX}/lib/libhpx_command_line_handling_local.a" )
+
+# Import target "HPXInternal::hpx_compute_local" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_compute_local APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_compute_local PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_compute_local.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_compute_local )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_compute_local "${_IMPORT_PREFIX}/lib/libhpx_compute_local.a" )
+
+# Import target "HPXInternal::hpx_concepts" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_concepts APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_concepts PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_concepts.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_concepts )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_concepts "${_IMPORT_PREFIX}/lib/libhpx_concepts.a" )
+
+# Import target "HPXInternal::hpx_concurrency" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_concurrency APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_concurrency PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_concurrency.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_concurrency )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_concurrency "${_IMPORT_PREFIX}/lib/libhpx_concurrency.a" )
+
+# Import target "HPXInternal::hpx_config" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_config APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_config PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_config.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_config )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_config "${_IMPORT_PREFIX}/lib/libhpx_config.a" )
+
+# Import target "HPXInternal::hpx_config_registry" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_config_registry APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_config_registry PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_config_registry.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_config_registry )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_config_registry "${_IMPORT_PREFIX}/lib/libhpx_config_registry.a" )
+
+# Import target "HPXInternal::hpx_coroutines" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_coroutines APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_coroutines PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_coroutines.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_coroutines )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_coroutines "${_IMPORT_PREFIX}/lib/libhpx_coroutines.a" )
+
+# Import target "HPXInternal::hpx_datastructures" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_datastructures APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_datastructures PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_datastructures.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_datastructures )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_datastructures "${_IMPORT_PREFIX}/lib/libhpx_datastructures.a" )
+
+# Import target "HPXInternal::hpx_debugging" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_debugging APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_debugging PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_debugging.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_debugging )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_debugging "${_IMPORT_PREFIX}/lib/libhpx_debugging.a" )
+
+# Import target "HPXInternal::hpx_errors" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_errors APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_errors PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_errors.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_errors )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_errors "${_IMPORT_PREFIX}/lib/libhpx_errors.a" )
+
+# Import target "HPXInternal::hpx_execution" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_execution APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_execution PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_execution.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_execution )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_execution "${_IMPORT_PREFIX}/lib/libhpx_execution.a" )
+
+# Import target "HPXInternal::hpx_execution_base" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_execution_base APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_execution_base PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_execution_base.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_execution_base )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_execution_base "${_IMPORT_PREFIX}/lib/libhpx_execution_base.a" )
+
+# Import target "HPXInternal::hpx_executors" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_executors APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_executors PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_executors.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_executors )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_executors "${_IMPORT_PREFIX}/lib/libhpx_executors.a" )
+
+# Import target "HPXInternal::hpx_filesystem" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_filesystem APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_filesystem PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_filesystem.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_filesystem )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_filesystem "${_IMPORT_PREFIX}/lib/libhpx_filesystem.a" )
+
+# Import target "HPXInternal::hpx_format" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_format APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_format PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_format.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_format )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_format "${_IMPORT_PREFIX}/lib/libhpx_format.a" )
+
+# Import target "HPXInternal::hpx_functional" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_functional APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_functional PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_functional.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_functional )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_functional "${_IMPORT_PREFIX}/lib/libhpx_functional.a" )
+
+# Import target "HPXInternal::hpx_futures" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_futures APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_futures PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_futures.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_futures )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_futures "${_IMPORT_PREFIX}/lib/libhpx_futures.a" )
+
+# Import target "HPXInternal::hpx_hardware" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_hardware APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_hardware PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_hardware.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_hardware )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_hardware "${_IMPORT_PREFIX}/lib/libhpx_hardware.a" )
+
+# Import target "HPXInternal::hpx_hashing" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_hashing APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_hashing PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_hashing.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_hashing )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_hashing "${_IMPORT_PREFIX}/lib/libhpx_hashing.a" )
+
+# Import target "HPXInternal::hpx_include_local" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_include_local APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_include_local PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_include_local.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_include_local )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_include_local "${_IMPORT_PREFIX}/lib/libhpx_include_local.a" )
+
+# Import target "HPXInternal::hpx_ini" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_ini APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_ini PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_ini.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_ini )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_ini "${_IMPORT_PREFIX}/lib/libhpx_ini.a" )
+
+# Import target "HPXInternal::hpx_init_runtime_local" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_init_runtime_local APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_init_runtime_local PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_init_runtime_local.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_init_runtime_local )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_init_runtime_local "${_IMPORT_PREFIX}/lib/libhpx_init_runtime_local.a" )
+
+# Import target "HPXInternal::hpx_io_service" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_io_service APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_io_service PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_io_service.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_io_service )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_io_service "${_IMPORT_PREFIX}/lib/libhpx_io_service.a" )
+
+# Import target "HPXInternal::hpx_iterator_support" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_iterator_support APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_iterator_support PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_iterator_support.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_iterator_support )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_iterator_support "${_IMPORT_PREFIX}/lib/libhpx_iterator_support.a" )
+
+# Import target "HPXInternal::hpx_itt_notify" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_itt_notify APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_itt_notify PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_itt_notify.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_itt_notify )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_itt_notify "${_IMPORT_PREFIX}/lib/libhpx_itt_notify.a" )
+
+# Import target "HPXInternal::hpx_lcos_local" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_lcos_local APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_lcos_local PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_lcos_local.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_lcos_local )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_lcos_local "${_IMPORT_PREFIX}/lib/libhpx_lcos_local.a" )
+
+# Import target "HPXInternal::hpx_lock_registration" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_lock_registration APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_lock_registration PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_lock_registration.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_lock_registration )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_lock_registration "${_IMPORT_PREFIX}/lib/libhpx_lock_registration.a" )
+
+# Import target "HPXInternal::hpx_logging" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_logging APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_logging PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_logging.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_logging )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_logging "${_IMPORT_PREFIX}/lib/libhpx_logging.a" )
+
+# Import target "HPXInternal::hpx_memory" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_memory APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_memory PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_memory.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_memory )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_memory "${_IMPORT_PREFIX}/lib/libhpx_memory.a" )
+
+# Import target "HPXInternal::hpx_pack_traversal" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_pack_traversal APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_pack_traversal PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_pack_traversal.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_pack_traversal )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_pack_traversal "${_IMPORT_PREFIX}/lib/libhpx_pack_traversal.a" )
+
+# Import target "HPXInternal::hpx_plugin" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_plugin APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_plugin PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_plugin.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_plugin )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_plugin "${_IMPORT_PREFIX}/lib/libhpx_plugin.a" )
+
+# Import target "HPXInternal::hpx_prefix" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_prefix APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_prefix PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_prefix.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_prefix )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_prefix "${_IMPORT_PREFIX}/lib/libhpx_prefix.a" )
+
+# Import target "HPXInternal::hpx_preprocessor" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_preprocessor APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_preprocessor PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_preprocessor.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_preprocessor )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_preprocessor "${_IMPORT_PREFIX}/lib/libhpx_preprocessor.a" )
+
+# Import target "HPXInternal::hpx_program_options" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_program_options APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_program_options PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_program_options.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_program_options )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_program_options "${_IMPORT_PREFIX}/lib/libhpx_program_options.a" )
+
+# Import target "HPXInternal::hpx_properties" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_properties APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_properties PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_properties.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_properties )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_properties "${_IMPORT_PREFIX}/lib/libhpx_properties.a" )
+
+# Import target "HPXInternal::hpx_resiliency" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_resiliency APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_resiliency PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_resiliency.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_resiliency )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_resiliency "${_IMPORT_PREFIX}/lib/libhpx_resiliency.a" )
+
+# Import target "HPXInternal::hpx_resource_partitioner" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_resource_partitioner APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_resource_partitioner PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_resource_partitioner.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_resource_partitioner )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_resource_partitioner "${_IMPORT_PREFIX}/lib/libhpx_resource_partitioner.a" )
+
+# Import target "HPXInternal::hpx_runtime_configuration" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_runtime_configuration APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_runtime_configuration PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_runtime_configuration.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_runtime_configuration )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_runtime_configuration "${_IMPORT_PREFIX}/lib/libhpx_runtime_configuration.a" )
+
+# Import target "HPXInternal::hpx_runtime_local" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_runtime_local APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_runtime_local PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_runtime_local.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_runtime_local )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_runtime_local "${_IMPORT_PREFIX}/lib/libhpx_runtime_local.a" )
+
+# Import target "HPXInternal::hpx_schedulers" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_schedulers APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_schedulers PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_schedulers.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_schedulers )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_schedulers "${_IMPORT_PREFIX}/lib/libhpx_schedulers.a" )
+
+# Import target "HPXInternal::hpx_serialization" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_serialization APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_serialization PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_serialization.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_serialization )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_serialization "${_IMPORT_PREFIX}/lib/libhpx_serialization.a" )
+
+# Import target "HPXInternal::hpx_static_reinit" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_static_reinit APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_static_reinit PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_static_reinit.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_static_reinit )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_static_reinit "${_IMPORT_PREFIX}/lib/libhpx_static_reinit.a" )
+
+# Import target "HPXInternal::hpx_string_util" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_string_util APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_string_util PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_string_util.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_string_util )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_string_util "${_IMPORT_PREFIX}/lib/libhpx_string_util.a" )
+
+# Import target "HPXInternal::hpx_synchronization" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_synchronization APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_synchronization PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_synchronization.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_synchronization )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_synchronization "${_IMPORT_PREFIX}/lib/libhpx_synchronization.a" )
+
+# Import target "HPXInternal::hpx_tag_invoke" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_tag_invoke APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_tag_invoke PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_tag_invoke.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_tag_invoke )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_tag_invoke "${_IMPORT_PREFIX}/lib/libhpx_tag_invoke.a" )
+
+# Import target "HPXInternal::hpx_testing" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_testing APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_testing PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_testing.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_testing )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_testing "${_IMPORT_PREFIX}/lib/libhpx_testing.a" )
+
+# Import target "HPXInternal::hpx_thread_pool_util" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_thread_pool_util APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_thread_pool_util PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_thread_pool_util.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_thread_pool_util )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_thread_pool_util "${_IMPORT_PREFIX}/lib/libhpx_thread_pool_util.a" )
+
+# Import target "HPXInternal::hpx_thread_pools" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_thread_pools APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_thread_pools PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_thread_pools.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_thread_pools )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_thread_pools "${_IMPORT_PREFIX}/lib/libhpx_thread_pools.a" )
+
+# Import target "HPXInternal::hpx_thread_support" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_thread_support APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_thread_support PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_thread_support.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_thread_support )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_thread_support "${_IMPORT_PREFIX}/lib/libhpx_thread_support.a" )
+
+# Import target "HPXInternal::hpx_threading" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_threading APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_threading PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_threading.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_threading )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_threading "${_IMPORT_PREFIX}/lib/libhpx_threading.a" )
+
+# Import target "HPXInternal::hpx_threading_base" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_threading_base APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_threading_base PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_threading_base.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_threading_base )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_threading_base "${_IMPORT_PREFIX}/lib/libhpx_threading_base.a" )
+
+# Import target "HPXInternal::hpx_threadmanager" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_threadmanager APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_threadmanager PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_threadmanager.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_threadmanager )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_threadmanager "${_IMPORT_PREFIX}/lib/libhpx_threadmanager.a" )
+
+# Import target "HPXInternal::hpx_timed_execution" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_timed_execution APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_timed_execution PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_timed_execution.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_timed_execution )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_timed_execution "${_IMPORT_PREFIX}/lib/libhpx_timed_execution.a" )
+
+# Import target "HPXInternal::hpx_timing" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_timing APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_timing PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_timing.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_timing )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_timing "${_IMPORT_PREFIX}/lib/libhpx_timing.a" )
+
+# Import target "HPXInternal::hpx_topology" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_topology APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_topology PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_topology.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_topology )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_topology "${_IMPORT_PREFIX}/lib/libhpx_topology.a" )
+
+# Import target "HPXInternal::hpx_type_support" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_type_support APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_type_support PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_type_support.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_type_support )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_type_support "${_IMPORT_PREFIX}/lib/libhpx_type_support.a" )
+
+# Import target "HPXInternal::hpx_util" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_util APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_util PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_util.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_util )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_util "${_IMPORT_PREFIX}/lib/libhpx_util.a" )
+
+# Import target "HPXInternal::hpx_version" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_version APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_version PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_version.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_version )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_version "${_IMPORT_PREFIX}/lib/libhpx_version.a" )
+
+# Import target "HPXInternal::hpx_checkpoint_base" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_checkpoint_base APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_checkpoint_base PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_checkpoint_base.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_checkpoint_base )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_checkpoint_base "${_IMPORT_PREFIX}/lib/libhpx_checkpoint_base.a" )
+
+# Import target "HPXInternal::hpx_command_line_handling" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_command_line_handling APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_command_line_handling PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_command_line_handling.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_command_line_handling )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_command_line_handling "${_IMPORT_PREFIX}/lib/libhpx_command_line_handling.a" )
+
+# Import target "HPXInternal::hpx_compute" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_compute APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_compute PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_compute.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_compute )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_compute "${_IMPORT_PREFIX}/lib/libhpx_compute.a" )
+
+# Import target "HPXInternal::hpx_init_runtime" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_init_runtime APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_init_runtime PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_init_runtime.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_init_runtime )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_init_runtime "${_IMPORT_PREFIX}/lib/libhpx_init_runtime.a" )
+
+# Import target "HPXInternal::hpx_parcelset" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_parcelset APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_parcelset PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_parcelset.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_parcelset )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_parcelset "${_IMPORT_PREFIX}/lib/libhpx_parcelset.a" )
+
+# Import target "HPXInternal::hpx_parcelset_base" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_parcelset_base APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_parcelset_base PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_parcelset_base.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_parcelset_base )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_parcelset_base "${_IMPORT_PREFIX}/lib/libhpx_parcelset_base.a" )
+
+# Import target "HPXInternal::hpx_plugin_factories" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_plugin_factories APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_plugin_factories PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_plugin_factories.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_plugin_factories )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_plugin_factories "${_IMPORT_PREFIX}/lib/libhpx_plugin_factories.a" )
+
+# Import target "HPXInternal::hpx_init" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_init APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_init PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_init.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_init )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_init "${_IMPORT_PREFIX}/lib/libhpx_init.a" )
+
+# Import target "HPXInternal::hpx_wrap" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_wrap APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_wrap PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libhpx_wrap.a"
+  )
+
+list(APPEND _cmake_import_check_targets HPXInternal::hpx_wrap )
+list(APPEND _cmake_import_check_files_for_HPXInternal::hpx_wrap "${_IMPORT_PREFIX}/lib/libhpx_wrap.a" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
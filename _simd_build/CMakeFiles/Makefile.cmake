@@ -0,0 +1,2951 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/CTestConfig.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/hpx_application_release.pc.in"
+  "CMakeFiles/hpx_component_release.pc.in"
+  "lib/pkgconfig/hpx_application_release.pc.in"
+  "lib/pkgconfig/hpx_component_release.pc.in"
+  "/root/repo/cmake/FindAsio.cmake"
+  "/root/repo/cmake/FindHwloc.cmake"
+  "/root/repo/cmake/HPX_AddCompileFlag.cmake"
+  "/root/repo/cmake/HPX_AddCompileTest.cmake"
+  "/root/repo/cmake/HPX_AddComponent.cmake"
+  "/root/repo/cmake/HPX_AddConfigTest.cmake"
+  "/root/repo/cmake/HPX_AddDefinitions.cmake"
+  "/root/repo/cmake/HPX_AddExecutable.cmake"
+  "/root/repo/cmake/HPX_AddLibrary.cmake"
+  "/root/repo/cmake/HPX_AddLibraryHeaders.cmake"
+  "/root/repo/cmake/HPX_AddLibrarySources.cmake"
+  "/root/repo/cmake/HPX_AddLinkFlag.cmake"
+  "/root/repo/cmake/HPX_AddModule.cmake"
+  "/root/repo/cmake/HPX_AddPseudoDependencies.cmake"
+  "/root/repo/cmake/HPX_AddPseudoTarget.cmake"
+  "/root/repo/cmake/HPX_AddSourceGroup.cmake"
+  "/root/repo/cmake/HPX_AddTest.cmake"
+  "/root/repo/cmake/HPX_AppendProperty.cmake"
+  "/root/repo/cmake/HPX_CXXOverrides.cmake"
+  "/root/repo/cmake/HPX_CheckCXXStandard.cmake"
+  "/root/repo/cmake/HPX_CompilerFlagsTargets.cmake"
+  "/root/repo/cmake/HPX_CreateSymbolicLink.cmake"
+  "/root/repo/cmake/HPX_Documentation.cmake"
+  "/root/repo/cmake/HPX_ExportTargets.cmake"
+  "/root/repo/cmake/HPX_ForceOutOfTreeBuild.cmake"
+  "/root/repo/cmake/HPX_ForwardCacheVariables.cmake"
+  "/root/repo/cmake/HPX_GeneratePackage.cmake"
+  "/root/repo/cmake/HPX_GeneratePackageUtils.cmake"
+  "/root/repo/cmake/HPX_GitCommit.cmake"
+  "/root/repo/cmake/HPX_HandleComponentDependencies.cmake"
+  "/root/repo/cmake/HPX_Include.cmake"
+  "/root/repo/cmake/HPX_Message.cmake"
+  "/root/repo/cmake/HPX_Option.cmake"
+  "/root/repo/cmake/HPX_ParcelPorts.cmake"
+  "/root/repo/cmake/HPX_PerformCxxFeatureTests.cmake"
+  "/root/repo/cmake/HPX_PrintSummary.cmake"
+  "/root/repo/cmake/HPX_SetCMakePolicy.cmake"
+  "/root/repo/cmake/HPX_SetFullRPATH.cmake"
+  "/root/repo/cmake/HPX_SetLibName.cmake"
+  "/root/repo/cmake/HPX_SetOutputPaths.cmake"
+  "/root/repo/cmake/HPX_SetPlatform.cmake"
+  "/root/repo/cmake/HPX_SetupAllocator.cmake"
+  "/root/repo/cmake/HPX_SetupApex.cmake"
+  "/root/repo/cmake/HPX_SetupAsio.cmake"
+  "/root/repo/cmake/HPX_SetupBoost.cmake"
+  "/root/repo/cmake/HPX_SetupBoostFilesystem.cmake"
+  "/root/repo/cmake/HPX_SetupBoostIostreams.cmake"
+  "/root/repo/cmake/HPX_SetupCUDA.cmake"
+  "/root/repo/cmake/HPX_SetupDatapar.cmake"
+  "/root/repo/cmake/HPX_SetupHIP.cmake"
+  "/root/repo/cmake/HPX_SetupHwloc.cmake"
+  "/root/repo/cmake/HPX_SetupLCI.cmake"
+  "/root/repo/cmake/HPX_SetupMPI.cmake"
+  "/root/repo/cmake/HPX_SetupPapi.cmake"
+  "/root/repo/cmake/HPX_SetupTarget.cmake"
+  "/root/repo/cmake/HPX_SetupThreads.cmake"
+  "/root/repo/cmake/HPX_SetupValgrind.cmake"
+  "/root/repo/cmake/HPX_ShortenPseudoTarget.cmake"
+  "/root/repo/cmake/HPX_Utils.cmake"
+  "/root/repo/cmake/TargetArch.cmake"
+  "/root/repo/cmake/templates/HPXCacheVariables.cmake.in"
+  "/root/repo/cmake/templates/HPXConfig.cmake.in"
+  "/root/repo/cmake/templates/HPXMacros.cmake.in"
+  "/root/repo/cmake/templates/compatibility_header.hpp.in"
+  "/root/repo/cmake/templates/config_defines_entries_for_modules.cpp.in"
+  "/root/repo/cmake/templates/config_defines_strings.hpp.in"
+  "/root/repo/cmake/templates/global_module_header.hpp.in"
+  "/root/repo/cmake/templates/hpx_application.pc.in"
+  "/root/repo/cmake/templates/hpx_component.pc.in"
+  "/root/repo/cmake/templates/hpxcxx.in"
+  "/root/repo/cmake/templates/hpxrun.py.in"
+  "/root/repo/cmake/templates/modules_enabled.hpp.in"
+  "/root/repo/components/CMakeLists.txt"
+  "/root/repo/init/CMakeLists.txt"
+  "/root/repo/libs/CMakeLists.txt"
+  "/root/repo/libs/core/CMakeLists.txt"
+  "/root/repo/libs/core/affinity/CMakeLists.txt"
+  "/root/repo/libs/core/affinity/tests/CMakeLists.txt"
+  "/root/repo/libs/core/affinity/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/algorithms/CMakeLists.txt"
+  "/root/repo/libs/core/algorithms/examples/CMakeLists.txt"
+  "/root/repo/libs/core/algorithms/tests/CMakeLists.txt"
+  "/root/repo/libs/core/algorithms/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt"
+  "/root/repo/libs/core/algorithms/tests/unit/algorithms/detail/CMakeLists.txt"
+  "/root/repo/libs/core/algorithms/tests/unit/algorithms/util/CMakeLists.txt"
+  "/root/repo/libs/core/algorithms/tests/unit/block/CMakeLists.txt"
+  "/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt"
+  "/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt"
+  "/root/repo/libs/core/allocator_support/CMakeLists.txt"
+  "/root/repo/libs/core/allocator_support/examples/CMakeLists.txt"
+  "/root/repo/libs/core/allocator_support/tests/CMakeLists.txt"
+  "/root/repo/libs/core/allocator_support/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/asio/CMakeLists.txt"
+  "/root/repo/libs/core/asio/examples/CMakeLists.txt"
+  "/root/repo/libs/core/asio/tests/CMakeLists.txt"
+  "/root/repo/libs/core/asio/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/assertion/CMakeLists.txt"
+  "/root/repo/libs/core/assertion/examples/CMakeLists.txt"
+  "/root/repo/libs/core/assertion/tests/CMakeLists.txt"
+  "/root/repo/libs/core/assertion/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/async_base/CMakeLists.txt"
+  "/root/repo/libs/core/async_base/examples/CMakeLists.txt"
+  "/root/repo/libs/core/async_base/tests/CMakeLists.txt"
+  "/root/repo/libs/core/async_base/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/async_combinators/CMakeLists.txt"
+  "/root/repo/libs/core/async_combinators/examples/CMakeLists.txt"
+  "/root/repo/libs/core/async_combinators/tests/CMakeLists.txt"
+  "/root/repo/libs/core/async_combinators/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/async_cuda/CMakeLists.txt"
+  "/root/repo/libs/core/async_local/CMakeLists.txt"
+  "/root/repo/libs/core/async_local/examples/CMakeLists.txt"
+  "/root/repo/libs/core/async_local/tests/CMakeLists.txt"
+  "/root/repo/libs/core/async_local/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/async_mpi/CMakeLists.txt"
+  "/root/repo/libs/core/batch_environments/CMakeLists.txt"
+  "/root/repo/libs/core/batch_environments/examples/CMakeLists.txt"
+  "/root/repo/libs/core/batch_environments/tests/CMakeLists.txt"
+  "/root/repo/libs/core/batch_environments/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/cache/CMakeLists.txt"
+  "/root/repo/libs/core/cache/examples/CMakeLists.txt"
+  "/root/repo/libs/core/cache/tests/CMakeLists.txt"
+  "/root/repo/libs/core/cache/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/command_line_handling_local/CMakeLists.txt"
+  "/root/repo/libs/core/command_line_handling_local/examples/CMakeLists.txt"
+  "/root/repo/libs/core/command_line_handling_local/tests/CMakeLists.txt"
+  "/root/repo/libs/core/command_line_handling_local/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/compute_local/CMakeLists.txt"
+  "/root/repo/libs/core/compute_local/examples/CMakeLists.txt"
+  "/root/repo/libs/core/compute_local/tests/CMakeLists.txt"
+  "/root/repo/libs/core/compute_local/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/concepts/CMakeLists.txt"
+  "/root/repo/libs/core/concepts/examples/CMakeLists.txt"
+  "/root/repo/libs/core/concepts/tests/CMakeLists.txt"
+  "/root/repo/libs/core/concepts/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/concurrency/CMakeLists.txt"
+  "/root/repo/libs/core/concurrency/examples/CMakeLists.txt"
+  "/root/repo/libs/core/concurrency/tests/CMakeLists.txt"
+  "/root/repo/libs/core/concurrency/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/config/CMakeLists.txt"
+  "/root/repo/libs/core/config/cmake/templates/config_defines.hpp.in"
+  "/root/repo/libs/core/config/cmake/templates/config_version.hpp.in"
+  "/root/repo/libs/core/config/examples/CMakeLists.txt"
+  "/root/repo/libs/core/config/tests/CMakeLists.txt"
+  "/root/repo/libs/core/config/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/config_registry/CMakeLists.txt"
+  "/root/repo/libs/core/config_registry/examples/CMakeLists.txt"
+  "/root/repo/libs/core/config_registry/tests/CMakeLists.txt"
+  "/root/repo/libs/core/config_registry/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/coroutines/CMakeLists.txt"
+  "/root/repo/libs/core/coroutines/examples/CMakeLists.txt"
+  "/root/repo/libs/core/coroutines/tests/CMakeLists.txt"
+  "/root/repo/libs/core/coroutines/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/datastructures/CMakeLists.txt"
+  "/root/repo/libs/core/datastructures/examples/CMakeLists.txt"
+  "/root/repo/libs/core/datastructures/tests/CMakeLists.txt"
+  "/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/debugging/CMakeLists.txt"
+  "/root/repo/libs/core/debugging/examples/CMakeLists.txt"
+  "/root/repo/libs/core/debugging/tests/CMakeLists.txt"
+  "/root/repo/libs/core/debugging/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/errors/CMakeLists.txt"
+  "/root/repo/libs/core/errors/examples/CMakeLists.txt"
+  "/root/repo/libs/core/errors/tests/CMakeLists.txt"
+  "/root/repo/libs/core/errors/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/execution/CMakeLists.txt"
+  "/root/repo/libs/core/execution/examples/CMakeLists.txt"
+  "/root/repo/libs/core/execution/tests/CMakeLists.txt"
+  "/root/repo/libs/core/execution/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/execution_base/CMakeLists.txt"
+  "/root/repo/libs/core/execution_base/examples/CMakeLists.txt"
+  "/root/repo/libs/core/execution_base/tests/CMakeLists.txt"
+  "/root/repo/libs/core/execution_base/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/executors/CMakeLists.txt"
+  "/root/repo/libs/core/executors/examples/CMakeLists.txt"
+  "/root/repo/libs/core/executors/tests/CMakeLists.txt"
+  "/root/repo/libs/core/executors/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/filesystem/CMakeLists.txt"
+  "/root/repo/libs/core/filesystem/examples/CMakeLists.txt"
+  "/root/repo/libs/core/filesystem/tests/CMakeLists.txt"
+  "/root/repo/libs/core/filesystem/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/format/CMakeLists.txt"
+  "/root/repo/libs/core/format/examples/CMakeLists.txt"
+  "/root/repo/libs/core/format/tests/CMakeLists.txt"
+  "/root/repo/libs/core/format/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/functional/CMakeLists.txt"
+  "/root/repo/libs/core/functional/examples/CMakeLists.txt"
+  "/root/repo/libs/core/functional/tests/CMakeLists.txt"
+  "/root/repo/libs/core/functional/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/futures/CMakeLists.txt"
+  "/root/repo/libs/core/futures/examples/CMakeLists.txt"
+  "/root/repo/libs/core/futures/tests/CMakeLists.txt"
+  "/root/repo/libs/core/futures/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/hardware/CMakeLists.txt"
+  "/root/repo/libs/core/hardware/examples/CMakeLists.txt"
+  "/root/repo/libs/core/hardware/tests/CMakeLists.txt"
+  "/root/repo/libs/core/hardware/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/hashing/CMakeLists.txt"
+  "/root/repo/libs/core/hashing/examples/CMakeLists.txt"
+  "/root/repo/libs/core/hashing/tests/CMakeLists.txt"
+  "/root/repo/libs/core/hashing/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/include_local/CMakeLists.txt"
+  "/root/repo/libs/core/include_local/examples/CMakeLists.txt"
+  "/root/repo/libs/core/include_local/tests/CMakeLists.txt"
+  "/root/repo/libs/core/include_local/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/ini/CMakeLists.txt"
+  "/root/repo/libs/core/ini/examples/CMakeLists.txt"
+  "/root/repo/libs/core/ini/tests/CMakeLists.txt"
+  "/root/repo/libs/core/ini/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/init_runtime_local/CMakeLists.txt"
+  "/root/repo/libs/core/init_runtime_local/examples/CMakeLists.txt"
+  "/root/repo/libs/core/init_runtime_local/tests/CMakeLists.txt"
+  "/root/repo/libs/core/init_runtime_local/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/io_service/CMakeLists.txt"
+  "/root/repo/libs/core/io_service/examples/CMakeLists.txt"
+  "/root/repo/libs/core/io_service/tests/CMakeLists.txt"
+  "/root/repo/libs/core/io_service/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/iterator_support/CMakeLists.txt"
+  "/root/repo/libs/core/iterator_support/examples/CMakeLists.txt"
+  "/root/repo/libs/core/iterator_support/tests/CMakeLists.txt"
+  "/root/repo/libs/core/iterator_support/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/itt_notify/CMakeLists.txt"
+  "/root/repo/libs/core/itt_notify/examples/CMakeLists.txt"
+  "/root/repo/libs/core/itt_notify/tests/CMakeLists.txt"
+  "/root/repo/libs/core/itt_notify/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/lci_base/CMakeLists.txt"
+  "/root/repo/libs/core/lcos_local/CMakeLists.txt"
+  "/root/repo/libs/core/lcos_local/examples/CMakeLists.txt"
+  "/root/repo/libs/core/lcos_local/tests/CMakeLists.txt"
+  "/root/repo/libs/core/lcos_local/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/lock_registration/CMakeLists.txt"
+  "/root/repo/libs/core/lock_registration/examples/CMakeLists.txt"
+  "/root/repo/libs/core/lock_registration/tests/CMakeLists.txt"
+  "/root/repo/libs/core/lock_registration/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/logging/CMakeLists.txt"
+  "/root/repo/libs/core/logging/examples/CMakeLists.txt"
+  "/root/repo/libs/core/logging/tests/CMakeLists.txt"
+  "/root/repo/libs/core/logging/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/memory/CMakeLists.txt"
+  "/root/repo/libs/core/memory/examples/CMakeLists.txt"
+  "/root/repo/libs/core/memory/tests/CMakeLists.txt"
+  "/root/repo/libs/core/memory/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/mpi_base/CMakeLists.txt"
+  "/root/repo/libs/core/pack_traversal/CMakeLists.txt"
+  "/root/repo/libs/core/pack_traversal/examples/CMakeLists.txt"
+  "/root/repo/libs/core/pack_traversal/tests/CMakeLists.txt"
+  "/root/repo/libs/core/pack_traversal/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/plugin/CMakeLists.txt"
+  "/root/repo/libs/core/plugin/tests/CMakeLists.txt"
+  "/root/repo/libs/core/plugin/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/prefix/CMakeLists.txt"
+  "/root/repo/libs/core/prefix/tests/CMakeLists.txt"
+  "/root/repo/libs/core/prefix/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/preprocessor/CMakeLists.txt"
+  "/root/repo/libs/core/preprocessor/tests/CMakeLists.txt"
+  "/root/repo/libs/core/preprocessor/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/program_options/CMakeLists.txt"
+  "/root/repo/libs/core/program_options/examples/CMakeLists.txt"
+  "/root/repo/libs/core/program_options/tests/CMakeLists.txt"
+  "/root/repo/libs/core/program_options/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/properties/CMakeLists.txt"
+  "/root/repo/libs/core/properties/examples/CMakeLists.txt"
+  "/root/repo/libs/core/properties/tests/CMakeLists.txt"
+  "/root/repo/libs/core/properties/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/resiliency/CMakeLists.txt"
+  "/root/repo/libs/core/resiliency/examples/CMakeLists.txt"
+  "/root/repo/libs/core/resiliency/tests/CMakeLists.txt"
+  "/root/repo/libs/core/resiliency/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/resource_partitioner/CMakeLists.txt"
+  "/root/repo/libs/core/resource_partitioner/examples/CMakeLists.txt"
+  "/root/repo/libs/core/resource_partitioner/tests/CMakeLists.txt"
+  "/root/repo/libs/core/resource_partitioner/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/runtime_configuration/CMakeLists.txt"
+  "/root/repo/libs/core/runtime_configuration/examples/CMakeLists.txt"
+  "/root/repo/libs/core/runtime_configuration/tests/CMakeLists.txt"
+  "/root/repo/libs/core/runtime_configuration/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/runtime_local/CMakeLists.txt"
+  "/root/repo/libs/core/runtime_local/examples/CMakeLists.txt"
+  "/root/repo/libs/core/runtime_local/tests/CMakeLists.txt"
+  "/root/repo/libs/core/runtime_local/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/schedulers/CMakeLists.txt"
+  "/root/repo/libs/core/schedulers/examples/CMakeLists.txt"
+  "/root/repo/libs/core/schedulers/tests/CMakeLists.txt"
+  "/root/repo/libs/core/schedulers/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/serialization/CMakeLists.txt"
+  "/root/repo/libs/core/serialization/examples/CMakeLists.txt"
+  "/root/repo/libs/core/serialization/tests/CMakeLists.txt"
+  "/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/serialization/tests/unit/polymorphic/CMakeLists.txt"
+  "/root/repo/libs/core/static_reinit/CMakeLists.txt"
+  "/root/repo/libs/core/static_reinit/examples/CMakeLists.txt"
+  "/root/repo/libs/core/static_reinit/tests/CMakeLists.txt"
+  "/root/repo/libs/core/static_reinit/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/string_util/CMakeLists.txt"
+  "/root/repo/libs/core/string_util/examples/CMakeLists.txt"
+  "/root/repo/libs/core/string_util/tests/CMakeLists.txt"
+  "/root/repo/libs/core/string_util/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/synchronization/CMakeLists.txt"
+  "/root/repo/libs/core/synchronization/examples/CMakeLists.txt"
+  "/root/repo/libs/core/synchronization/tests/CMakeLists.txt"
+  "/root/repo/libs/core/synchronization/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/synchronization/tests/unit/shared_mutex/CMakeLists.txt"
+  "/root/repo/libs/core/tag_invoke/CMakeLists.txt"
+  "/root/repo/libs/core/tag_invoke/examples/CMakeLists.txt"
+  "/root/repo/libs/core/tag_invoke/tests/CMakeLists.txt"
+  "/root/repo/libs/core/tag_invoke/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/testing/CMakeLists.txt"
+  "/root/repo/libs/core/testing/examples/CMakeLists.txt"
+  "/root/repo/libs/core/testing/tests/CMakeLists.txt"
+  "/root/repo/libs/core/testing/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/thread_pool_util/CMakeLists.txt"
+  "/root/repo/libs/core/thread_pool_util/examples/CMakeLists.txt"
+  "/root/repo/libs/core/thread_pool_util/tests/CMakeLists.txt"
+  "/root/repo/libs/core/thread_pool_util/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/thread_pools/CMakeLists.txt"
+  "/root/repo/libs/core/thread_pools/examples/CMakeLists.txt"
+  "/root/repo/libs/core/thread_pools/tests/CMakeLists.txt"
+  "/root/repo/libs/core/thread_pools/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/thread_support/CMakeLists.txt"
+  "/root/repo/libs/core/thread_support/examples/CMakeLists.txt"
+  "/root/repo/libs/core/thread_support/tests/CMakeLists.txt"
+  "/root/repo/libs/core/thread_support/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/threading/CMakeLists.txt"
+  "/root/repo/libs/core/threading/examples/CMakeLists.txt"
+  "/root/repo/libs/core/threading/tests/CMakeLists.txt"
+  "/root/repo/libs/core/threading/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/threading_base/CMakeLists.txt"
+  "/root/repo/libs/core/threading_base/examples/CMakeLists.txt"
+  "/root/repo/libs/core/threading_base/tests/CMakeLists.txt"
+  "/root/repo/libs/core/threading_base/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/threadmanager/CMakeLists.txt"
+  "/root/repo/libs/core/threadmanager/examples/CMakeLists.txt"
+  "/root/repo/libs/core/threadmanager/tests/CMakeLists.txt"
+  "/root/repo/libs/core/threadmanager/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/timed_execution/CMakeLists.txt"
+  "/root/repo/libs/core/timed_execution/examples/CMakeLists.txt"
+  "/root/repo/libs/core/timed_execution/tests/CMakeLists.txt"
+  "/root/repo/libs/core/timed_execution/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/timing/CMakeLists.txt"
+  "/root/repo/libs/core/timing/examples/CMakeLists.txt"
+  "/root/repo/libs/core/timing/tests/CMakeLists.txt"
+  "/root/repo/libs/core/timing/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/topology/CMakeLists.txt"
+  "/root/repo/libs/core/topology/examples/CMakeLists.txt"
+  "/root/repo/libs/core/topology/tests/CMakeLists.txt"
+  "/root/repo/libs/core/topology/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/type_support/CMakeLists.txt"
+  "/root/repo/libs/core/type_support/examples/CMakeLists.txt"
+  "/root/repo/libs/core/type_support/tests/CMakeLists.txt"
+  "/root/repo/libs/core/type_support/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/util/CMakeLists.txt"
+  "/root/repo/libs/core/util/examples/CMakeLists.txt"
+  "/root/repo/libs/core/util/tests/CMakeLists.txt"
+  "/root/repo/libs/core/util/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/core/version/CMakeLists.txt"
+  "/root/repo/libs/full/CMakeLists.txt"
+  "/root/repo/libs/full/actions/CMakeLists.txt"
+  "/root/repo/libs/full/actions_base/CMakeLists.txt"
+  "/root/repo/libs/full/agas/CMakeLists.txt"
+  "/root/repo/libs/full/agas_base/CMakeLists.txt"
+  "/root/repo/libs/full/async_colocated/CMakeLists.txt"
+  "/root/repo/libs/full/async_distributed/CMakeLists.txt"
+  "/root/repo/libs/full/checkpoint/CMakeLists.txt"
+  "/root/repo/libs/full/checkpoint_base/CMakeLists.txt"
+  "/root/repo/libs/full/checkpoint_base/tests/CMakeLists.txt"
+  "/root/repo/libs/full/checkpoint_base/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/full/collectives/CMakeLists.txt"
+  "/root/repo/libs/full/command_line_handling/CMakeLists.txt"
+  "/root/repo/libs/full/command_line_handling/tests/CMakeLists.txt"
+  "/root/repo/libs/full/command_line_handling/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/full/components/CMakeLists.txt"
+  "/root/repo/libs/full/components_base/CMakeLists.txt"
+  "/root/repo/libs/full/compute/CMakeLists.txt"
+  "/root/repo/libs/full/compute/examples/CMakeLists.txt"
+  "/root/repo/libs/full/compute/tests/CMakeLists.txt"
+  "/root/repo/libs/full/compute/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/full/distribution_policies/CMakeLists.txt"
+  "/root/repo/libs/full/executors_distributed/CMakeLists.txt"
+  "/root/repo/libs/full/include/CMakeLists.txt"
+  "/root/repo/libs/full/init_runtime/CMakeLists.txt"
+  "/root/repo/libs/full/init_runtime/examples/CMakeLists.txt"
+  "/root/repo/libs/full/init_runtime/tests/CMakeLists.txt"
+  "/root/repo/libs/full/init_runtime/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/full/lcos_distributed/CMakeLists.txt"
+  "/root/repo/libs/full/naming/CMakeLists.txt"
+  "/root/repo/libs/full/naming_base/CMakeLists.txt"
+  "/root/repo/libs/full/parcelport_lci/CMakeLists.txt"
+  "/root/repo/libs/full/parcelport_libfabric/CMakeLists.txt"
+  "/root/repo/libs/full/parcelport_mpi/CMakeLists.txt"
+  "/root/repo/libs/full/parcelport_tcp/CMakeLists.txt"
+  "/root/repo/libs/full/parcelset/CMakeLists.txt"
+  "/root/repo/libs/full/parcelset/examples/CMakeLists.txt"
+  "/root/repo/libs/full/parcelset/tests/CMakeLists.txt"
+  "/root/repo/libs/full/parcelset/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/full/parcelset_base/CMakeLists.txt"
+  "/root/repo/libs/full/parcelset_base/examples/CMakeLists.txt"
+  "/root/repo/libs/full/parcelset_base/tests/CMakeLists.txt"
+  "/root/repo/libs/full/parcelset_base/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/full/performance_counters/CMakeLists.txt"
+  "/root/repo/libs/full/plugin_factories/CMakeLists.txt"
+  "/root/repo/libs/full/plugin_factories/examples/CMakeLists.txt"
+  "/root/repo/libs/full/plugin_factories/tests/CMakeLists.txt"
+  "/root/repo/libs/full/plugin_factories/tests/unit/CMakeLists.txt"
+  "/root/repo/libs/full/resiliency_distributed/CMakeLists.txt"
+  "/root/repo/libs/full/runtime_components/CMakeLists.txt"
+  "/root/repo/libs/full/runtime_distributed/CMakeLists.txt"
+  "/root/repo/libs/full/segmented_algorithms/CMakeLists.txt"
+  "/root/repo/libs/full/statistics/CMakeLists.txt"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tests/unit/CMakeLists.txt"
+  "/root/repo/tests/unit/build/CMakeLists.txt"
+  "/root/repo/wrap/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseArguments.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindBoost.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGit.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPythonInterp.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "DartConfiguration.tcl"
+  "bin/hpxrun.py"
+  "libs/core/config/include/hpx/config/config_strings.hpp"
+  "CMakeFiles/hpx/config/config_strings.hpp"
+  "lib/cmake/HPX/HPXCacheVariables.cmake"
+  "lib/cmake/HPX/HPXConfigVersion.cmake"
+  "CMakeFiles/HPXConfig.cmake"
+  "CMakeFiles/hpxcxx"
+  "lib/cmake/HPX/HPXConfig.cmake"
+  "bin/hpxcxx"
+  "CMakeFiles/HPXMacros.cmake"
+  "lib/cmake/HPX/HPXMacros.cmake"
+  "lib/pkgconfig/hpx_application_release.pc.in"
+  "CMakeFiles/hpx_application_release.pc.in"
+  "lib/pkgconfig/hpx_component_release.pc.in"
+  "CMakeFiles/hpx_component_release.pc.in"
+  "lib/pkgconfig/hpx_application_release.pc"
+  "lib/pkgconfig/hpx_application.pc"
+  "CMakeFiles/hpx_application_release.pc"
+  "CMakeFiles/hpx_application.pc"
+  "lib/pkgconfig/hpx_component_release.pc"
+  "lib/pkgconfig/hpx_component.pc"
+  "CMakeFiles/hpx_component_release.pc"
+  "CMakeFiles/hpx_component.pc"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/config/include/hpx/config/modules_enabled.hpp"
+  "libs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/affinity/include_compatibility/hpx/affinity.hpp"
+  "libs/core/affinity/include_compatibility/hpx/runtime/threads/policies/affinity_data.hpp"
+  "libs/core/affinity/include_compatibility/hpx/runtime/threads/policies/parse_affinity_options.hpp"
+  "libs/core/affinity/include/hpx/modules/affinity.hpp"
+  "libs/core/affinity/include/hpx/affinity/config/defines.hpp"
+  "libs/core/affinity/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/affinity/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/affinity/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/algorithms/include_compatibility/hpx/algorithms.hpp"
+  "libs/core/algorithms/include_compatibility/hpx/parallel/traits/projected.hpp"
+  "libs/core/algorithms/include_compatibility/hpx/parallel/traits/projected_range.hpp"
+  "libs/core/algorithms/include_compatibility/hpx/traits/is_value_proxy.hpp"
+  "libs/core/algorithms/include_compatibility/hpx/traits/pointer_category.hpp"
+  "libs/core/algorithms/include_compatibility/hpx/traits/segmented_iterator_traits.hpp"
+  "libs/core/algorithms/include/hpx/modules/algorithms.hpp"
+  "libs/core/algorithms/include/hpx/algorithms/config/defines.hpp"
+  "libs/core/algorithms/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/algorithms/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/algorithms/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/algorithms/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/detail/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/util/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/algorithms/tests/unit/block/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/allocator_support/include_compatibility/hpx/allocator_support.hpp"
+  "libs/core/allocator_support/include_compatibility/hpx/util/allocator_deleter.hpp"
+  "libs/core/allocator_support/include_compatibility/hpx/util/internal_allocator.hpp"
+  "libs/core/allocator_support/include_compatibility/hpx/compute/detail/new.hpp"
+  "libs/core/allocator_support/include/hpx/modules/allocator_support.hpp"
+  "libs/core/allocator_support/include/hpx/allocator_support/config/defines.hpp"
+  "libs/core/allocator_support/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/allocator_support/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/allocator_support/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/allocator_support/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/asio/include_compatibility/hpx/util/asio_util.hpp"
+  "libs/core/asio/include_compatibility/hpx/util/map_hostnames.hpp"
+  "libs/core/asio/include/hpx/modules/asio.hpp"
+  "libs/core/asio/include/hpx/asio/config/defines.hpp"
+  "libs/core/asio/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/asio/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/asio/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/asio/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/assertion/include_compatibility/hpx/assertion.hpp"
+  "libs/core/assertion/include_compatibility/hpx/util/assert.hpp"
+  "libs/core/assertion/include/hpx/assertion/config/defines.hpp"
+  "libs/core/assertion/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/assertion/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/assertion/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/assertion/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/async_base/include_compatibility/hpx/runtime/launch_policy.hpp"
+  "libs/core/async_base/include_compatibility/hpx/traits/is_launch_policy.hpp"
+  "libs/core/async_base/include/hpx/modules/async_base.hpp"
+  "libs/core/async_base/include/hpx/async_base/config/defines.hpp"
+  "libs/core/async_base/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/async_base/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/async_base/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/async_base/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/async_combinators/include_compatibility/hpx/lcos/future_wait.hpp"
+  "libs/core/async_combinators/include_compatibility/hpx/lcos/split_future.hpp"
+  "libs/core/async_combinators/include_compatibility/hpx/lcos/wait_all.hpp"
+  "libs/core/async_combinators/include_compatibility/hpx/lcos/wait_any.hpp"
+  "libs/core/async_combinators/include_compatibility/hpx/lcos/wait_each.hpp"
+  "libs/core/async_combinators/include_compatibility/hpx/lcos/wait_some.hpp"
+  "libs/core/async_combinators/include_compatibility/hpx/lcos/when_all.hpp"
+  "libs/core/async_combinators/include_compatibility/hpx/lcos/when_any.hpp"
+  "libs/core/async_combinators/include_compatibility/hpx/lcos/when_each.hpp"
+  "libs/core/async_combinators/include_compatibility/hpx/lcos/when_some.hpp"
+  "libs/core/async_combinators/include/hpx/modules/async_combinators.hpp"
+  "libs/core/async_combinators/include/hpx/async_combinators/config/defines.hpp"
+  "libs/core/async_combinators/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/async_combinators/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/async_combinators/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/async_combinators/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/async_cuda/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/async_local/include/hpx/modules/async_local.hpp"
+  "libs/core/async_local/include/hpx/async_local/config/defines.hpp"
+  "libs/core/async_local/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/async_local/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/async_local/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/async_local/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/async_mpi/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/batch_environments/include_compatibility/hpx/batch_environments.hpp"
+  "libs/core/batch_environments/include_compatibility/hpx/util/batch_environment.hpp"
+  "libs/core/batch_environments/include_compatibility/hpx/util/batch_environments/alps_environment.hpp"
+  "libs/core/batch_environments/include_compatibility/hpx/util/batch_environments/pbs_environment.hpp"
+  "libs/core/batch_environments/include_compatibility/hpx/util/batch_environments/slurm_environment.hpp"
+  "libs/core/batch_environments/include/hpx/modules/batch_environments.hpp"
+  "libs/core/batch_environments/include/hpx/batch_environments/config/defines.hpp"
+  "libs/core/batch_environments/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/batch_environments/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/batch_environments/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/batch_environments/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/cache/include_compatibility/hpx/util/cache/local_cache.hpp"
+  "libs/core/cache/include_compatibility/hpx/util/cache/lru_cache.hpp"
+  "libs/core/cache/include_compatibility/hpx/util/cache/entries/entry.hpp"
+  "libs/core/cache/include_compatibility/hpx/util/cache/entries/fifo_entry.hpp"
+  "libs/core/cache/include_compatibility/hpx/util/cache/entries/lfu_entry.hpp"
+  "libs/core/cache/include_compatibility/hpx/util/cache/entries/lru_entry.hpp"
+  "libs/core/cache/include_compatibility/hpx/util/cache/entries/size_entry.hpp"
+  "libs/core/cache/include_compatibility/hpx/util/cache/policies/always.hpp"
+  "libs/core/cache/include_compatibility/hpx/util/cache/statistics/local_full_statistics.hpp"
+  "libs/core/cache/include_compatibility/hpx/util/cache/statistics/local_statistics.hpp"
+  "libs/core/cache/include_compatibility/hpx/util/cache/statistics/no_statistics.hpp"
+  "libs/core/cache/include/hpx/modules/cache.hpp"
+  "libs/core/cache/include/hpx/cache/config/defines.hpp"
+  "libs/core/cache/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/cache/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/cache/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/cache/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/command_line_handling_local/include/hpx/modules/command_line_handling_local.hpp"
+  "libs/core/command_line_handling_local/include/hpx/command_line_handling_local/config/defines.hpp"
+  "libs/core/command_line_handling_local/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/command_line_handling_local/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/command_line_handling_local/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/command_line_handling_local/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/compute_local/include_compatibility/hpx/compute/vector.hpp"
+  "libs/core/compute_local/include_compatibility/hpx/compute/traits/allocator_traits.hpp"
+  "libs/core/compute_local/include_compatibility/hpx/compute/host/numa_allocator.hpp"
+  "libs/core/compute_local/include_compatibility/hpx/compute/host/numa_binding_allocator.hpp"
+  "libs/core/compute_local/include/hpx/modules/compute_local.hpp"
+  "libs/core/compute_local/include/hpx/compute_local/config/defines.hpp"
+  "libs/core/compute_local/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/compute_local/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/compute_local/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/compute_local/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/concepts/include_compatibility/hpx/concepts.hpp"
+  "libs/core/concepts/include_compatibility/hpx/traits/concepts.hpp"
+  "libs/core/concepts/include_compatibility/hpx/traits/has_member_xxx.hpp"
+  "libs/core/concepts/include_compatibility/hpx/traits/has_xxx.hpp"
+  "libs/core/concepts/include/hpx/modules/concepts.hpp"
+  "libs/core/concepts/include/hpx/concepts/config/defines.hpp"
+  "libs/core/concepts/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/concepts/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/concepts/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/concepts/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/concurrency/include_compatibility/hpx/compat/barrier.hpp"
+  "libs/core/concurrency/include_compatibility/hpx/concurrency.hpp"
+  "libs/core/concurrency/include_compatibility/hpx/util/lockfree/concurrentqueue.hpp"
+  "libs/core/concurrency/include_compatibility/hpx/util/lockfree/deque.hpp"
+  "libs/core/concurrency/include_compatibility/hpx/util/lockfree/freelist.hpp"
+  "libs/core/concurrency/include_compatibility/hpx/util/spinlock.hpp"
+  "libs/core/concurrency/include_compatibility/hpx/util/spinlock_pool.hpp"
+  "libs/core/concurrency/include/hpx/modules/concurrency.hpp"
+  "libs/core/concurrency/include/hpx/concurrency/config/defines.hpp"
+  "libs/core/concurrency/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/concurrency/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/concurrency/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/concurrency/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/config/include/hpx/config/config/defines.hpp"
+  "libs/core/config/include/hpx/config/version.hpp"
+  "libs/core/config/include/hpx/config/defines.hpp"
+  "libs/core/config/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/config/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/config/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/config/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/config_registry/include/hpx/config_registry/config/defines.hpp"
+  "libs/core/config_registry/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/config_registry/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/config_registry/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/config_registry/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/coroutines/include_compatibility/hpx/coroutines.hpp"
+  "libs/core/coroutines/include_compatibility/hpx/runtime/threads/coroutines/coroutine.hpp"
+  "libs/core/coroutines/include_compatibility/hpx/runtime/threads/coroutines/coroutine_fwd.hpp"
+  "libs/core/coroutines/include_compatibility/hpx/runtime/threads/thread_enums.hpp"
+  "libs/core/coroutines/include_compatibility/hpx/runtime/threads/thread_id_type.hpp"
+  "libs/core/coroutines/include/hpx/modules/coroutines.hpp"
+  "libs/core/coroutines/include/hpx/coroutines/config/defines.hpp"
+  "libs/core/coroutines/src/config_entries.cpp"
+  "libs/core/coroutines/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/coroutines/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/coroutines/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/coroutines/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/datastructures/include_compatibility/hpx/datastructures.hpp"
+  "libs/core/datastructures/include_compatibility/hpx/runtime/serialization/dynamic_bitset.hpp"
+  "libs/core/datastructures/include_compatibility/hpx/runtime/serialization/optional.hpp"
+  "libs/core/datastructures/include_compatibility/hpx/runtime/serialization/tuple.hpp"
+  "libs/core/datastructures/include_compatibility/hpx/serialization/dynamic_bitset.hpp"
+  "libs/core/datastructures/include_compatibility/hpx/serialization/optional.hpp"
+  "libs/core/datastructures/include_compatibility/hpx/serialization/serializable_any.hpp"
+  "libs/core/datastructures/include_compatibility/hpx/serialization/tuple.hpp"
+  "libs/core/datastructures/include_compatibility/hpx/traits/supports_streaming_with_any.hpp"
+  "libs/core/datastructures/include_compatibility/hpx/traits/is_tuple_like.hpp"
+  "libs/core/datastructures/include_compatibility/hpx/util/any.hpp"
+  "libs/core/datastructures/include_compatibility/hpx/util/optional.hpp"
+  "libs/core/datastructures/include_compatibility/hpx/util/tuple.hpp"
+  "libs/core/datastructures/include_compatibility/hpx/util/serializable_any.hpp"
+  "libs/core/datastructures/include/hpx/modules/datastructures.hpp"
+  "libs/core/datastructures/include/hpx/datastructures/config/defines.hpp"
+  "libs/core/datastructures/src/config_entries.cpp"
+  "libs/core/datastructures/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/datastructures/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/datastructures/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/debugging/include_compatibility/hpx/debugging.hpp"
+  "libs/core/debugging/include_compatibility/hpx/util/backtrace.hpp"
+  "libs/core/debugging/include_compatibility/hpx/util/backtrace/backtrace.hpp"
+  "libs/core/debugging/include_compatibility/hpx/util/debug/demangle_helper.hpp"
+  "libs/core/debugging/include/hpx/modules/debugging.hpp"
+  "libs/core/debugging/include/hpx/debugging/config/defines.hpp"
+  "libs/core/debugging/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/debugging/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/debugging/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/debugging/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/errors/include_compatibility/hpx/error.hpp"
+  "libs/core/errors/include_compatibility/hpx/error_code.hpp"
+  "libs/core/errors/include_compatibility/hpx/errors.hpp"
+  "libs/core/errors/include_compatibility/hpx/exception_fwd.hpp"
+  "libs/core/errors/include_compatibility/hpx/exception_info.hpp"
+  "libs/core/errors/include_compatibility/hpx/exception_list.hpp"
+  "libs/core/errors/include_compatibility/hpx/throw_exception.hpp"
+  "libs/core/errors/include/hpx/modules/errors.hpp"
+  "libs/core/errors/include/hpx/errors/config/defines.hpp"
+  "libs/core/errors/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/errors/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/errors/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/errors/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/execution/include_compatibility/hpx/async_launch_policy_dispatch.hpp"
+  "libs/core/execution/include_compatibility/hpx/parallel/execution.hpp"
+  "libs/core/execution/include_compatibility/hpx/parallel/executor_parameters.hpp"
+  "libs/core/execution/include_compatibility/hpx/parallel/executors/auto_chunk_size.hpp"
+  "libs/core/execution/include_compatibility/hpx/parallel/executors/dynamic_chunk_size.hpp"
+  "libs/core/execution/include_compatibility/hpx/parallel/executors/execution.hpp"
+  "libs/core/execution/include_compatibility/hpx/parallel/executors/execution_information_fwd.hpp"
+  "libs/core/execution/include_compatibility/hpx/parallel/executors/execution_information.hpp"
+  "libs/core/execution/include_compatibility/hpx/parallel/executors/execution_parameters_fwd.hpp"
+  "libs/core/execution/include_compatibility/hpx/parallel/executors/execution_parameters.hpp"
+  "libs/core/execution/include_compatibility/hpx/parallel/executors/fused_bulk_execute.hpp"
+  "libs/core/execution/include_compatibility/hpx/parallel/executors/guided_chunk_size.hpp"
+  "libs/core/execution/include_compatibility/hpx/parallel/executors/persistent_auto_chunk_size.hpp"
+  "libs/core/execution/include_compatibility/hpx/parallel/executors/post_policy_dispatch.hpp"
+  "libs/core/execution/include_compatibility/hpx/parallel/executors/rebind_executor.hpp"
+  "libs/core/execution/include_compatibility/hpx/parallel/executors/static_chunk_size.hpp"
+  "libs/core/execution/include_compatibility/hpx/parallel/traits/vector_pack_alignment_size.hpp"
+  "libs/core/execution/include_compatibility/hpx/parallel/traits/vector_pack_all_any_none.hpp"
+  "libs/core/execution/include_compatibility/hpx/parallel/traits/vector_pack_conditionals.hpp"
+  "libs/core/execution/include_compatibility/hpx/parallel/traits/vector_pack_count_bits.hpp"
+  "libs/core/execution/include_compatibility/hpx/parallel/traits/vector_pack_find.hpp"
+  "libs/core/execution/include_compatibility/hpx/parallel/traits/vector_pack_get_set.hpp"
+  "libs/core/execution/include_compatibility/hpx/parallel/traits/vector_pack_load_store.hpp"
+  "libs/core/execution/include_compatibility/hpx/parallel/traits/vector_pack_load_reduce.hpp"
+  "libs/core/execution/include_compatibility/hpx/parallel/traits/vector_pack_type.hpp"
+  "libs/core/execution/include_compatibility/hpx/sync_launch_policy_dispatch.hpp"
+  "libs/core/execution/include_compatibility/hpx/traits/executor_traits.hpp"
+  "libs/core/execution/include_compatibility/hpx/traits/is_execution_policy.hpp"
+  "libs/core/execution/include/hpx/modules/execution.hpp"
+  "libs/core/execution/include/hpx/execution/config/defines.hpp"
+  "libs/core/execution/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/execution/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/execution/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/execution_base/include_compatibility/hpx/basic_execution.hpp"
+  "libs/core/execution_base/include_compatibility/hpx/parallel/executors/execution_fwd.hpp"
+  "libs/core/execution_base/include_compatibility/hpx/util/yield_while.hpp"
+  "libs/core/execution_base/include_compatibility/hpx/basic_execution/agent_base.hpp"
+  "libs/core/execution_base/include_compatibility/hpx/basic_execution/agent_ref.hpp"
+  "libs/core/execution_base/include_compatibility/hpx/basic_execution/context_base.hpp"
+  "libs/core/execution_base/include_compatibility/hpx/basic_execution/execution.hpp"
+  "libs/core/execution_base/include_compatibility/hpx/basic_execution/resource_base.hpp"
+  "libs/core/execution_base/include_compatibility/hpx/basic_execution/this_thread.hpp"
+  "libs/core/execution_base/include_compatibility/hpx/traits/is_executor.hpp"
+  "libs/core/execution_base/include_compatibility/hpx/traits/is_executor_parameters.hpp"
+  "libs/core/execution_base/include/hpx/modules/execution_base.hpp"
+  "libs/core/execution_base/include/hpx/execution_base/config/defines.hpp"
+  "libs/core/execution_base/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/execution_base/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/execution_base/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/execution_base/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/executors/include_compatibility/hpx/execution/executors.hpp"
+  "libs/core/executors/include_compatibility/hpx/execution/execution_policy_fwd.hpp"
+  "libs/core/executors/include_compatibility/hpx/execution/execution_policy.hpp"
+  "libs/core/executors/include_compatibility/hpx/execution/executors/current_executor.hpp"
+  "libs/core/executors/include_compatibility/hpx/execution/executors/guided_pool_executor.hpp"
+  "libs/core/executors/include_compatibility/hpx/execution/executors/limiting_executor.hpp"
+  "libs/core/executors/include_compatibility/hpx/execution/executors/parallel_executor.hpp"
+  "libs/core/executors/include_compatibility/hpx/execution/executors/parallel_executor_aggregated.hpp"
+  "libs/core/executors/include_compatibility/hpx/execution/executors/restricted_thread_pool_executor.hpp"
+  "libs/core/executors/include_compatibility/hpx/execution/executors/sequenced_executor.hpp"
+  "libs/core/executors/include_compatibility/hpx/parallel/executors.hpp"
+  "libs/core/executors/include_compatibility/hpx/parallel/exception_list.hpp"
+  "libs/core/executors/include_compatibility/hpx/parallel/execution_policy_fwd.hpp"
+  "libs/core/executors/include_compatibility/hpx/parallel/execution_policy.hpp"
+  "libs/core/executors/include_compatibility/hpx/parallel/executors/parallel_executor.hpp"
+  "libs/core/executors/include_compatibility/hpx/parallel/executors/parallel_executor_aggregated.hpp"
+  "libs/core/executors/include_compatibility/hpx/parallel/executors/sequenced_executor.hpp"
+  "libs/core/executors/include_compatibility/hpx/parallel/executors/thread_pool_executor.hpp"
+  "libs/core/executors/include_compatibility/hpx/execution/datapar/execution_policy_fwd.hpp"
+  "libs/core/executors/include_compatibility/hpx/execution/datapar/execution_policy.hpp"
+  "libs/core/executors/include_compatibility/hpx/parallel/datapar/execution_policy_fwd.hpp"
+  "libs/core/executors/include_compatibility/hpx/parallel/datapar/execution_policy.hpp"
+  "libs/core/executors/include/hpx/modules/executors.hpp"
+  "libs/core/executors/include/hpx/executors/config/defines.hpp"
+  "libs/core/executors/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/executors/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/executors/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/filesystem/include_compatibility/hpx/filesystem.hpp"
+  "libs/core/filesystem/include/hpx/filesystem/config/defines.hpp"
+  "libs/core/filesystem/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/filesystem/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/filesystem/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/filesystem/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/format/include_compatibility/hpx/util/format.hpp"
+  "libs/core/format/include/hpx/format/config/defines.hpp"
+  "libs/core/format/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/format/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/format/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/format/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/functional/include_compatibility/hpx/util/bind.hpp"
+  "libs/core/functional/include_compatibility/hpx/util/bind_back.hpp"
+  "libs/core/functional/include_compatibility/hpx/util/bind_front.hpp"
+  "libs/core/functional/include_compatibility/hpx/util/deferred_call.hpp"
+  "libs/core/functional/include_compatibility/hpx/util/first_argument.hpp"
+  "libs/core/functional/include_compatibility/hpx/util/function.hpp"
+  "libs/core/functional/include_compatibility/hpx/util/function_ref.hpp"
+  "libs/core/functional/include_compatibility/hpx/util/invoke.hpp"
+  "libs/core/functional/include_compatibility/hpx/util/invoke_fused.hpp"
+  "libs/core/functional/include_compatibility/hpx/util/mem_fn.hpp"
+  "libs/core/functional/include_compatibility/hpx/util/one_shot.hpp"
+  "libs/core/functional/include_compatibility/hpx/util/protect.hpp"
+  "libs/core/functional/include_compatibility/hpx/util/result_of.hpp"
+  "libs/core/functional/include_compatibility/hpx/util/serializable_function.hpp"
+  "libs/core/functional/include_compatibility/hpx/util/serializable_unique_function.hpp"
+  "libs/core/functional/include_compatibility/hpx/util/unique_function.hpp"
+  "libs/core/functional/include/hpx/modules/functional.hpp"
+  "libs/core/functional/include/hpx/functional/config/defines.hpp"
+  "libs/core/functional/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/functional/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/functional/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/futures/include_compatibility/hpx/lcos/future.hpp"
+  "libs/core/futures/include_compatibility/hpx/lcos/local/futures_factory.hpp"
+  "libs/core/futures/include_compatibility/hpx/lcos/local/packaged_task.hpp"
+  "libs/core/futures/include_compatibility/hpx/lcos/local/packaged_continuation.hpp"
+  "libs/core/futures/include_compatibility/hpx/lcos/local/promise.hpp"
+  "libs/core/futures/include_compatibility/hpx/traits/acquire_future.hpp"
+  "libs/core/futures/include_compatibility/hpx/traits/acquire_shared_state.hpp"
+  "libs/core/futures/include_compatibility/hpx/traits/future_access.hpp"
+  "libs/core/futures/include_compatibility/hpx/traits/future_then_result.hpp"
+  "libs/core/futures/include_compatibility/hpx/traits/future_traits.hpp"
+  "libs/core/futures/include_compatibility/hpx/traits/get_remote_result.hpp"
+  "libs/core/futures/include_compatibility/hpx/traits/is_future.hpp"
+  "libs/core/futures/include_compatibility/hpx/traits/is_future_range.hpp"
+  "libs/core/futures/include_compatibility/hpx/traits/is_future_tuple.hpp"
+  "libs/core/futures/include_compatibility/hpx/traits/promise_local_result.hpp"
+  "libs/core/futures/include_compatibility/hpx/traits/promise_remote_result.hpp"
+  "libs/core/futures/include/hpx/modules/futures.hpp"
+  "libs/core/futures/include/hpx/futures/config/defines.hpp"
+  "libs/core/futures/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/futures/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/futures/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/futures/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/hardware/include_compatibility/hpx/util/hardware/timestamp/bgq.hpp"
+  "libs/core/hardware/include_compatibility/hpx/util/hardware/timestamp/linux_generic.hpp"
+  "libs/core/hardware/include_compatibility/hpx/util/hardware/timestamp/linux_x86_32.hpp"
+  "libs/core/hardware/include_compatibility/hpx/util/hardware/timestamp/linux_x86_64.hpp"
+  "libs/core/hardware/include_compatibility/hpx/util/hardware/timestamp/msvc.hpp"
+  "libs/core/hardware/include_compatibility/hpx/util/hardware/timestamp.hpp"
+  "libs/core/hardware/include/hpx/modules/hardware.hpp"
+  "libs/core/hardware/include/hpx/hardware/config/defines.hpp"
+  "libs/core/hardware/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/hardware/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/hardware/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/hardware/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/hashing/include_compatibility/hpx/hashing.hpp"
+  "libs/core/hashing/include_compatibility/hpx/util/fibhash.hpp"
+  "libs/core/hashing/include_compatibility/hpx/util/jenkins_hash.hpp"
+  "libs/core/hashing/include/hpx/modules/hashing.hpp"
+  "libs/core/hashing/include/hpx/hashing/config/defines.hpp"
+  "libs/core/hashing/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/hashing/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/hashing/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/hashing/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/include_local/include/hpx/include_local/config/defines.hpp"
+  "libs/core/include_local/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/include_local/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/include_local/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/include_local/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/ini/include/hpx/modules/ini.hpp"
+  "libs/core/ini/include/hpx/ini/config/defines.hpp"
+  "libs/core/ini/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/ini/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/ini/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/ini/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/init_runtime_local/include/hpx/modules/init_runtime_local.hpp"
+  "libs/core/init_runtime_local/include/hpx/init_runtime_local/config/defines.hpp"
+  "libs/core/init_runtime_local/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/init_runtime_local/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/init_runtime_local/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/init_runtime_local/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/io_service/include_compatibility/hpx/util/io_service_pool.hpp"
+  "libs/core/io_service/include/hpx/modules/io_service.hpp"
+  "libs/core/io_service/include/hpx/io_service/config/defines.hpp"
+  "libs/core/io_service/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/io_service/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/io_service/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/io_service/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/iterator_support/include_compatibility/hpx/iterator_support.hpp"
+  "libs/core/iterator_support/include_compatibility/hpx/traits/is_iterator.hpp"
+  "libs/core/iterator_support/include_compatibility/hpx/traits/is_range.hpp"
+  "libs/core/iterator_support/include_compatibility/hpx/util/iterator_adaptor.hpp"
+  "libs/core/iterator_support/include_compatibility/hpx/util/iterator_facade.hpp"
+  "libs/core/iterator_support/include_compatibility/hpx/util/iterator_range.hpp"
+  "libs/core/iterator_support/include_compatibility/hpx/util/range.hpp"
+  "libs/core/iterator_support/include_compatibility/hpx/util/transform_iterator.hpp"
+  "libs/core/iterator_support/include/hpx/modules/iterator_support.hpp"
+  "libs/core/iterator_support/include/hpx/iterator_support/config/defines.hpp"
+  "libs/core/iterator_support/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/iterator_support/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/iterator_support/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/iterator_support/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/itt_notify/include_compatibility/hpx/util/itt_notify.hpp"
+  "libs/core/itt_notify/include/hpx/itt_notify/config/defines.hpp"
+  "libs/core/itt_notify/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/itt_notify/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/itt_notify/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/itt_notify/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/lci_base/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/lcos_local/include_compatibility/hpx/local_lcos.hpp"
+  "libs/core/lcos_local/include_compatibility/hpx/lcos/local/and_gate.hpp"
+  "libs/core/lcos_local/include_compatibility/hpx/lcos/local/channel.hpp"
+  "libs/core/lcos_local/include_compatibility/hpx/lcos/local/composable_guard.hpp"
+  "libs/core/lcos_local/include_compatibility/hpx/lcos/local/conditional_trigger.hpp"
+  "libs/core/lcos_local/include_compatibility/hpx/lcos/local/receive_buffer.hpp"
+  "libs/core/lcos_local/include_compatibility/hpx/lcos/local/spmd_block.hpp"
+  "libs/core/lcos_local/include_compatibility/hpx/lcos/local/trigger.hpp"
+  "libs/core/lcos_local/include_compatibility/hpx/local_lcos/and_gate.hpp"
+  "libs/core/lcos_local/include_compatibility/hpx/local_lcos/channel.hpp"
+  "libs/core/lcos_local/include_compatibility/hpx/local_lcos/composable_guard.hpp"
+  "libs/core/lcos_local/include_compatibility/hpx/local_lcos/conditional_trigger.hpp"
+  "libs/core/lcos_local/include_compatibility/hpx/local_lcos/receive_buffer.hpp"
+  "libs/core/lcos_local/include_compatibility/hpx/local_lcos/spmd_block.hpp"
+  "libs/core/lcos_local/include_compatibility/hpx/local_lcos/trigger.hpp"
+  "libs/core/lcos_local/include/hpx/modules/lcos_local.hpp"
+  "libs/core/lcos_local/include/hpx/lcos_local/config/defines.hpp"
+  "libs/core/lcos_local/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/lcos_local/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/lcos_local/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/lcos_local/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/lock_registration/include/hpx/modules/lock_registration.hpp"
+  "libs/core/lock_registration/include/hpx/lock_registration/config/defines.hpp"
+  "libs/core/lock_registration/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/lock_registration/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/lock_registration/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/lock_registration/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/logging/include_compatibility/hpx/logging.hpp"
+  "libs/core/logging/include_compatibility/hpx/util/logging.hpp"
+  "libs/core/logging/include_compatibility/hpx/util/logging/writer/format_write.hpp"
+  "libs/core/logging/include_compatibility/hpx/util/logging/writer/named_write.hpp"
+  "libs/core/logging/include_compatibility/hpx/util/logging/logging.hpp"
+  "libs/core/logging/include_compatibility/hpx/util/logging/format/formatter/high_precision_time.hpp"
+  "libs/core/logging/include_compatibility/hpx/util/logging/format/formatter/defaults.hpp"
+  "libs/core/logging/include_compatibility/hpx/util/logging/format/formatter/thread_id.hpp"
+  "libs/core/logging/include_compatibility/hpx/util/logging/format/named_write.hpp"
+  "libs/core/logging/include_compatibility/hpx/util/logging/format/destination/defaults.hpp"
+  "libs/core/logging/include_compatibility/hpx/util/logging/format/destination/file.hpp"
+  "libs/core/logging/include_compatibility/hpx/util/logging/format/optimize.hpp"
+  "libs/core/logging/include/hpx/logging/config/defines.hpp"
+  "libs/core/logging/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/logging/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/logging/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/logging/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/memory/include_compatibility/hpx/runtime/serialization/intrusive_ptr.hpp"
+  "libs/core/memory/include/hpx/modules/memory.hpp"
+  "libs/core/memory/include/hpx/memory/config/defines.hpp"
+  "libs/core/memory/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/memory/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/memory/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/memory/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/mpi_base/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/pack_traversal/include_compatibility/hpx/traits/pack_traversal_rebind_container.hpp"
+  "libs/core/pack_traversal/include_compatibility/hpx/util/pack_traversal.hpp"
+  "libs/core/pack_traversal/include_compatibility/hpx/util/pack_traversal_async.hpp"
+  "libs/core/pack_traversal/include_compatibility/hpx/util/unwrap.hpp"
+  "libs/core/pack_traversal/include/hpx/modules/pack_traversal.hpp"
+  "libs/core/pack_traversal/include/hpx/pack_traversal/config/defines.hpp"
+  "libs/core/pack_traversal/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/pack_traversal/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/pack_traversal/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/pack_traversal/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/plugin/include_compatibility/hpx/plugin.hpp"
+  "libs/core/plugin/include_compatibility/hpx/util/plugin.hpp"
+  "libs/core/plugin/include_compatibility/hpx/util/plugin/abstract_factory.hpp"
+  "libs/core/plugin/include_compatibility/hpx/util/plugin/concrete_factory.hpp"
+  "libs/core/plugin/include_compatibility/hpx/util/plugin/config.hpp"
+  "libs/core/plugin/include_compatibility/hpx/util/plugin/dll.hpp"
+  "libs/core/plugin/include_compatibility/hpx/util/plugin/export_plugin.hpp"
+  "libs/core/plugin/include_compatibility/hpx/util/plugin/plugin_factory.hpp"
+  "libs/core/plugin/include_compatibility/hpx/util/plugin/plugin_wrapper.hpp"
+  "libs/core/plugin/include_compatibility/hpx/util/plugin/virtual_constructor.hpp"
+  "libs/core/plugin/include_compatibility/hpx/traits/plugin_config_data.hpp"
+  "libs/core/plugin/include/hpx/plugin/config/defines.hpp"
+  "libs/core/plugin/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/plugin/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/plugin/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/prefix/include_compatibility/hpx/util/find_prefix.hpp"
+  "libs/core/prefix/include/hpx/modules/prefix.hpp"
+  "libs/core/prefix/include/hpx/prefix/config/defines.hpp"
+  "libs/core/prefix/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/prefix/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/prefix/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/preprocessor/include_compatibility/hpx/preprocessor.hpp"
+  "libs/core/preprocessor/include/hpx/modules/preprocessor.hpp"
+  "libs/core/preprocessor/include/hpx/preprocessor/config/defines.hpp"
+  "libs/core/preprocessor/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/preprocessor/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/preprocessor/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/program_options/include/hpx/program_options/config/defines.hpp"
+  "libs/core/program_options/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/program_options/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/program_options/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/program_options/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/properties/include/hpx/modules/properties.hpp"
+  "libs/core/properties/include/hpx/properties/config/defines.hpp"
+  "libs/core/properties/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/properties/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/properties/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/properties/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/resiliency/include/hpx/modules/resiliency.hpp"
+  "libs/core/resiliency/include/hpx/resiliency/config/defines.hpp"
+  "libs/core/resiliency/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/resiliency/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/resiliency/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/resiliency/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/resource_partitioner/include_compatibility/hpx/resource_partitioner.hpp"
+  "libs/core/resource_partitioner/include_compatibility/hpx/runtime/resource/partitioner.hpp"
+  "libs/core/resource_partitioner/include_compatibility/hpx/runtime/resource/partitioner_fwd.hpp"
+  "libs/core/resource_partitioner/include/hpx/modules/resource_partitioner.hpp"
+  "libs/core/resource_partitioner/include/hpx/resource_partitioner/config/defines.hpp"
+  "libs/core/resource_partitioner/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/resource_partitioner/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/resource_partitioner/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/resource_partitioner/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/runtime_configuration/include_compatibility/hpx/util/ini.hpp"
+  "libs/core/runtime_configuration/include_compatibility/hpx/util/init_ini_data.hpp"
+  "libs/core/runtime_configuration/include_compatibility/hpx/util/runtime_configuration.hpp"
+  "libs/core/runtime_configuration/include_compatibility/hpx/plugins/plugin_registry_base.hpp"
+  "libs/core/runtime_configuration/include_compatibility/hpx/runtime/components/component_commandline_base.hpp"
+  "libs/core/runtime_configuration/include_compatibility/hpx/runtime/components/component_factory_base.hpp"
+  "libs/core/runtime_configuration/include_compatibility/hpx/runtime/components/component_registry_base.hpp"
+  "libs/core/runtime_configuration/include_compatibility/hpx/runtime/components/static_factory_data.hpp"
+  "libs/core/runtime_configuration/include_compatibility/hpx/runtime/runtime_mode.hpp"
+  "libs/core/runtime_configuration/include/hpx/modules/runtime_configuration.hpp"
+  "libs/core/runtime_configuration/include/hpx/runtime_configuration/config/defines.hpp"
+  "libs/core/runtime_configuration/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/runtime_configuration/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/runtime_configuration/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/runtime_configuration/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/runtime_local/include_compatibility/hpx/custom_exception_info.hpp"
+  "libs/core/runtime_local/include_compatibility/hpx/parallel/executors/service_executors.hpp"
+  "libs/core/runtime_local/include_compatibility/hpx/runtime/components/component_startup_shutdown_base.hpp"
+  "libs/core/runtime_local/include_compatibility/hpx/runtime/config_entry.hpp"
+  "libs/core/runtime_local/include_compatibility/hpx/runtime/get_locality_id.hpp"
+  "libs/core/runtime_local/include_compatibility/hpx/runtime/get_num_localities.hpp"
+  "libs/core/runtime_local/include_compatibility/hpx/runtime/get_os_thread_count.hpp"
+  "libs/core/runtime_local/include_compatibility/hpx/runtime/get_thread_name.hpp"
+  "libs/core/runtime_local/include_compatibility/hpx/runtime/get_worker_thread_num.hpp"
+  "libs/core/runtime_local/include_compatibility/hpx/runtime/report_error.hpp"
+  "libs/core/runtime_local/include_compatibility/hpx/runtime/shutdown_function.hpp"
+  "libs/core/runtime_local/include_compatibility/hpx/runtime/startup_function.hpp"
+  "libs/core/runtime_local/include_compatibility/hpx/runtime/thread_hooks.hpp"
+  "libs/core/runtime_local/include_compatibility/hpx/runtime/thread_pool_helpers.hpp"
+  "libs/core/runtime_local/include_compatibility/hpx/runtime/threads/executors/service_executors.hpp"
+  "libs/core/runtime_local/include_compatibility/hpx/runtime/threads/run_as_hpx_thread.hpp"
+  "libs/core/runtime_local/include_compatibility/hpx/runtime/threads/run_as_os_thread.hpp"
+  "libs/core/runtime_local/include_compatibility/hpx/runtime_handlers.hpp"
+  "libs/core/runtime_local/include_compatibility/hpx/util/pool_timer.hpp"
+  "libs/core/runtime_local/include_compatibility/hpx/util/debug/thread_stacktrace.hpp"
+  "libs/core/runtime_local/include_compatibility/hpx/util/debugging.hpp"
+  "libs/core/runtime_local/include_compatibility/hpx/util/interval_timer.hpp"
+  "libs/core/runtime_local/include_compatibility/hpx/util/thread_mapper.hpp"
+  "libs/core/runtime_local/include/hpx/modules/runtime_local.hpp"
+  "libs/core/runtime_local/include/hpx/runtime_local/config/defines.hpp"
+  "libs/core/runtime_local/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/runtime_local/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/runtime_local/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/runtime_local/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/schedulers/include_compatibility/hpx/runtime/threads/policies/deadlock_detection.hpp"
+  "libs/core/schedulers/include_compatibility/hpx/runtime/threads/policies/local_priority_queue_scheduler.hpp"
+  "libs/core/schedulers/include_compatibility/hpx/runtime/threads/policies/local_queue_scheduler.hpp"
+  "libs/core/schedulers/include_compatibility/hpx/runtime/threads/policies/lockfree_queue_backends.hpp"
+  "libs/core/schedulers/include_compatibility/hpx/runtime/threads/policies/maintain_queue_wait_times.hpp"
+  "libs/core/schedulers/include_compatibility/hpx/runtime/threads/policies/queue_helpers.hpp"
+  "libs/core/schedulers/include_compatibility/hpx/runtime/threads/policies/shared_priority_queue_scheduler.hpp"
+  "libs/core/schedulers/include_compatibility/hpx/runtime/threads/policies/static_priority_queue_scheduler.hpp"
+  "libs/core/schedulers/include_compatibility/hpx/runtime/threads/policies/static_queue_scheduler.hpp"
+  "libs/core/schedulers/include_compatibility/hpx/runtime/threads/policies/thread_queue.hpp"
+  "libs/core/schedulers/include_compatibility/hpx/runtime/threads/policies/thread_queue_mc.hpp"
+  "libs/core/schedulers/include_compatibility/hpx/runtime/threads/policies/schedulers.hpp"
+  "libs/core/schedulers/include/hpx/schedulers/config/defines.hpp"
+  "libs/core/schedulers/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/schedulers/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/schedulers/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/schedulers/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/serialization/include_compatibility/hpx/runtime/serialization/array.hpp"
+  "libs/core/serialization/include_compatibility/hpx/runtime/serialization/bitset.hpp"
+  "libs/core/serialization/include_compatibility/hpx/runtime/serialization/complex.hpp"
+  "libs/core/serialization/include_compatibility/hpx/runtime/serialization/container.hpp"
+  "libs/core/serialization/include_compatibility/hpx/runtime/serialization/datapar.hpp"
+  "libs/core/serialization/include_compatibility/hpx/runtime/serialization/deque.hpp"
+  "libs/core/serialization/include_compatibility/hpx/runtime/serialization/list.hpp"
+  "libs/core/serialization/include_compatibility/hpx/runtime/serialization/map.hpp"
+  "libs/core/serialization/include_compatibility/hpx/runtime/serialization/multi_array.hpp"
+  "libs/core/serialization/include_compatibility/hpx/runtime/serialization/serialize_buffer.hpp"
+  "libs/core/serialization/include_compatibility/hpx/runtime/serialization/set.hpp"
+  "libs/core/serialization/include_compatibility/hpx/runtime/serialization/string.hpp"
+  "libs/core/serialization/include_compatibility/hpx/runtime/serialization/vector.hpp"
+  "libs/core/serialization/include_compatibility/hpx/runtime/serialization/variant.hpp"
+  "libs/core/serialization/include_compatibility/hpx/runtime/serialization/valarray.hpp"
+  "libs/core/serialization/include_compatibility/hpx/runtime/serialization/shared_ptr.hpp"
+  "libs/core/serialization/include_compatibility/hpx/runtime/serialization/unique_ptr.hpp"
+  "libs/core/serialization/include_compatibility/hpx/runtime/serialization/unordered_map.hpp"
+  "libs/core/serialization/include_compatibility/hpx/runtime/serialization/access.hpp"
+  "libs/core/serialization/include_compatibility/hpx/runtime/serialization/base_object.hpp"
+  "libs/core/serialization/include_compatibility/hpx/runtime/serialization/basic_archive.hpp"
+  "libs/core/serialization/include_compatibility/hpx/runtime/serialization/binary_filter.hpp"
+  "libs/core/serialization/include_compatibility/hpx/runtime/serialization/brace_initializable.hpp"
+  "libs/core/serialization/include_compatibility/hpx/runtime/serialization/brace_initializable_fwd.hpp"
+  "libs/core/serialization/include_compatibility/hpx/runtime/serialization/input_archive.hpp"
+  "libs/core/serialization/include_compatibility/hpx/runtime/serialization/input_container.hpp"
+  "libs/core/serialization/include_compatibility/hpx/runtime/serialization/output_archive.hpp"
+  "libs/core/serialization/include_compatibility/hpx/runtime/serialization/output_container.hpp"
+  "libs/core/serialization/include_compatibility/hpx/runtime/serialization/serialization_chunk.hpp"
+  "libs/core/serialization/include_compatibility/hpx/runtime/serialization/serialization_fwd.hpp"
+  "libs/core/serialization/include_compatibility/hpx/runtime/serialization/serialize.hpp"
+  "libs/core/serialization/include_compatibility/hpx/traits/brace_initializable_traits.hpp"
+  "libs/core/serialization/include_compatibility/hpx/traits/is_bitwise_serializable.hpp"
+  "libs/core/serialization/include_compatibility/hpx/traits/needs_automatic_registration.hpp"
+  "libs/core/serialization/include_compatibility/hpx/traits/polymorphic_traits.hpp"
+  "libs/core/serialization/include_compatibility/hpx/traits/serialization_access_data.hpp"
+  "libs/core/serialization/include/hpx/modules/serialization.hpp"
+  "libs/core/serialization/include/hpx/serialization/config/defines.hpp"
+  "libs/core/serialization/src/config_entries.cpp"
+  "libs/core/serialization/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/serialization/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/serialization/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/serialization/tests/unit/polymorphic/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/static_reinit/include_compatibility/hpx/util/reinitializable_static.hpp"
+  "libs/core/static_reinit/include_compatibility/hpx/util/static_reinit.hpp"
+  "libs/core/static_reinit/include/hpx/modules/static_reinit.hpp"
+  "libs/core/static_reinit/include/hpx/static_reinit/config/defines.hpp"
+  "libs/core/static_reinit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/static_reinit/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/static_reinit/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/static_reinit/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/string_util/include/hpx/modules/string_util.hpp"
+  "libs/core/string_util/include/hpx/string_util/config/defines.hpp"
+  "libs/core/string_util/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/string_util/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/string_util/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/string_util/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/synchronization/include_compatibility/hpx/lcos/local/barrier.hpp"
+  "libs/core/synchronization/include_compatibility/hpx/lcos/local/condition_variable.hpp"
+  "libs/core/synchronization/include_compatibility/hpx/lcos/local/counting_semaphore.hpp"
+  "libs/core/synchronization/include_compatibility/hpx/lcos/local/event.hpp"
+  "libs/core/synchronization/include_compatibility/hpx/lcos/local/latch.hpp"
+  "libs/core/synchronization/include_compatibility/hpx/lcos/local/mutex.hpp"
+  "libs/core/synchronization/include_compatibility/hpx/lcos/local/no_mutex.hpp"
+  "libs/core/synchronization/include_compatibility/hpx/lcos/local/once.hpp"
+  "libs/core/synchronization/include_compatibility/hpx/lcos/local/recursive_mutex.hpp"
+  "libs/core/synchronization/include_compatibility/hpx/lcos/local/shared_mutex.hpp"
+  "libs/core/synchronization/include_compatibility/hpx/lcos/local/sliding_semaphore.hpp"
+  "libs/core/synchronization/include_compatibility/hpx/lcos/local/spinlock.hpp"
+  "libs/core/synchronization/include_compatibility/hpx/lcos/local/spinlock_no_backoff.hpp"
+  "libs/core/synchronization/include_compatibility/hpx/lcos/local/spinlock_pool.hpp"
+  "libs/core/synchronization/include_compatibility/hpx/synchronization.hpp"
+  "libs/core/synchronization/include/hpx/modules/synchronization.hpp"
+  "libs/core/synchronization/include/hpx/synchronization/config/defines.hpp"
+  "libs/core/synchronization/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/synchronization/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/synchronization/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/synchronization/tests/unit/shared_mutex/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/tag_invoke/include_compatibility/hpx/functional/result_of.hpp"
+  "libs/core/tag_invoke/include_compatibility/hpx/functional/traits/is_callable.hpp"
+  "libs/core/tag_invoke/include/hpx/modules/tag_invoke.hpp"
+  "libs/core/tag_invoke/include/hpx/tag_invoke/config/defines.hpp"
+  "libs/core/tag_invoke/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/tag_invoke/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/tag_invoke/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/tag_invoke/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/testing/include_compatibility/hpx/testing.hpp"
+  "libs/core/testing/include_compatibility/hpx/util/lightweight_test.hpp"
+  "libs/core/testing/include/hpx/testing/config/defines.hpp"
+  "libs/core/testing/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/testing/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/testing/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/testing/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/thread_pool_util/include/hpx/modules/thread_pool_util.hpp"
+  "libs/core/thread_pool_util/include/hpx/thread_pool_util/config/defines.hpp"
+  "libs/core/thread_pool_util/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/thread_pool_util/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/thread_pool_util/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/thread_pool_util/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/thread_pools/include_compatibility/hpx/runtime/threads/thread_pools.hpp"
+  "libs/core/thread_pools/include_compatibility/hpx/runtime/threads/scoped_background_timer.hpp"
+  "libs/core/thread_pools/include/hpx/modules/thread_pools.hpp"
+  "libs/core/thread_pools/include/hpx/thread_pools/config/defines.hpp"
+  "libs/core/thread_pools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/thread_pools/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/thread_pools/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/thread_pools/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/thread_support/include_compatibility/hpx/thread_support.hpp"
+  "libs/core/thread_support/include_compatibility/hpx/util/assert_owns_lock.hpp"
+  "libs/core/thread_support/include_compatibility/hpx/util/atomic_count.hpp"
+  "libs/core/thread_support/include_compatibility/hpx/util/set_thread_name."
+  "libs/core/thread_support/include_compatibility/hpx/util/thread_specific_ptr.hpp"
+  "libs/core/thread_support/include_compatibility/hpx/util/unlock_guard.hpp"
+  "libs/core/thread_support/include/hpx/modules/thread_support.hpp"
+  "libs/core/thread_support/include/hpx/thread_support/config/defines.hpp"
+  "libs/core/thread_support/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/thread_support/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/thread_support/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/thread_support/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/threading/include_compatibility/hpx/runtime/threads/thread.hpp"
+  "libs/core/threading/include/hpx/modules/threading.hpp"
+  "libs/core/threading/include/hpx/threading/config/defines.hpp"
+  "libs/core/threading/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/threading/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/threading/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/threading_base/include_compatibility/hpx/runtime/threads/execution_agent.hpp"
+  "libs/core/threading_base/include_compatibility/hpx/runtime/threads/policies/callback_notifier.hpp"
+  "libs/core/threading_base/include_compatibility/hpx/runtime/threads/policies/scheduler_base.hpp"
+  "libs/core/threading_base/include_compatibility/hpx/runtime/threads/policies/scheduler_mode.hpp"
+  "libs/core/threading_base/include_compatibility/hpx/runtime/threads/policies/thread_queue_init_parameters.hpp"
+  "libs/core/threading_base/include_compatibility/hpx/runtime/threads/register_thread.hpp"
+  "libs/core/threading_base/include_compatibility/hpx/runtime/threads/thread_data.hpp"
+  "libs/core/threading_base/include_compatibility/hpx/runtime/threads/thread_data_stackful.hpp"
+  "libs/core/threading_base/include_compatibility/hpx/runtime/threads/thread_data_stackless.hpp"
+  "libs/core/threading_base/include_compatibility/hpx/runtime/threads/thread_helpers.hpp"
+  "libs/core/threading_base/include_compatibility/hpx/runtime/threads/thread_init_data.hpp"
+  "libs/core/threading_base/include_compatibility/hpx/runtime/threads/thread_pool_base.hpp"
+  "libs/core/threading_base/include_compatibility/hpx/runtime/threads/thread_specific_ptr.hpp"
+  "libs/core/threading_base/include_compatibility/hpx/util/annotated_function.hpp"
+  "libs/core/threading_base/include_compatibility/hpx/util/external_timer.hpp"
+  "libs/core/threading_base/include_compatibility/hpx/util/thread_description.hpp"
+  "libs/core/threading_base/include/hpx/modules/threading_base.hpp"
+  "libs/core/threading_base/include/hpx/threading_base/config/defines.hpp"
+  "libs/core/threading_base/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/threading_base/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/threading_base/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/threading_base/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/threadmanager/include_compatibility/hpx/threadmanager.hpp"
+  "libs/core/threadmanager/include_compatibility/hpx/runtime/threads/threadmanager.hpp"
+  "libs/core/threadmanager/include/hpx/threadmanager/config/defines.hpp"
+  "libs/core/threadmanager/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/threadmanager/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/threadmanager/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/threadmanager/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/timed_execution/include_compatibility/hpx/parallel/executors/timed_execution.hpp"
+  "libs/core/timed_execution/include_compatibility/hpx/parallel/executors/timed_execution_fwd.hpp"
+  "libs/core/timed_execution/include_compatibility/hpx/parallel/executors/timed_executors.hpp"
+  "libs/core/timed_execution/include_compatibility/hpx/traits/is_timed_executor.hpp"
+  "libs/core/timed_execution/include/hpx/modules/timed_execution.hpp"
+  "libs/core/timed_execution/include/hpx/timed_execution/config/defines.hpp"
+  "libs/core/timed_execution/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/timed_execution/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/timed_execution/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/timed_execution/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/timing/include_compatibility/hpx/timing.hpp"
+  "libs/core/timing/include_compatibility/hpx/util/high_resolution_clock.hpp"
+  "libs/core/timing/include_compatibility/hpx/util/high_resolution_timer.hpp"
+  "libs/core/timing/include_compatibility/hpx/util/scoped_timer.hpp"
+  "libs/core/timing/include_compatibility/hpx/util/steady_clock.hpp"
+  "libs/core/timing/include_compatibility/hpx/util/tick_counter.hpp"
+  "libs/core/timing/include/hpx/modules/timing.hpp"
+  "libs/core/timing/include/hpx/timing/config/defines.hpp"
+  "libs/core/timing/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/timing/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/timing/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/timing/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/topology/include_compatibility/hpx/topology.hpp"
+  "libs/core/topology/include_compatibility/hpx/runtime/threads/cpu_mask.hpp"
+  "libs/core/topology/include_compatibility/hpx/runtime/threads/topology.hpp"
+  "libs/core/topology/include_compatibility/hpx/util/cache_aligned_data.hpp"
+  "libs/core/topology/include/hpx/modules/topology.hpp"
+  "libs/core/topology/include/hpx/topology/config/defines.hpp"
+  "libs/core/topology/src/config_entries.cpp"
+  "libs/core/topology/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/topology/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/topology/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/topology/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/type_support/include_compatibility/hpx/type_support.hpp"
+  "libs/core/type_support/include_compatibility/hpx/util/always_void.hpp"
+  "libs/core/type_support/include_compatibility/hpx/util/decay.hpp"
+  "libs/core/type_support/include_compatibility/hpx/util/detected.hpp"
+  "libs/core/type_support/include_compatibility/hpx/util/identity.hpp"
+  "libs/core/type_support/include_compatibility/hpx/util/lazy_conditional.hpp"
+  "libs/core/type_support/include_compatibility/hpx/util/lazy_enable_if.hpp"
+  "libs/core/type_support/include_compatibility/hpx/util/static.hpp"
+  "libs/core/type_support/include_compatibility/hpx/util/unwrap_ref.hpp"
+  "libs/core/type_support/include_compatibility/hpx/util/unused.hpp"
+  "libs/core/type_support/include_compatibility/hpx/util/void_guard.hpp"
+  "libs/core/type_support/include/hpx/modules/type_support.hpp"
+  "libs/core/type_support/include/hpx/type_support/config/defines.hpp"
+  "libs/core/type_support/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/type_support/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/type_support/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/type_support/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/util/include_compatibility/hpx/util.hpp"
+  "libs/core/util/include/hpx/modules/util.hpp"
+  "libs/core/util/include/hpx/util/config/defines.hpp"
+  "libs/core/util/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/util/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/util/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/util/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/core/version/include/hpx/version/config/defines.hpp"
+  "libs/core/version/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/actions/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/actions_base/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/agas/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/agas_base/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/async_colocated/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/async_distributed/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/checkpoint/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/checkpoint_base/include/hpx/modules/checkpoint_base.hpp"
+  "libs/full/checkpoint_base/include/hpx/checkpoint_base/config/defines.hpp"
+  "libs/full/checkpoint_base/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/checkpoint_base/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/checkpoint_base/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/collectives/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/command_line_handling/include_compatibility/hpx/util/command_line_handling.hpp"
+  "libs/full/command_line_handling/include_compatibility/hpx/util/parse_command_line.hpp"
+  "libs/full/command_line_handling/include/hpx/modules/command_line_handling.hpp"
+  "libs/full/command_line_handling/include/hpx/command_line_handling/config/defines.hpp"
+  "libs/full/command_line_handling/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/command_line_handling/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/command_line_handling/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/components/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/components_base/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/compute/include_compatibility/hpx/compute.hpp"
+  "libs/full/compute/include_compatibility/hpx/compute/host/target.hpp"
+  "libs/full/compute/include_compatibility/hpx/util/functional/new.hpp"
+  "libs/full/compute/include/hpx/modules/compute.hpp"
+  "libs/full/compute/include/hpx/compute/config/defines.hpp"
+  "libs/full/compute/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/compute/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/compute/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/compute/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/distribution_policies/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/executors_distributed/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/include/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/init_runtime/include/hpx/init_runtime/config/defines.hpp"
+  "libs/full/init_runtime/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/init_runtime/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/init_runtime/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/init_runtime/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/lcos_distributed/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/naming/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/naming_base/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/parcelport_lci/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/parcelport_libfabric/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/parcelport_mpi/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/parcelport_tcp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/parcelset/include_compatibility/hpx/plugins/parcel/coalescing_message_handler_registration.hpp"
+  "libs/full/parcelset/include_compatibility/hpx/runtime/message_handler_fwd.hpp"
+  "libs/full/parcelset/include_compatibility/hpx/runtime/parcelset/connection_cache.hpp"
+  "libs/full/parcelset/include_compatibility/hpx/runtime/parcelset/decode_parcels.hpp"
+  "libs/full/parcelset/include_compatibility/hpx/runtime/parcelset/encode_parcels.hpp"
+  "libs/full/parcelset/include_compatibility/hpx/runtime/parcelset/parcel.hpp"
+  "libs/full/parcelset/include_compatibility/hpx/runtime/parcelset/parcel_buffer.hpp"
+  "libs/full/parcelset/include_compatibility/hpx/runtime/parcelset/parcelport_connection.hpp"
+  "libs/full/parcelset/include_compatibility/hpx/runtime/parcelset/parcelhandler.hpp"
+  "libs/full/parcelset/include_compatibility/hpx/runtime/parcelset/parcelport_impl.hpp"
+  "libs/full/parcelset/include_compatibility/hpx/runtime/parcelset_fwd.hpp"
+  "libs/full/parcelset/include/hpx/modules/parcelset.hpp"
+  "libs/full/parcelset/include/hpx/parcelset/config/defines.hpp"
+  "libs/full/parcelset/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/parcelset/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/parcelset/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/parcelset/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/parcelset_base/include_compatibility/hpx/runtime/parcelset/locality.hpp"
+  "libs/full/parcelset_base/include_compatibility/hpx/runtime/parcelset/parcelport.hpp"
+  "libs/full/parcelset_base/include_compatibility/hpx/runtime/parcelset/policies/message_handler.hpp"
+  "libs/full/parcelset_base/include_compatibility/hpx/runtime/set_parcel_write_handler.hpp"
+  "libs/full/parcelset_base/include_compatibility/hpx/runtime/traits/action_get_embedded_parcel.hpp"
+  "libs/full/parcelset_base/include_compatibility/hpx/runtime/traits/action_serialization_filter.hpp"
+  "libs/full/parcelset_base/include/hpx/modules/parcelset_base.hpp"
+  "libs/full/parcelset_base/include/hpx/parcelset_base/config/defines.hpp"
+  "libs/full/parcelset_base/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/parcelset_base/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/parcelset_base/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/parcelset_base/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/performance_counters/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/plugin_factories/include_compatibility/hpx/plugins/binary_filter_factory.hpp"
+  "libs/full/plugin_factories/include_compatibility/hpx/plugins/binary_filter_factory_base.hpp"
+  "libs/full/plugin_factories/include_compatibility/hpx/plugins/message_handler_factory.hpp"
+  "libs/full/plugin_factories/include_compatibility/hpx/plugins/message_handler_factory_base.hpp"
+  "libs/full/plugin_factories/include_compatibility/hpx/plugins/parcelport_factory.hpp"
+  "libs/full/plugin_factories/include_compatibility/hpx/plugins/parcelport_factory_base.hpp"
+  "libs/full/plugin_factories/include_compatibility/hpx/plugins/plugin_factory_base.hpp"
+  "libs/full/plugin_factories/include_compatibility/hpx/plugins/plugin_registry.hpp"
+  "libs/full/plugin_factories/include_compatibility/hpx/plugins/unique_plugin_name.hpp"
+  "libs/full/plugin_factories/include/hpx/modules/plugin_factories.hpp"
+  "libs/full/plugin_factories/include/hpx/plugin_factories/config/defines.hpp"
+  "libs/full/plugin_factories/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/plugin_factories/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/plugin_factories/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/plugin_factories/tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/resiliency_distributed/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/runtime_components/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/runtime_distributed/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/segmented_algorithms/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/full/statistics/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "init/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "wrap/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "components/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/build/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/tests.dir/DependInfo.cmake"
+  "CMakeFiles/tests.unit.dir/DependInfo.cmake"
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/core.dir/DependInfo.cmake"
+  "libs/CMakeFiles/hpx_full.dir/DependInfo.cmake"
+  "libs/CMakeFiles/tests.unit.modules.dir/DependInfo.cmake"
+  "libs/CMakeFiles/hpx_core.dir/DependInfo.cmake"
+  "libs/core/affinity/CMakeFiles/hpx_affinity.dir/DependInfo.cmake"
+  "libs/core/affinity/tests/CMakeFiles/tests.unit.modules.affinity.dir/DependInfo.cmake"
+  "libs/core/affinity/tests/unit/CMakeFiles/parse_affinity_options_test.dir/DependInfo.cmake"
+  "libs/core/affinity/tests/unit/CMakeFiles/tests.unit.modules.affinity.parse_affinity_options.dir/DependInfo.cmake"
+  "libs/core/algorithms/CMakeFiles/hpx_algorithms.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/CMakeFiles/tests.unit.modules.algorithms.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/CMakeFiles/tests.unit.modules.algorithms.algorithms.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/CMakeFiles/tests.unit.modules.algorithms.block.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.detail.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.util.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/adjacentdifference_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.adjacentdifference.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/adjacentdifference_sender_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.adjacentdifference_sender.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/adjacentfind_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.adjacentfind.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/adjacentfind_binary_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.adjacentfind_binary.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/all_of_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.all_of.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/any_of_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.any_of.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/copy_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.copy.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/copyif_random_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.copyif_random.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/copyif_forward_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.copyif_forward.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/copyif_exception_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.copyif_exception.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/copyif_bad_alloc_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.copyif_bad_alloc.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/copyn_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.copyn.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/count_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.count.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/countif_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.countif.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/destroy_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.destroy.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/destroyn_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.destroyn.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/ends_with_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.ends_with.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/equal_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.equal.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/equal_binary_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.equal_binary.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/exclusive_scan_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.exclusive_scan.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/exclusive_scan2_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.exclusive_scan2.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/exclusive_scan_exception_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.exclusive_scan_exception.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/exclusive_scan_bad_alloc_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.exclusive_scan_bad_alloc.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/exclusive_scan_validate_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.exclusive_scan_validate.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/external_sort_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.external_sort.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/fill_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.fill.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/filln_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.filln.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/find_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.find.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/findend_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.findend.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/findfirstof_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.findfirstof.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/findfirstof_binary_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.findfirstof_binary.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/findif_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.findif.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/findifnot_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.findifnot.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/foreach_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.foreach.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/foreach_executors_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.foreach_executors.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/foreach_prefetching_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.foreach_prefetching.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/foreach_sender_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.foreach_sender.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/foreachn_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.foreachn.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/foreachn_exception_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.foreachn_exception.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/foreachn_bad_alloc_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.foreachn_bad_alloc.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/for_loop_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.for_loop.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/for_loop_exception_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.for_loop_exception.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/for_loop_induction_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.for_loop_induction.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/for_loop_induction_async_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.for_loop_induction_async.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/for_loop_n_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.for_loop_n.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/for_loop_nd_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.for_loop_nd.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/for_loop_n_strided_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.for_loop_n_strided.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/for_loop_reduction_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.for_loop_reduction.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/for_loop_reduction_async_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.for_loop_reduction_async.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/for_loop_sender_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.for_loop_sender.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/for_loop_strided_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.for_loop_strided.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/generate_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.generate.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/group_by_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.group_by.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/generaten_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.generaten.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/is_heap_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.is_heap.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/is_heap_until_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.is_heap_until.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/includes_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.includes.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/inclusive_scan_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.inclusive_scan.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/inplace_merge_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.inplace_merge.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/is_partitioned_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.is_partitioned.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/is_sorted_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.is_sorted.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/is_sorted_until_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.is_sorted_until.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/kway_merge_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.kway_merge.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/lazy_binary_splitting_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.lazy_binary_splitting.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/lexicographical_compare_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.lexicographical_compare.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/make_heap_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.make_heap.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/max_element_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.max_element.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/memory_hints_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.memory_hints.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/merge_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.merge.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/min_element_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.min_element.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/minmax_element_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.minmax_element.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/mismatch_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.mismatch.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/mismatch_binary_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.mismatch_binary.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/move_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.move.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/nth_element_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.nth_element.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/none_of_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.none_of.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/parallel_sort_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.parallel_sort.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/partial_sort_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.partial_sort.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/partial_sort_copy_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.partial_sort_copy.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/partition_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.partition.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/partition_copy_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.partition_copy.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/radix_sort_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.radix_sort.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/reduce__test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.reduce_.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/reduce_by_key_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.reduce_by_key.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/remove_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.remove.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/remove1_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.remove1.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/remove2_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.remove2.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/remove_if_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.remove_if.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/remove_if1_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.remove_if1.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/remove_copy_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.remove_copy.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/remove_copy_if_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.remove_copy_if.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/replace_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.replace.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/replace_if_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.replace_if.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/replace_copy_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.replace_copy.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/replace_copy_if_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.replace_copy_if.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/reverse_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.reverse.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/reverse_copy_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.reverse_copy.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/reverse_sender_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.reverse_sender.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/rotate_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.rotate.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/rotate_copy_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.rotate_copy.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/rotate_sender_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.rotate_sender.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/scan_single_pass_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.scan_single_pass.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/search_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.search.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/searchn_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.searchn.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/set_difference_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.set_difference.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/set_intersection_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.set_intersection.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/set_symmetric_difference_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.set_symmetric_difference.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/set_union_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.set_union.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/shift_left_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.shift_left.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/shift_right_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.shift_right.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/sort_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.sort.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/sort_by_key_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.sort_by_key.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/sort_exceptions_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.sort_exceptions.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/stable_partition_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.stable_partition.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/stable_sort_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.stable_sort.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/stable_sort_exceptions_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.stable_sort_exceptions.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/starts_with_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.starts_with.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/swapranges_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.swapranges.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/transform_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.transform.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/transform_binary_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.transform_binary.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/transform_binary2_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.transform_binary2.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/transform_exclusive_scan_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.transform_exclusive_scan.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/transform_inclusive_scan_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.transform_inclusive_scan.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/transform_reduce_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.transform_reduce.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/transform_reduce_binary_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.transform_reduce_binary.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/transform_reduce_binary_exception_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.transform_reduce_binary_exception.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/transform_reduce_binary_bad_alloc_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.transform_reduce_binary_bad_alloc.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/transpose_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.transpose.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/uninitialized_copy_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.uninitialized_copy.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/uninitialized_copyn_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.uninitialized_copyn.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/uninitialized_default_construct_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.uninitialized_default_construct.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/uninitialized_default_constructn_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.uninitialized_default_constructn.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/uninitialized_fill_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.uninitialized_fill.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/uninitialized_filln_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.uninitialized_filln.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/uninitialized_move_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.uninitialized_move.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/uninitialized_moven_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.uninitialized_moven.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/uninitialized_value_construct_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.uninitialized_value_construct.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/uninitialized_value_constructn_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.uninitialized_value_constructn.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/unique_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.unique.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/unique_copy_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/tests.unit.modules.algorithms.algorithms.unique_copy.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/detail/CMakeFiles/chunk_size_iterator_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/detail/CMakeFiles/tests.unit.modules.algorithms.detail.chunk_size_iterator.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/detail/CMakeFiles/chunk_size_idx_iterator_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/detail/CMakeFiles/tests.unit.modules.algorithms.detail.chunk_size_idx_iterator.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/detail/CMakeFiles/test_insertion_sort_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/detail/CMakeFiles/tests.unit.modules.algorithms.detail.test_insertion_sort.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/detail/CMakeFiles/test_parallel_stable_sort_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/detail/CMakeFiles/tests.unit.modules.algorithms.detail.test_parallel_stable_sort.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/detail/CMakeFiles/test_sample_sort_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/detail/CMakeFiles/tests.unit.modules.algorithms.detail.test_sample_sort.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/detail/CMakeFiles/test_spin_sort_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/detail/CMakeFiles/tests.unit.modules.algorithms.detail.test_spin_sort.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/util/CMakeFiles/test_low_level_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/util/CMakeFiles/tests.unit.modules.algorithms.util.test_low_level.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/util/CMakeFiles/test_merge_four_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/util/CMakeFiles/tests.unit.modules.algorithms.util.test_merge_four.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/util/CMakeFiles/test_merge_vector_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/util/CMakeFiles/tests.unit.modules.algorithms.util.test_merge_vector.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/util/CMakeFiles/test_nbits_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/util/CMakeFiles/tests.unit.modules.algorithms.util.test_nbits.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/util/CMakeFiles/test_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/algorithms/util/CMakeFiles/tests.unit.modules.algorithms.util.test_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/block/CMakeFiles/spmd_block_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/block/CMakeFiles/tests.unit.modules.algorithms.block.spmd_block.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/block/CMakeFiles/task_block_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/block/CMakeFiles/tests.unit.modules.algorithms.block.task_block.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/block/CMakeFiles/task_block_executor_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/block/CMakeFiles/tests.unit.modules.algorithms.block.task_block_executor.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/block/CMakeFiles/task_block_par_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/block/CMakeFiles/tests.unit.modules.algorithms.block.task_block_par.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/block/CMakeFiles/task_group_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/block/CMakeFiles/tests.unit.modules.algorithms.block.task_group.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/adjacentdifference_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.adjacentdifference_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/adjacentdifference_range_sender_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.adjacentdifference_range_sender.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/adjacentfind_bad_alloc_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.adjacentfind_bad_alloc_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/adjacentfind_binary_bad_alloc_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.adjacentfind_binary_bad_alloc_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/adjacentfind_binary_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.adjacentfind_binary_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/adjacentfind_binary_projection_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.adjacentfind_binary_projection_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/adjacentfind_binary_exception_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.adjacentfind_binary_exception_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/adjacentfind_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.adjacentfind_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/adjacentfind_exception_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.adjacentfind_exception_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/all_of_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.all_of_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/any_of_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.any_of_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/copy_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.copy_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/copyn_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.copyn_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/copyif_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.copyif_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/count_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.count_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/countif_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.countif_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/destroy_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.destroy_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/destroyn_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.destroyn_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/distance_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.distance.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/ends_with_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.ends_with_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/equal_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.equal_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/equal_binary_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.equal_binary_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/exclusive_scan_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.exclusive_scan_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/fill_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.fill_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/filln_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.filln_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/find_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.find_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/find_if_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.find_if_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/find_if_not_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.find_if_not_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/find_if_not_exception_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.find_if_not_exception_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/find_end_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.find_end_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/find_end_range2_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.find_end_range2.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/find_first_of_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.find_first_of_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/find_first_of_range2_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.find_first_of_range2.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/for_loop_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.for_loop_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/for_loop_exception_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.for_loop_exception_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/for_loop_induction_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.for_loop_induction_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/for_loop_induction_async_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.for_loop_induction_async_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/for_loop_reduction_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.for_loop_reduction_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/for_loop_reduction_async_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.for_loop_reduction_async_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/for_loop_strided_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.for_loop_strided_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/foreach_adapt_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.foreach_adapt.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/foreach_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.foreach_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/foreach_range_projection_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.foreach_range_projection.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/foreach_range_sender_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.foreach_range_sender.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/generate_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.generate_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/includes_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.includes_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/inclusive_scan_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.inclusive_scan_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/inplace_merge_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.inplace_merge_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/is_heap_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.is_heap_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/is_heap_until_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.is_heap_until_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/is_partitioned_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.is_partitioned_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/is_partitioned_projection_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.is_partitioned_projection_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/is_sorted_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.is_sorted_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/is_sorted_until_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.is_sorted_until_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/lexicographical_compare_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.lexicographical_compare_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/make_heap_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.make_heap_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/max_element_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.max_element_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/merge_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.merge_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/min_element_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.min_element_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/minmax_element_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.minmax_element_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/mismatch_binary_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.mismatch_binary_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/mismatch_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.mismatch_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/move_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.move_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/nth_element_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.nth_element_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/none_of_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.none_of_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/partial_sort_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.partial_sort_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/partial_sort_copy_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.partial_sort_copy_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/partition_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.partition_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/partition_copy_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.partition_copy_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/reduce_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.reduce_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/remove_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.remove_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/remove_if_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.remove_if_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/remove_copy_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.remove_copy_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/remove_copy_if_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.remove_copy_if_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/replace_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.replace_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/replace_copy_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.replace_copy_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/replace_copy_if_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.replace_copy_if_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/replace_if_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.replace_if_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/reverse_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.reverse_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/reverse_copy_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.reverse_copy_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/rotate_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.rotate_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/rotate_copy_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.rotate_copy_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/search_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.search_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/searchn_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.searchn_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/set_difference_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.set_difference_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/set_intersection_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.set_intersection_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/set_symmetric_difference_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.set_symmetric_difference_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/set_union_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.set_union_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/shift_left_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.shift_left_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/shift_right_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.shift_right_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/sort_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.sort_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/stable_partition_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.stable_partition_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/stable_sort_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.stable_sort_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/starts_with_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.starts_with_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/swap_ranges_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.swap_ranges_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/transform_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.transform_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/transform_range_binary_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.transform_range_binary.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/transform_range2_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.transform_range2.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/transform_range_binary2_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.transform_range_binary2.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/transform_exclusive_scan_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.transform_exclusive_scan_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/transform_inclusive_scan_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.transform_inclusive_scan_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/transform_reduce_binary_bad_alloc_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.transform_reduce_binary_bad_alloc_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/transform_reduce_binary_exception_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.transform_reduce_binary_exception_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/transform_reduce_binary_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.transform_reduce_binary_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/transform_reduce_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.transform_reduce_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/uninitialized_copy_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.uninitialized_copy_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/uninitialized_copy_n_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.uninitialized_copy_n_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/uninitialized_default_construct_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.uninitialized_default_construct_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/uninitialized_default_constructn_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.uninitialized_default_constructn_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/uninitialized_fill_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.uninitialized_fill_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/uninitialized_filln_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.uninitialized_filln_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/uninitialized_move_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.uninitialized_move_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/uninitialized_move_n_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.uninitialized_move_n_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/uninitialized_value_construct_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.uninitialized_value_construct_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/uninitialized_value_constructn_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.uninitialized_value_constructn_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/unique_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.unique_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/unique_copy_range_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/container_algorithms/CMakeFiles/tests.unit.modules.algorithms.container_algorithms.unique_copy_range.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/adjacentfind_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.adjacentfind_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/adjacentdifference_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.adjacentdifference_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/all_of_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.all_of_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/any_of_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.any_of_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/copy_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.copy_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/copyif_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.copyif_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/copyn_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.copyn_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/count_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.count_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/countif_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.countif_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/equal_binary_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.equal_binary_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/equal_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.equal_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/fill_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.fill_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/filln_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.filln_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/find_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.find_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/findend_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.findend_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/findfirstof_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.findfirstof_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/findif_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.findif_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/findifnot_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.findifnot_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/foreach_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.foreach_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/foreach_datapar_zipiter_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.foreach_datapar_zipiter.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/foreachn_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.foreachn_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/generate_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.generate_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/generaten_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.generaten_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/inclusive_scan_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.inclusive_scan_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/mismatch_binary_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.mismatch_binary_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/minmax_element_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.minmax_element_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/mismatch_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.mismatch_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/none_of_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.none_of_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/reduce_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.reduce_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/replace_copy_if_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.replace_copy_if_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/replace_copy_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.replace_copy_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/replace_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.replace_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/replace_if_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.replace_if_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/transform_binary_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.transform_binary_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/transform_binary2_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.transform_binary2_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/transform_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.transform_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/transform_reduce_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.transform_reduce_datapar.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/transform_reduce_binary_datapar_test.dir/DependInfo.cmake"
+  "libs/core/algorithms/tests/unit/datapar_algorithms/CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.transform_reduce_binary_datapar.dir/DependInfo.cmake"
+  "libs/core/allocator_support/CMakeFiles/hpx_allocator_support.dir/DependInfo.cmake"
+  "libs/core/allocator_support/tests/CMakeFiles/tests.unit.modules.allocator_support.dir/DependInfo.cmake"
+  "libs/core/asio/CMakeFiles/hpx_asio.dir/DependInfo.cmake"
+  "libs/core/asio/tests/CMakeFiles/tests.unit.modules.asio.dir/DependInfo.cmake"
+  "libs/core/assertion/CMakeFiles/hpx_assertion.dir/DependInfo.cmake"
+  "libs/core/assertion/tests/CMakeFiles/tests.unit.modules.assertion.dir/DependInfo.cmake"
+  "libs/core/assertion/tests/unit/CMakeFiles/assert_fail_test.dir/DependInfo.cmake"
+  "libs/core/assertion/tests/unit/CMakeFiles/tests.unit.modules.assertion.assert_fail.dir/DependInfo.cmake"
+  "libs/core/assertion/tests/unit/CMakeFiles/assert_succeed_test.dir/DependInfo.cmake"
+  "libs/core/assertion/tests/unit/CMakeFiles/tests.unit.modules.assertion.assert_succeed.dir/DependInfo.cmake"
+  "libs/core/async_base/CMakeFiles/hpx_async_base.dir/DependInfo.cmake"
+  "libs/core/async_base/tests/CMakeFiles/tests.unit.modules.async_base.dir/DependInfo.cmake"
+  "libs/core/async_base/tests/unit/CMakeFiles/launch_policy_test.dir/DependInfo.cmake"
+  "libs/core/async_base/tests/unit/CMakeFiles/tests.unit.modules.async_base.launch_policy.dir/DependInfo.cmake"
+  "libs/core/async_combinators/CMakeFiles/hpx_async_combinators.dir/DependInfo.cmake"
+  "libs/core/async_combinators/tests/CMakeFiles/tests.unit.modules.async_combinators.dir/DependInfo.cmake"
+  "libs/core/async_combinators/tests/unit/CMakeFiles/split_shared_future_test.dir/DependInfo.cmake"
+  "libs/core/async_combinators/tests/unit/CMakeFiles/tests.unit.modules.async_combinators.split_shared_future.dir/DependInfo.cmake"
+  "libs/core/async_combinators/tests/unit/CMakeFiles/wait_all_test.dir/DependInfo.cmake"
+  "libs/core/async_combinators/tests/unit/CMakeFiles/tests.unit.modules.async_combinators.wait_all.dir/DependInfo.cmake"
+  "libs/core/async_combinators/tests/unit/CMakeFiles/wait_all_std_array_test.dir/DependInfo.cmake"
+  "libs/core/async_combinators/tests/unit/CMakeFiles/tests.unit.modules.async_combinators.wait_all_std_array.dir/DependInfo.cmake"
+  "libs/core/async_combinators/tests/unit/CMakeFiles/wait_any_test.dir/DependInfo.cmake"
+  "libs/core/async_combinators/tests/unit/CMakeFiles/tests.unit.modules.async_combinators.wait_any.dir/DependInfo.cmake"
+  "libs/core/async_combinators/tests/unit/CMakeFiles/wait_any_std_array_test.dir/DependInfo.cmake"
+  "libs/core/async_combinators/tests/unit/CMakeFiles/tests.unit.modules.async_combinators.wait_any_std_array.dir/DependInfo.cmake"
+  "libs/core/async_combinators/tests/unit/CMakeFiles/wait_each_test.dir/DependInfo.cmake"
+  "libs/core/async_combinators/tests/unit/CMakeFiles/tests.unit.modules.async_combinators.wait_each.dir/DependInfo.cmake"
+  "libs/core/async_combinators/tests/unit/CMakeFiles/wait_some_test.dir/DependInfo.cmake"
+  "libs/core/async_combinators/tests/unit/CMakeFiles/tests.unit.modules.async_combinators.wait_some.dir/DependInfo.cmake"
+  "libs/core/async_combinators/tests/unit/CMakeFiles/wait_some_std_array_test.dir/DependInfo.cmake"
+  "libs/core/async_combinators/tests/unit/CMakeFiles/tests.unit.modules.async_combinators.wait_some_std_array.dir/DependInfo.cmake"
+  "libs/core/async_combinators/tests/unit/CMakeFiles/when_all_test.dir/DependInfo.cmake"
+  "libs/core/async_combinators/tests/unit/CMakeFiles/tests.unit.modules.async_combinators.when_all.dir/DependInfo.cmake"
+  "libs/core/async_combinators/tests/unit/CMakeFiles/when_all_std_array_test.dir/DependInfo.cmake"
+  "libs/core/async_combinators/tests/unit/CMakeFiles/tests.unit.modules.async_combinators.when_all_std_array.dir/DependInfo.cmake"
+  "libs/core/async_combinators/tests/unit/CMakeFiles/when_any_test.dir/DependInfo.cmake"
+  "libs/core/async_combinators/tests/unit/CMakeFiles/tests.unit.modules.async_combinators.when_any.dir/DependInfo.cmake"
+  "libs/core/async_combinators/tests/unit/CMakeFiles/when_any_std_array_test.dir/DependInfo.cmake"
+  "libs/core/async_combinators/tests/unit/CMakeFiles/tests.unit.modules.async_combinators.when_any_std_array.dir/DependInfo.cmake"
+  "libs/core/async_combinators/tests/unit/CMakeFiles/when_each_test.dir/DependInfo.cmake"
+  "libs/core/async_combinators/tests/unit/CMakeFiles/tests.unit.modules.async_combinators.when_each.dir/DependInfo.cmake"
+  "libs/core/async_combinators/tests/unit/CMakeFiles/when_some_test.dir/DependInfo.cmake"
+  "libs/core/async_combinators/tests/unit/CMakeFiles/tests.unit.modules.async_combinators.when_some.dir/DependInfo.cmake"
+  "libs/core/async_combinators/tests/unit/CMakeFiles/when_some_std_array_test.dir/DependInfo.cmake"
+  "libs/core/async_combinators/tests/unit/CMakeFiles/tests.unit.modules.async_combinators.when_some_std_array.dir/DependInfo.cmake"
+  "libs/core/async_local/CMakeFiles/hpx_async_local.dir/DependInfo.cmake"
+  "libs/core/async_local/tests/CMakeFiles/tests.unit.modules.async_local.dir/DependInfo.cmake"
+  "libs/core/async_local/tests/unit/CMakeFiles/apply_local_test.dir/DependInfo.cmake"
+  "libs/core/async_local/tests/unit/CMakeFiles/tests.unit.modules.async_local.apply_local.dir/DependInfo.cmake"
+  "libs/core/async_local/tests/unit/CMakeFiles/apply_local_executor_test.dir/DependInfo.cmake"
+  "libs/core/async_local/tests/unit/CMakeFiles/tests.unit.modules.async_local.apply_local_executor.dir/DependInfo.cmake"
+  "libs/core/async_local/tests/unit/CMakeFiles/async_local_test.dir/DependInfo.cmake"
+  "libs/core/async_local/tests/unit/CMakeFiles/tests.unit.modules.async_local.async_local.dir/DependInfo.cmake"
+  "libs/core/async_local/tests/unit/CMakeFiles/async_local_executor_test.dir/DependInfo.cmake"
+  "libs/core/async_local/tests/unit/CMakeFiles/tests.unit.modules.async_local.async_local_executor.dir/DependInfo.cmake"
+  "libs/core/async_local/tests/unit/CMakeFiles/async_local_executor_additional_arguments_test.dir/DependInfo.cmake"
+  "libs/core/async_local/tests/unit/CMakeFiles/tests.unit.modules.async_local.async_local_executor_additional_arguments.dir/DependInfo.cmake"
+  "libs/core/async_local/tests/unit/CMakeFiles/task_test.dir/DependInfo.cmake"
+  "libs/core/async_local/tests/unit/CMakeFiles/tests.unit.modules.async_local.task.dir/DependInfo.cmake"
+  "libs/core/batch_environments/CMakeFiles/hpx_batch_environments.dir/DependInfo.cmake"
+  "libs/core/batch_environments/tests/CMakeFiles/tests.unit.modules.batch_environments.dir/DependInfo.cmake"
+  "libs/core/batch_environments/tests/unit/CMakeFiles/parse_slurm_environment_test.dir/DependInfo.cmake"
+  "libs/core/batch_environments/tests/unit/CMakeFiles/tests.unit.modules.batch_environments.parse_slurm_environment.dir/DependInfo.cmake"
+  "libs/core/batch_environments/tests/unit/CMakeFiles/parse_slurm_nodelist_test.dir/DependInfo.cmake"
+  "libs/core/batch_environments/tests/unit/CMakeFiles/tests.unit.modules.batch_environments.parse_slurm_nodelist.dir/DependInfo.cmake"
+  "libs/core/cache/CMakeFiles/hpx_cache.dir/DependInfo.cmake"
+  "libs/core/cache/tests/CMakeFiles/tests.unit.modules.cache.dir/DependInfo.cmake"
+  "libs/core/cache/tests/unit/CMakeFiles/local_lru_cache_test.dir/DependInfo.cmake"
+  "libs/core/cache/tests/unit/CMakeFiles/tests.unit.modules.cache.local_lru_cache.dir/DependInfo.cmake"
+  "libs/core/cache/tests/unit/CMakeFiles/local_mru_cache_test.dir/DependInfo.cmake"
+  "libs/core/cache/tests/unit/CMakeFiles/tests.unit.modules.cache.local_mru_cache.dir/DependInfo.cmake"
+  "libs/core/cache/tests/unit/CMakeFiles/local_statistics_test.dir/DependInfo.cmake"
+  "libs/core/cache/tests/unit/CMakeFiles/tests.unit.modules.cache.local_statistics.dir/DependInfo.cmake"
+  "libs/core/command_line_handling_local/CMakeFiles/hpx_command_line_handling_local.dir/DependInfo.cmake"
+  "libs/core/command_line_handling_local/tests/CMakeFiles/tests.unit.modules.command_line_handling_local.dir/DependInfo.cmake"
+  "libs/core/compute_local/CMakeFiles/hpx_compute_local.dir/DependInfo.cmake"
+  "libs/core/compute_local/tests/CMakeFiles/tests.unit.modules.compute_local.dir/DependInfo.cmake"
+  "libs/core/compute_local/tests/unit/CMakeFiles/block_allocator_test.dir/DependInfo.cmake"
+  "libs/core/compute_local/tests/unit/CMakeFiles/tests.unit.modules.compute_local.block_allocator.dir/DependInfo.cmake"
+  "libs/core/compute_local/tests/unit/CMakeFiles/block_fork_join_executor_test.dir/DependInfo.cmake"
+  "libs/core/compute_local/tests/unit/CMakeFiles/tests.unit.modules.compute_local.block_fork_join_executor.dir/DependInfo.cmake"
+  "libs/core/compute_local/tests/unit/CMakeFiles/numa_allocator_test.dir/DependInfo.cmake"
+  "libs/core/compute_local/tests/unit/CMakeFiles/tests.unit.modules.compute_local.numa_allocator.dir/DependInfo.cmake"
+  "libs/core/concepts/CMakeFiles/hpx_concepts.dir/DependInfo.cmake"
+  "libs/core/concepts/tests/CMakeFiles/tests.unit.modules.concepts.dir/DependInfo.cmake"
+  "libs/core/concurrency/CMakeFiles/hpx_concurrency.dir/DependInfo.cmake"
+  "libs/core/concurrency/tests/CMakeFiles/tests.unit.modules.concurrency.dir/DependInfo.cmake"
+  "libs/core/concurrency/tests/unit/CMakeFiles/chase_lev_deque_test.dir/DependInfo.cmake"
+  "libs/core/concurrency/tests/unit/CMakeFiles/tests.unit.modules.concurrency.chase_lev_deque.dir/DependInfo.cmake"
+  "libs/core/concurrency/tests/unit/CMakeFiles/contiguous_index_queue_test.dir/DependInfo.cmake"
+  "libs/core/concurrency/tests/unit/CMakeFiles/tests.unit.modules.concurrency.contiguous_index_queue.dir/DependInfo.cmake"
+  "libs/core/concurrency/tests/unit/CMakeFiles/lockfree_fifo_test.dir/DependInfo.cmake"
+  "libs/core/concurrency/tests/unit/CMakeFiles/tests.unit.modules.concurrency.lockfree_fifo.dir/DependInfo.cmake"
+  "libs/core/config/CMakeFiles/hpx_config.dir/DependInfo.cmake"
+  "libs/core/config/tests/CMakeFiles/tests.unit.modules.config.dir/DependInfo.cmake"
+  "libs/core/config_registry/CMakeFiles/hpx_config_registry.dir/DependInfo.cmake"
+  "libs/core/config_registry/tests/CMakeFiles/tests.unit.modules.config_registry.dir/DependInfo.cmake"
+  "libs/core/config_registry/tests/unit/CMakeFiles/config_registry_test.dir/DependInfo.cmake"
+  "libs/core/config_registry/tests/unit/CMakeFiles/tests.unit.modules.config_registry.config_registry.dir/DependInfo.cmake"
+  "libs/core/coroutines/CMakeFiles/hpx_coroutines.dir/DependInfo.cmake"
+  "libs/core/coroutines/tests/CMakeFiles/tests.unit.modules.coroutines.dir/DependInfo.cmake"
+  "libs/core/coroutines/tests/unit/CMakeFiles/growable_stacks_test.dir/DependInfo.cmake"
+  "libs/core/coroutines/tests/unit/CMakeFiles/tests.unit.modules.coroutines.growable_stacks.dir/DependInfo.cmake"
+  "libs/core/coroutines/tests/unit/CMakeFiles/stack_arena_test.dir/DependInfo.cmake"
+  "libs/core/coroutines/tests/unit/CMakeFiles/tests.unit.modules.coroutines.stack_arena.dir/DependInfo.cmake"
+  "libs/core/datastructures/CMakeFiles/hpx_datastructures.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/CMakeFiles/tests.unit.modules.datastructures.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/any_test.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/tests.unit.modules.datastructures.any.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/any_serialization_test.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/tests.unit.modules.datastructures.any_serialization.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/boost_any_test.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/tests.unit.modules.datastructures.boost_any.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/dynamic_bitset1_test.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/tests.unit.modules.datastructures.dynamic_bitset1.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/dynamic_bitset2_test.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/tests.unit.modules.datastructures.dynamic_bitset2.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/dynamic_bitset3_test.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/tests.unit.modules.datastructures.dynamic_bitset3.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/dynamic_bitset4_test.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/tests.unit.modules.datastructures.dynamic_bitset4.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/dynamic_bitset5_test.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/tests.unit.modules.datastructures.dynamic_bitset5.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/is_tuple_like_test.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/tests.unit.modules.datastructures.is_tuple_like.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/serializable_any_test.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/tests.unit.modules.datastructures.serializable_any.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/serializable_boost_any_test.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/tests.unit.modules.datastructures.serializable_boost_any.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/serialization_optional_test.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/tests.unit.modules.datastructures.serialization_optional.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/serialization_raw_pointer_tuple_test.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/tests.unit.modules.datastructures.serialization_raw_pointer_tuple.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/serialization_tuple_test.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/tests.unit.modules.datastructures.serialization_tuple.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/tuple_test.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/tests.unit.modules.datastructures.tuple.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/unique_any_test.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/tests.unit.modules.datastructures.unique_any.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/small_vector_test.dir/DependInfo.cmake"
+  "libs/core/datastructures/tests/unit/CMakeFiles/tests.unit.modules.datastructures.small_vector.dir/DependInfo.cmake"
+  "libs/core/debugging/CMakeFiles/hpx_debugging.dir/DependInfo.cmake"
+  "libs/core/debugging/tests/CMakeFiles/tests.unit.modules.debugging.dir/DependInfo.cmake"
+  "libs/core/debugging/tests/unit/CMakeFiles/print_test.dir/DependInfo.cmake"
+  "libs/core/debugging/tests/unit/CMakeFiles/tests.unit.modules.debugging.print.dir/DependInfo.cmake"
+  "libs/core/errors/CMakeFiles/hpx_errors.dir/DependInfo.cmake"
+  "libs/core/errors/tests/CMakeFiles/tests.unit.modules.errors.dir/DependInfo.cmake"
+  "libs/core/errors/tests/unit/CMakeFiles/exception_test.dir/DependInfo.cmake"
+  "libs/core/errors/tests/unit/CMakeFiles/tests.unit.modules.errors.exception.dir/DependInfo.cmake"
+  "libs/core/execution/CMakeFiles/hpx_execution.dir/DependInfo.cmake"
+  "libs/core/execution/tests/CMakeFiles/tests.unit.modules.execution.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/algorithm_as_sender_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.algorithm_as_sender.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/algorithm_bulk_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.algorithm_bulk.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/algorithm_ensure_started_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.algorithm_ensure_started.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/algorithm_execute_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.algorithm_execute.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/algorithm_just_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.algorithm_just.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/algorithm_just_error_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.algorithm_just_error.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/algorithm_just_stopped_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.algorithm_just_stopped.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/algorithm_let_error_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.algorithm_let_error.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/algorithm_let_stopped_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.algorithm_let_stopped.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/algorithm_let_value_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.algorithm_let_value.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/algorithm_run_loop_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.algorithm_run_loop.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/algorithm_split_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.algorithm_split.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/algorithm_start_detached_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.algorithm_start_detached.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/algorithm_sync_wait_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.algorithm_sync_wait.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/algorithm_sync_wait_with_variant_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.algorithm_sync_wait_with_variant.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/algorithm_then_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.algorithm_then.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/algorithm_transfer_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.algorithm_transfer.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/algorithm_transfer_just_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.algorithm_transfer_just.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/algorithm_transfer_when_all_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.algorithm_transfer_when_all.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/algorithm_when_all_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.algorithm_when_all.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/autotuned_executor_parameters_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.autotuned_executor_parameters.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/bulk_async_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.bulk_async.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/environment_queries_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.environment_queries.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/executor_parameters_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.executor_parameters.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/executor_parameters_dispatching_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.executor_parameters_dispatching.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/executor_parameters_timer_hooks_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.executor_parameters_timer_hooks.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/forwarding_env_query_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.forwarding_env_query.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/forwarding_scheduler_query_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.forwarding_scheduler_query.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/forwarding_sender_query_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.forwarding_sender_query.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/future_then_executor_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.future_then_executor.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/minimal_async_executor_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.minimal_async_executor.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/minimal_sync_executor_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.minimal_sync_executor.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/persistent_executor_parameters_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.persistent_executor_parameters.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/forward_progress_guarantee_test.dir/DependInfo.cmake"
+  "libs/core/execution/tests/unit/CMakeFiles/tests.unit.modules.execution.forward_progress_guarantee.dir/DependInfo.cmake"
+  "libs/core/execution_base/CMakeFiles/hpx_execution_base.dir/DependInfo.cmake"
+  "libs/core/execution_base/tests/CMakeFiles/tests.unit.modules.execution_base.dir/DependInfo.cmake"
+  "libs/core/execution_base/tests/unit/CMakeFiles/any_sender_test.dir/DependInfo.cmake"
+  "libs/core/execution_base/tests/unit/CMakeFiles/tests.unit.modules.execution_base.any_sender.dir/DependInfo.cmake"
+  "libs/core/execution_base/tests/unit/CMakeFiles/basic_operation_state_test.dir/DependInfo.cmake"
+  "libs/core/execution_base/tests/unit/CMakeFiles/tests.unit.modules.execution_base.basic_operation_state.dir/DependInfo.cmake"
+  "libs/core/execution_base/tests/unit/CMakeFiles/basic_receiver_test.dir/DependInfo.cmake"
+  "libs/core/execution_base/tests/unit/CMakeFiles/tests.unit.modules.execution_base.basic_receiver.dir/DependInfo.cmake"
+  "libs/core/execution_base/tests/unit/CMakeFiles/basic_sender_test.dir/DependInfo.cmake"
+  "libs/core/execution_base/tests/unit/CMakeFiles/tests.unit.modules.execution_base.basic_sender.dir/DependInfo.cmake"
+  "libs/core/execution_base/tests/unit/CMakeFiles/basic_schedule_test.dir/DependInfo.cmake"
+  "libs/core/execution_base/tests/unit/CMakeFiles/tests.unit.modules.execution_base.basic_schedule.dir/DependInfo.cmake"
+  "libs/core/execution_base/tests/unit/CMakeFiles/completion_signatures_test.dir/DependInfo.cmake"
+  "libs/core/execution_base/tests/unit/CMakeFiles/tests.unit.modules.execution_base.completion_signatures.dir/DependInfo.cmake"
+  "libs/core/execution_base/tests/unit/CMakeFiles/execution_context_test.dir/DependInfo.cmake"
+  "libs/core/execution_base/tests/unit/CMakeFiles/tests.unit.modules.execution_base.execution_context.dir/DependInfo.cmake"
+  "libs/core/execution_base/tests/unit/CMakeFiles/get_env_test.dir/DependInfo.cmake"
+  "libs/core/execution_base/tests/unit/CMakeFiles/tests.unit.modules.execution_base.get_env.dir/DependInfo.cmake"
+  "libs/core/execution_base/tests/unit/CMakeFiles/execute_may_block_caller_test.dir/DependInfo.cmake"
+  "libs/core/execution_base/tests/unit/CMakeFiles/tests.unit.modules.execution_base.execute_may_block_caller.dir/DependInfo.cmake"
+  "libs/core/execution_base/tests/unit/CMakeFiles/coroutine_traits_test.dir/DependInfo.cmake"
+  "libs/core/execution_base/tests/unit/CMakeFiles/tests.unit.modules.execution_base.coroutine_traits.dir/DependInfo.cmake"
+  "libs/core/execution_base/tests/unit/CMakeFiles/coroutine_utils_test.dir/DependInfo.cmake"
+  "libs/core/execution_base/tests/unit/CMakeFiles/tests.unit.modules.execution_base.coroutine_utils.dir/DependInfo.cmake"
+  "libs/core/executors/CMakeFiles/hpx_executors.dir/DependInfo.cmake"
+  "libs/core/executors/tests/CMakeFiles/tests.unit.modules.executors.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/annotating_executor_test.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/tests.unit.modules.executors.annotating_executor.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/annotation_property_test.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/tests.unit.modules.executors.annotation_property.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/created_executor_test.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/tests.unit.modules.executors.created_executor.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/execution_policy_mappings_test.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/tests.unit.modules.executors.execution_policy_mappings.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/explicit_scheduler_executor_test.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/tests.unit.modules.executors.explicit_scheduler_executor.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/fork_join_executor_test.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/tests.unit.modules.executors.fork_join_executor.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/limiting_executor_test.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/tests.unit.modules.executors.limiting_executor.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/parallel_executor_test.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/tests.unit.modules.executors.parallel_executor.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/parallel_executor_parameters_test.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/tests.unit.modules.executors.parallel_executor_parameters.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/parallel_fork_executor_test.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/tests.unit.modules.executors.parallel_fork_executor.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/parallel_policy_executor_test.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/tests.unit.modules.executors.parallel_policy_executor.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/polymorphic_executor_test.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/tests.unit.modules.executors.polymorphic_executor.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/scheduler_executor_test.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/tests.unit.modules.executors.scheduler_executor.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/sequenced_executor_test.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/tests.unit.modules.executors.sequenced_executor.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/service_executors_test.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/tests.unit.modules.executors.service_executors.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/shared_parallel_executor_test.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/tests.unit.modules.executors.shared_parallel_executor.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/standalone_thread_pool_executor_test.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/tests.unit.modules.executors.standalone_thread_pool_executor.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/thread_pool_scheduler_test.dir/DependInfo.cmake"
+  "libs/core/executors/tests/unit/CMakeFiles/tests.unit.modules.executors.thread_pool_scheduler.dir/DependInfo.cmake"
+  "libs/core/filesystem/CMakeFiles/hpx_filesystem.dir/DependInfo.cmake"
+  "libs/core/filesystem/tests/CMakeFiles/tests.unit.modules.filesystem.dir/DependInfo.cmake"
+  "libs/core/format/CMakeFiles/hpx_format.dir/DependInfo.cmake"
+  "libs/core/format/tests/CMakeFiles/tests.unit.modules.format.dir/DependInfo.cmake"
+  "libs/core/format/tests/unit/CMakeFiles/format_test.dir/DependInfo.cmake"
+  "libs/core/format/tests/unit/CMakeFiles/tests.unit.modules.format.format.dir/DependInfo.cmake"
+  "libs/core/functional/CMakeFiles/hpx_functional.dir/DependInfo.cmake"
+  "libs/core/functional/tests/CMakeFiles/tests.unit.modules.functional.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/bind_const_test_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/tests.unit.modules.functional.bind_const_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/bind_cv_test_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/tests.unit.modules.functional.bind_cv_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/bind_dm2_test_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/tests.unit.modules.functional.bind_dm2_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/bind_dm3_test_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/tests.unit.modules.functional.bind_dm3_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/bind_dm_test_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/tests.unit.modules.functional.bind_dm_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/bind_placeholder_test_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/tests.unit.modules.functional.bind_placeholder_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/bind_rv_sp_test_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/tests.unit.modules.functional.bind_rv_sp_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/bind_rvalue_test_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/tests.unit.modules.functional.bind_rvalue_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/bind_stateful_test_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/tests.unit.modules.functional.bind_stateful_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/bind_test_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/tests.unit.modules.functional.bind_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/contains_test_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/tests.unit.modules.functional.contains_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/function_args_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/tests.unit.modules.functional.function_args.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/function_arith_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/tests.unit.modules.functional.function_arith.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/function_bind_test_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/tests.unit.modules.functional.function_bind_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/function_object_size_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/tests.unit.modules.functional.function_object_size.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/function_ref_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/tests.unit.modules.functional.function_ref.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/function_ref_wrapper_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/tests.unit.modules.functional.function_ref_wrapper.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/function_target_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/tests.unit.modules.functional.function_target.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/function_test_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/tests.unit.modules.functional.function_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/is_invocable_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/tests.unit.modules.functional.is_invocable.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/mem_fn_derived_test_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/tests.unit.modules.functional.mem_fn_derived_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/mem_fn_dm_test_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/tests.unit.modules.functional.mem_fn_dm_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/mem_fn_rv_test_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/tests.unit.modules.functional.mem_fn_rv_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/mem_fn_test_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/tests.unit.modules.functional.mem_fn_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/mem_fn_unary_addr_test_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/tests.unit.modules.functional.mem_fn_unary_addr_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/mem_fn_void_test_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/tests.unit.modules.functional.mem_fn_void_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/nothrow_swap_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/tests.unit.modules.functional.nothrow_swap.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/protect_test_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/tests.unit.modules.functional.protect_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/stateless_test_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/tests.unit.modules.functional.stateless_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/sum_avg_test.dir/DependInfo.cmake"
+  "libs/core/functional/tests/unit/CMakeFiles/tests.unit.modules.functional.sum_avg.dir/DependInfo.cmake"
+  "libs/core/futures/CMakeFiles/hpx_futures.dir/DependInfo.cmake"
+  "libs/core/futures/tests/CMakeFiles/tests.unit.modules.futures.dir/DependInfo.cmake"
+  "libs/core/futures/tests/unit/CMakeFiles/future_test.dir/DependInfo.cmake"
+  "libs/core/futures/tests/unit/CMakeFiles/tests.unit.modules.futures.future.dir/DependInfo.cmake"
+  "libs/core/futures/tests/unit/CMakeFiles/future_ref_test.dir/DependInfo.cmake"
+  "libs/core/futures/tests/unit/CMakeFiles/tests.unit.modules.futures.future_ref.dir/DependInfo.cmake"
+  "libs/core/futures/tests/unit/CMakeFiles/future_then_test.dir/DependInfo.cmake"
+  "libs/core/futures/tests/unit/CMakeFiles/tests.unit.modules.futures.future_then.dir/DependInfo.cmake"
+  "libs/core/futures/tests/unit/CMakeFiles/local_promise_allocator_test.dir/DependInfo.cmake"
+  "libs/core/futures/tests/unit/CMakeFiles/tests.unit.modules.futures.local_promise_allocator.dir/DependInfo.cmake"
+  "libs/core/futures/tests/unit/CMakeFiles/local_use_allocator_test.dir/DependInfo.cmake"
+  "libs/core/futures/tests/unit/CMakeFiles/tests.unit.modules.futures.local_use_allocator.dir/DependInfo.cmake"
+  "libs/core/futures/tests/unit/CMakeFiles/make_future_test.dir/DependInfo.cmake"
+  "libs/core/futures/tests/unit/CMakeFiles/tests.unit.modules.futures.make_future.dir/DependInfo.cmake"
+  "libs/core/futures/tests/unit/CMakeFiles/make_ready_future_test.dir/DependInfo.cmake"
+  "libs/core/futures/tests/unit/CMakeFiles/tests.unit.modules.futures.make_ready_future.dir/DependInfo.cmake"
+  "libs/core/futures/tests/unit/CMakeFiles/shared_future_test.dir/DependInfo.cmake"
+  "libs/core/futures/tests/unit/CMakeFiles/tests.unit.modules.futures.shared_future.dir/DependInfo.cmake"
+  "libs/core/futures/tests/unit/CMakeFiles/await_test.dir/DependInfo.cmake"
+  "libs/core/futures/tests/unit/CMakeFiles/tests.unit.modules.futures.await.dir/DependInfo.cmake"
+  "libs/core/hardware/CMakeFiles/hpx_hardware.dir/DependInfo.cmake"
+  "libs/core/hardware/tests/CMakeFiles/tests.unit.modules.hardware.dir/DependInfo.cmake"
+  "libs/core/hashing/CMakeFiles/hpx_hashing.dir/DependInfo.cmake"
+  "libs/core/hashing/tests/CMakeFiles/tests.unit.modules.hashing.dir/DependInfo.cmake"
+  "libs/core/include_local/CMakeFiles/hpx_include_local.dir/DependInfo.cmake"
+  "libs/core/include_local/tests/CMakeFiles/tests.unit.modules.include_local.dir/DependInfo.cmake"
+  "libs/core/ini/CMakeFiles/hpx_ini.dir/DependInfo.cmake"
+  "libs/core/ini/tests/CMakeFiles/tests.unit.modules.ini.dir/DependInfo.cmake"
+  "libs/core/init_runtime_local/CMakeFiles/hpx_init_runtime_local.dir/DependInfo.cmake"
+  "libs/core/init_runtime_local/tests/CMakeFiles/tests.unit.modules.init_runtime_local.dir/DependInfo.cmake"
+  "libs/core/init_runtime_local/tests/unit/CMakeFiles/shutdown_suspended_thread_local_test.dir/DependInfo.cmake"
+  "libs/core/init_runtime_local/tests/unit/CMakeFiles/tests.unit.modules.init_runtime_local.shutdown_suspended_thread_local.dir/DependInfo.cmake"
+  "libs/core/io_service/CMakeFiles/hpx_io_service.dir/DependInfo.cmake"
+  "libs/core/io_service/tests/CMakeFiles/tests.unit.modules.io_service.dir/DependInfo.cmake"
+  "libs/core/iterator_support/CMakeFiles/hpx_iterator_support.dir/DependInfo.cmake"
+  "libs/core/iterator_support/tests/CMakeFiles/tests.unit.modules.iterator_support.dir/DependInfo.cmake"
+  "libs/core/iterator_support/tests/unit/CMakeFiles/boost_iterator_categories_test.dir/DependInfo.cmake"
+  "libs/core/iterator_support/tests/unit/CMakeFiles/tests.unit.modules.iterator_support.boost_iterator_categories.dir/DependInfo.cmake"
+  "libs/core/iterator_support/tests/unit/CMakeFiles/counting_iterator_test.dir/DependInfo.cmake"
+  "libs/core/iterator_support/tests/unit/CMakeFiles/tests.unit.modules.iterator_support.counting_iterator.dir/DependInfo.cmake"
+  "libs/core/iterator_support/tests/unit/CMakeFiles/is_iterator_test.dir/DependInfo.cmake"
+  "libs/core/iterator_support/tests/unit/CMakeFiles/tests.unit.modules.iterator_support.is_iterator.dir/DependInfo.cmake"
+  "libs/core/iterator_support/tests/unit/CMakeFiles/is_range_test.dir/DependInfo.cmake"
+  "libs/core/iterator_support/tests/unit/CMakeFiles/tests.unit.modules.iterator_support.is_range.dir/DependInfo.cmake"
+  "libs/core/iterator_support/tests/unit/CMakeFiles/iterator_adaptor_test.dir/DependInfo.cmake"
+  "libs/core/iterator_support/tests/unit/CMakeFiles/tests.unit.modules.iterator_support.iterator_adaptor.dir/DependInfo.cmake"
+  "libs/core/iterator_support/tests/unit/CMakeFiles/iterator_facade_test.dir/DependInfo.cmake"
+  "libs/core/iterator_support/tests/unit/CMakeFiles/tests.unit.modules.iterator_support.iterator_facade.dir/DependInfo.cmake"
+  "libs/core/iterator_support/tests/unit/CMakeFiles/range_test.dir/DependInfo.cmake"
+  "libs/core/iterator_support/tests/unit/CMakeFiles/tests.unit.modules.iterator_support.range.dir/DependInfo.cmake"
+  "libs/core/iterator_support/tests/unit/CMakeFiles/stencil3_iterator_test.dir/DependInfo.cmake"
+  "libs/core/iterator_support/tests/unit/CMakeFiles/tests.unit.modules.iterator_support.stencil3_iterator.dir/DependInfo.cmake"
+  "libs/core/iterator_support/tests/unit/CMakeFiles/transform_iterator_test.dir/DependInfo.cmake"
+  "libs/core/iterator_support/tests/unit/CMakeFiles/tests.unit.modules.iterator_support.transform_iterator.dir/DependInfo.cmake"
+  "libs/core/iterator_support/tests/unit/CMakeFiles/transform_iterator2_test.dir/DependInfo.cmake"
+  "libs/core/iterator_support/tests/unit/CMakeFiles/tests.unit.modules.iterator_support.transform_iterator2.dir/DependInfo.cmake"
+  "libs/core/iterator_support/tests/unit/CMakeFiles/zip_iterator_test.dir/DependInfo.cmake"
+  "libs/core/iterator_support/tests/unit/CMakeFiles/tests.unit.modules.iterator_support.zip_iterator.dir/DependInfo.cmake"
+  "libs/core/iterator_support/tests/unit/CMakeFiles/is_sentinel_for_test.dir/DependInfo.cmake"
+  "libs/core/iterator_support/tests/unit/CMakeFiles/tests.unit.modules.iterator_support.is_sentinel_for.dir/DependInfo.cmake"
+  "libs/core/iterator_support/tests/unit/CMakeFiles/is_sized_sentinel_for_test.dir/DependInfo.cmake"
+  "libs/core/iterator_support/tests/unit/CMakeFiles/tests.unit.modules.iterator_support.is_sized_sentinel_for.dir/DependInfo.cmake"
+  "libs/core/itt_notify/CMakeFiles/hpx_itt_notify.dir/DependInfo.cmake"
+  "libs/core/itt_notify/tests/CMakeFiles/tests.unit.modules.itt_notify.dir/DependInfo.cmake"
+  "libs/core/lcos_local/CMakeFiles/hpx_lcos_local.dir/DependInfo.cmake"
+  "libs/core/lcos_local/tests/CMakeFiles/tests.unit.modules.lcos_local.dir/DependInfo.cmake"
+  "libs/core/lcos_local/tests/unit/CMakeFiles/channel_local_test.dir/DependInfo.cmake"
+  "libs/core/lcos_local/tests/unit/CMakeFiles/tests.unit.modules.lcos_local.channel_local.dir/DependInfo.cmake"
+  "libs/core/lcos_local/tests/unit/CMakeFiles/local_dataflow_test.dir/DependInfo.cmake"
+  "libs/core/lcos_local/tests/unit/CMakeFiles/tests.unit.modules.lcos_local.local_dataflow.dir/DependInfo.cmake"
+  "libs/core/lcos_local/tests/unit/CMakeFiles/local_dataflow_small_vector_test.dir/DependInfo.cmake"
+  "libs/core/lcos_local/tests/unit/CMakeFiles/tests.unit.modules.lcos_local.local_dataflow_small_vector.dir/DependInfo.cmake"
+  "libs/core/lcos_local/tests/unit/CMakeFiles/local_dataflow_executor_test.dir/DependInfo.cmake"
+  "libs/core/lcos_local/tests/unit/CMakeFiles/tests.unit.modules.lcos_local.local_dataflow_executor.dir/DependInfo.cmake"
+  "libs/core/lcos_local/tests/unit/CMakeFiles/local_dataflow_external_future_test.dir/DependInfo.cmake"
+  "libs/core/lcos_local/tests/unit/CMakeFiles/tests.unit.modules.lcos_local.local_dataflow_external_future.dir/DependInfo.cmake"
+  "libs/core/lcos_local/tests/unit/CMakeFiles/local_dataflow_executor_additional_arguments_test.dir/DependInfo.cmake"
+  "libs/core/lcos_local/tests/unit/CMakeFiles/tests.unit.modules.lcos_local.local_dataflow_executor_additional_arguments.dir/DependInfo.cmake"
+  "libs/core/lcos_local/tests/unit/CMakeFiles/local_dataflow_std_array_test.dir/DependInfo.cmake"
+  "libs/core/lcos_local/tests/unit/CMakeFiles/tests.unit.modules.lcos_local.local_dataflow_std_array.dir/DependInfo.cmake"
+  "libs/core/lcos_local/tests/unit/CMakeFiles/run_guarded_test.dir/DependInfo.cmake"
+  "libs/core/lcos_local/tests/unit/CMakeFiles/tests.unit.modules.lcos_local.run_guarded.dir/DependInfo.cmake"
+  "libs/core/lcos_local/tests/unit/CMakeFiles/split_future_test.dir/DependInfo.cmake"
+  "libs/core/lcos_local/tests/unit/CMakeFiles/tests.unit.modules.lcos_local.split_future.dir/DependInfo.cmake"
+  "libs/core/lock_registration/CMakeFiles/hpx_lock_registration.dir/DependInfo.cmake"
+  "libs/core/lock_registration/tests/CMakeFiles/tests.unit.modules.lock_registration.dir/DependInfo.cmake"
+  "libs/core/logging/CMakeFiles/hpx_logging.dir/DependInfo.cmake"
+  "libs/core/logging/tests/CMakeFiles/tests.unit.modules.logging.dir/DependInfo.cmake"
+  "libs/core/memory/CMakeFiles/hpx_memory.dir/DependInfo.cmake"
+  "libs/core/memory/tests/CMakeFiles/tests.unit.modules.memory.dir/DependInfo.cmake"
+  "libs/core/memory/tests/unit/CMakeFiles/intrusive_ptr_test.dir/DependInfo.cmake"
+  "libs/core/memory/tests/unit/CMakeFiles/tests.unit.modules.memory.intrusive_ptr.dir/DependInfo.cmake"
+  "libs/core/memory/tests/unit/CMakeFiles/intrusive_ptr_move_test.dir/DependInfo.cmake"
+  "libs/core/memory/tests/unit/CMakeFiles/tests.unit.modules.memory.intrusive_ptr_move.dir/DependInfo.cmake"
+  "libs/core/memory/tests/unit/CMakeFiles/intrusive_ptr_polymorphic_test.dir/DependInfo.cmake"
+  "libs/core/memory/tests/unit/CMakeFiles/tests.unit.modules.memory.intrusive_ptr_polymorphic.dir/DependInfo.cmake"
+  "libs/core/memory/tests/unit/CMakeFiles/intrusive_ptr_polymorphic_nonintrusive_test.dir/DependInfo.cmake"
+  "libs/core/memory/tests/unit/CMakeFiles/tests.unit.modules.memory.intrusive_ptr_polymorphic_nonintrusive.dir/DependInfo.cmake"
+  "libs/core/memory/tests/unit/CMakeFiles/ip_convertible_test.dir/DependInfo.cmake"
+  "libs/core/memory/tests/unit/CMakeFiles/tests.unit.modules.memory.ip_convertible.dir/DependInfo.cmake"
+  "libs/core/memory/tests/unit/CMakeFiles/ip_hash_test.dir/DependInfo.cmake"
+  "libs/core/memory/tests/unit/CMakeFiles/tests.unit.modules.memory.ip_hash.dir/DependInfo.cmake"
+  "libs/core/memory/tests/unit/CMakeFiles/serialization_intrusive_ptr_test.dir/DependInfo.cmake"
+  "libs/core/memory/tests/unit/CMakeFiles/tests.unit.modules.memory.serialization_intrusive_ptr.dir/DependInfo.cmake"
+  "libs/core/pack_traversal/CMakeFiles/hpx_pack_traversal.dir/DependInfo.cmake"
+  "libs/core/pack_traversal/tests/CMakeFiles/tests.unit.modules.pack_traversal.dir/DependInfo.cmake"
+  "libs/core/pack_traversal/tests/unit/CMakeFiles/pack_traversal_test.dir/DependInfo.cmake"
+  "libs/core/pack_traversal/tests/unit/CMakeFiles/tests.unit.modules.pack_traversal.pack_traversal.dir/DependInfo.cmake"
+  "libs/core/pack_traversal/tests/unit/CMakeFiles/pack_traversal_async_test.dir/DependInfo.cmake"
+  "libs/core/pack_traversal/tests/unit/CMakeFiles/tests.unit.modules.pack_traversal.pack_traversal_async.dir/DependInfo.cmake"
+  "libs/core/pack_traversal/tests/unit/CMakeFiles/unwrap_test.dir/DependInfo.cmake"
+  "libs/core/pack_traversal/tests/unit/CMakeFiles/tests.unit.modules.pack_traversal.unwrap.dir/DependInfo.cmake"
+  "libs/core/plugin/CMakeFiles/hpx_plugin.dir/DependInfo.cmake"
+  "libs/core/plugin/tests/CMakeFiles/tests.unit.modules.plugin.dir/DependInfo.cmake"
+  "libs/core/prefix/CMakeFiles/hpx_prefix.dir/DependInfo.cmake"
+  "libs/core/prefix/tests/CMakeFiles/tests.unit.modules.prefix.dir/DependInfo.cmake"
+  "libs/core/preprocessor/CMakeFiles/hpx_preprocessor.dir/DependInfo.cmake"
+  "libs/core/preprocessor/tests/CMakeFiles/tests.unit.modules.preprocessor.dir/DependInfo.cmake"
+  "libs/core/program_options/CMakeFiles/hpx_program_options.dir/DependInfo.cmake"
+  "libs/core/program_options/tests/CMakeFiles/tests.unit.modules.program_options.dir/DependInfo.cmake"
+  "libs/core/program_options/tests/unit/CMakeFiles/cmdline_test.dir/DependInfo.cmake"
+  "libs/core/program_options/tests/unit/CMakeFiles/tests.unit.modules.program_options.cmdline.dir/DependInfo.cmake"
+  "libs/core/program_options/tests/unit/CMakeFiles/options_exception_test.dir/DependInfo.cmake"
+  "libs/core/program_options/tests/unit/CMakeFiles/tests.unit.modules.program_options.options_exception.dir/DependInfo.cmake"
+  "libs/core/program_options/tests/unit/CMakeFiles/optional_test.dir/DependInfo.cmake"
+  "libs/core/program_options/tests/unit/CMakeFiles/tests.unit.modules.program_options.optional.dir/DependInfo.cmake"
+  "libs/core/program_options/tests/unit/CMakeFiles/options_description_test.dir/DependInfo.cmake"
+  "libs/core/program_options/tests/unit/CMakeFiles/tests.unit.modules.program_options.options_description.dir/DependInfo.cmake"
+  "libs/core/program_options/tests/unit/CMakeFiles/parsers_test.dir/DependInfo.cmake"
+  "libs/core/program_options/tests/unit/CMakeFiles/tests.unit.modules.program_options.parsers.dir/DependInfo.cmake"
+  "libs/core/program_options/tests/unit/CMakeFiles/positional_options_test.dir/DependInfo.cmake"
+  "libs/core/program_options/tests/unit/CMakeFiles/tests.unit.modules.program_options.positional_options.dir/DependInfo.cmake"
+  "libs/core/program_options/tests/unit/CMakeFiles/required_test.dir/DependInfo.cmake"
+  "libs/core/program_options/tests/unit/CMakeFiles/tests.unit.modules.program_options.required.dir/DependInfo.cmake"
+  "libs/core/program_options/tests/unit/CMakeFiles/split_test.dir/DependInfo.cmake"
+  "libs/core/program_options/tests/unit/CMakeFiles/tests.unit.modules.program_options.split.dir/DependInfo.cmake"
+  "libs/core/program_options/tests/unit/CMakeFiles/unicode_test.dir/DependInfo.cmake"
+  "libs/core/program_options/tests/unit/CMakeFiles/tests.unit.modules.program_options.unicode.dir/DependInfo.cmake"
+  "libs/core/program_options/tests/unit/CMakeFiles/unrecognized_test.dir/DependInfo.cmake"
+  "libs/core/program_options/tests/unit/CMakeFiles/tests.unit.modules.program_options.unrecognized.dir/DependInfo.cmake"
+  "libs/core/program_options/tests/unit/CMakeFiles/variable_map_test.dir/DependInfo.cmake"
+  "libs/core/program_options/tests/unit/CMakeFiles/tests.unit.modules.program_options.variable_map.dir/DependInfo.cmake"
+  "libs/core/program_options/tests/unit/CMakeFiles/winmain_test.dir/DependInfo.cmake"
+  "libs/core/program_options/tests/unit/CMakeFiles/tests.unit.modules.program_options.winmain.dir/DependInfo.cmake"
+  "libs/core/properties/CMakeFiles/hpx_properties.dir/DependInfo.cmake"
+  "libs/core/properties/tests/CMakeFiles/tests.unit.modules.properties.dir/DependInfo.cmake"
+  "libs/core/properties/tests/unit/CMakeFiles/properties_test.dir/DependInfo.cmake"
+  "libs/core/properties/tests/unit/CMakeFiles/tests.unit.modules.properties.properties.dir/DependInfo.cmake"
+  "libs/core/resiliency/CMakeFiles/hpx_resiliency.dir/DependInfo.cmake"
+  "libs/core/resiliency/tests/CMakeFiles/tests.unit.modules.resiliency.dir/DependInfo.cmake"
+  "libs/core/resiliency/tests/unit/CMakeFiles/async_replay_executor_test.dir/DependInfo.cmake"
+  "libs/core/resiliency/tests/unit/CMakeFiles/tests.unit.modules.resiliency.async_replay_executor.dir/DependInfo.cmake"
+  "libs/core/resiliency/tests/unit/CMakeFiles/async_replay_plain_test.dir/DependInfo.cmake"
+  "libs/core/resiliency/tests/unit/CMakeFiles/tests.unit.modules.resiliency.async_replay_plain.dir/DependInfo.cmake"
+  "libs/core/resiliency/tests/unit/CMakeFiles/async_replicate_executor_test.dir/DependInfo.cmake"
+  "libs/core/resiliency/tests/unit/CMakeFiles/tests.unit.modules.resiliency.async_replicate_executor.dir/DependInfo.cmake"
+  "libs/core/resiliency/tests/unit/CMakeFiles/async_replicate_plain_test.dir/DependInfo.cmake"
+  "libs/core/resiliency/tests/unit/CMakeFiles/tests.unit.modules.resiliency.async_replicate_plain.dir/DependInfo.cmake"
+  "libs/core/resiliency/tests/unit/CMakeFiles/async_replicate_vote_executor_test.dir/DependInfo.cmake"
+  "libs/core/resiliency/tests/unit/CMakeFiles/tests.unit.modules.resiliency.async_replicate_vote_executor.dir/DependInfo.cmake"
+  "libs/core/resiliency/tests/unit/CMakeFiles/async_replicate_vote_plain_test.dir/DependInfo.cmake"
+  "libs/core/resiliency/tests/unit/CMakeFiles/tests.unit.modules.resiliency.async_replicate_vote_plain.dir/DependInfo.cmake"
+  "libs/core/resiliency/tests/unit/CMakeFiles/replay_executor_test.dir/DependInfo.cmake"
+  "libs/core/resiliency/tests/unit/CMakeFiles/tests.unit.modules.resiliency.replay_executor.dir/DependInfo.cmake"
+  "libs/core/resiliency/tests/unit/CMakeFiles/replicate_executor_test.dir/DependInfo.cmake"
+  "libs/core/resiliency/tests/unit/CMakeFiles/tests.unit.modules.resiliency.replicate_executor.dir/DependInfo.cmake"
+  "libs/core/resiliency/tests/unit/CMakeFiles/dataflow_replay_executor_test.dir/DependInfo.cmake"
+  "libs/core/resiliency/tests/unit/CMakeFiles/tests.unit.modules.resiliency.dataflow_replay_executor.dir/DependInfo.cmake"
+  "libs/core/resiliency/tests/unit/CMakeFiles/dataflow_replay_plain_test.dir/DependInfo.cmake"
+  "libs/core/resiliency/tests/unit/CMakeFiles/tests.unit.modules.resiliency.dataflow_replay_plain.dir/DependInfo.cmake"
+  "libs/core/resiliency/tests/unit/CMakeFiles/dataflow_replicate_executor_test.dir/DependInfo.cmake"
+  "libs/core/resiliency/tests/unit/CMakeFiles/tests.unit.modules.resiliency.dataflow_replicate_executor.dir/DependInfo.cmake"
+  "libs/core/resiliency/tests/unit/CMakeFiles/dataflow_replicate_plain_test.dir/DependInfo.cmake"
+  "libs/core/resiliency/tests/unit/CMakeFiles/tests.unit.modules.resiliency.dataflow_replicate_plain.dir/DependInfo.cmake"
+  "libs/core/resource_partitioner/CMakeFiles/hpx_resource_partitioner.dir/DependInfo.cmake"
+  "libs/core/resource_partitioner/tests/CMakeFiles/tests.unit.modules.resource_partitioner.dir/DependInfo.cmake"
+  "libs/core/resource_partitioner/tests/unit/CMakeFiles/cross_pool_injection_test.dir/DependInfo.cmake"
+  "libs/core/resource_partitioner/tests/unit/CMakeFiles/tests.unit.modules.resource_partitioner.cross_pool_injection.dir/DependInfo.cmake"
+  "libs/core/resource_partitioner/tests/unit/CMakeFiles/named_pool_executor_test.dir/DependInfo.cmake"
+  "libs/core/resource_partitioner/tests/unit/CMakeFiles/tests.unit.modules.resource_partitioner.named_pool_executor.dir/DependInfo.cmake"
+  "libs/core/resource_partitioner/tests/unit/CMakeFiles/resource_partitioner_info_test.dir/DependInfo.cmake"
+  "libs/core/resource_partitioner/tests/unit/CMakeFiles/tests.unit.modules.resource_partitioner.resource_partitioner_info.dir/DependInfo.cmake"
+  "libs/core/resource_partitioner/tests/unit/CMakeFiles/scheduler_binding_check_test.dir/DependInfo.cmake"
+  "libs/core/resource_partitioner/tests/unit/CMakeFiles/tests.unit.modules.resource_partitioner.scheduler_binding_check.dir/DependInfo.cmake"
+  "libs/core/resource_partitioner/tests/unit/CMakeFiles/scheduler_priority_check_test.dir/DependInfo.cmake"
+  "libs/core/resource_partitioner/tests/unit/CMakeFiles/tests.unit.modules.resource_partitioner.scheduler_priority_check.dir/DependInfo.cmake"
+  "libs/core/resource_partitioner/tests/unit/CMakeFiles/shutdown_suspended_pus_test.dir/DependInfo.cmake"
+  "libs/core/resource_partitioner/tests/unit/CMakeFiles/tests.unit.modules.resource_partitioner.shutdown_suspended_pus.dir/DependInfo.cmake"
+  "libs/core/resource_partitioner/tests/unit/CMakeFiles/suspend_disabled_test.dir/DependInfo.cmake"
+  "libs/core/resource_partitioner/tests/unit/CMakeFiles/tests.unit.modules.resource_partitioner.suspend_disabled.dir/DependInfo.cmake"
+  "libs/core/resource_partitioner/tests/unit/CMakeFiles/suspend_pool_test.dir/DependInfo.cmake"
+  "libs/core/resource_partitioner/tests/unit/CMakeFiles/tests.unit.modules.resource_partitioner.suspend_pool.dir/DependInfo.cmake"
+  "libs/core/resource_partitioner/tests/unit/CMakeFiles/suspend_pool_external_test.dir/DependInfo.cmake"
+  "libs/core/resource_partitioner/tests/unit/CMakeFiles/tests.unit.modules.resource_partitioner.suspend_pool_external.dir/DependInfo.cmake"
+  "libs/core/resource_partitioner/tests/unit/CMakeFiles/suspend_runtime_test.dir/DependInfo.cmake"
+  "libs/core/resource_partitioner/tests/unit/CMakeFiles/tests.unit.modules.resource_partitioner.suspend_runtime.dir/DependInfo.cmake"
+  "libs/core/resource_partitioner/tests/unit/CMakeFiles/suspend_thread_test.dir/DependInfo.cmake"
+  "libs/core/resource_partitioner/tests/unit/CMakeFiles/tests.unit.modules.resource_partitioner.suspend_thread.dir/DependInfo.cmake"
+  "libs/core/resource_partitioner/tests/unit/CMakeFiles/suspend_thread_external_test.dir/DependInfo.cmake"
+  "libs/core/resource_partitioner/tests/unit/CMakeFiles/tests.unit.modules.resource_partitioner.suspend_thread_external.dir/DependInfo.cmake"
+  "libs/core/resource_partitioner/tests/unit/CMakeFiles/used_pus_test.dir/DependInfo.cmake"
+  "libs/core/resource_partitioner/tests/unit/CMakeFiles/tests.unit.modules.resource_partitioner.used_pus.dir/DependInfo.cmake"
+  "libs/core/runtime_configuration/CMakeFiles/hpx_runtime_configuration.dir/DependInfo.cmake"
+  "libs/core/runtime_configuration/tests/CMakeFiles/tests.unit.modules.runtime_configuration.dir/DependInfo.cmake"
+  "libs/core/runtime_local/CMakeFiles/hpx_runtime_local.dir/DependInfo.cmake"
+  "libs/core/runtime_local/tests/CMakeFiles/tests.unit.modules.runtime_local.dir/DependInfo.cmake"
+  "libs/core/runtime_local/tests/unit/CMakeFiles/thread_mapper_test.dir/DependInfo.cmake"
+  "libs/core/runtime_local/tests/unit/CMakeFiles/tests.unit.modules.runtime_local.thread_mapper.dir/DependInfo.cmake"
+  "libs/core/schedulers/CMakeFiles/hpx_schedulers.dir/DependInfo.cmake"
+  "libs/core/schedulers/tests/CMakeFiles/tests.unit.modules.schedulers.dir/DependInfo.cmake"
+  "libs/core/schedulers/tests/unit/CMakeFiles/deadline_scheduler_test.dir/DependInfo.cmake"
+  "libs/core/schedulers/tests/unit/CMakeFiles/tests.unit.modules.schedulers.deadline_scheduler.dir/DependInfo.cmake"
+  "libs/core/schedulers/tests/unit/CMakeFiles/schedule_last_test.dir/DependInfo.cmake"
+  "libs/core/schedulers/tests/unit/CMakeFiles/tests.unit.modules.schedulers.schedule_last.dir/DependInfo.cmake"
+  "libs/core/schedulers/tests/unit/CMakeFiles/steal_attempts_test.dir/DependInfo.cmake"
+  "libs/core/schedulers/tests/unit/CMakeFiles/tests.unit.modules.schedulers.steal_attempts.dir/DependInfo.cmake"
+  "libs/core/schedulers/tests/unit/CMakeFiles/steal_bulk_test.dir/DependInfo.cmake"
+  "libs/core/schedulers/tests/unit/CMakeFiles/tests.unit.modules.schedulers.steal_bulk.dir/DependInfo.cmake"
+  "libs/core/serialization/CMakeFiles/hpx_serialization.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/CMakeFiles/tests.unit.modules.serialization.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/not_bitwise_serializable_test.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/tests.unit.modules.serialization.not_bitwise_serializable.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/serialization_array_test.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/tests.unit.modules.serialization.serialization_array.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/serialization_brace_initializable_test.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/tests.unit.modules.serialization.serialization_brace_initializable.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/serialization_valarray_test.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/tests.unit.modules.serialization.serialization_valarray.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/serialization_builtins_test.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/tests.unit.modules.serialization.serialization_builtins.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/serialization_complex_test.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/tests.unit.modules.serialization.serialization_complex.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/serialization_custom_constructor_test.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/tests.unit.modules.serialization.serialization_custom_constructor.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/serialization_deque_test.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/tests.unit.modules.serialization.serialization_deque.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/serialization_list_test.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/tests.unit.modules.serialization.serialization_list.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/serialization_map_test.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/tests.unit.modules.serialization.serialization_map.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/serialization_set_test.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/tests.unit.modules.serialization.serialization_set.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/serialization_simple_test.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/tests.unit.modules.serialization.serialization_simple.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/serialization_smart_ptr_test.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/tests.unit.modules.serialization.serialization_smart_ptr.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/serialization_std_tuple_test.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/tests.unit.modules.serialization.serialization_std_tuple.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/serialization_unordered_map_test.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/tests.unit.modules.serialization.serialization_unordered_map.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/serialization_vector_test.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/tests.unit.modules.serialization.serialization_vector.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/serialize_with_incompatible_signature_test.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/tests.unit.modules.serialization.serialize_with_incompatible_signature.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/serialization_std_variant_test.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/tests.unit.modules.serialization.serialization_std_variant.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/serialization_simd_test.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/tests.unit.modules.serialization.serialization_simd.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/serialization_raw_pointer_test.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/tests.unit.modules.serialization.serialization_raw_pointer.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/tests_unit_modules_serialization_succeed_compile_empty_class.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/CMakeFiles/tests.unit.modules.serialization.succeed_compile_empty_class.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/polymorphic/CMakeFiles/polymorphic_reference_test.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/polymorphic/CMakeFiles/tests.unit.modules.serialization.polymorphic_reference.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/polymorphic/CMakeFiles/polymorphic_pointer_test.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/polymorphic/CMakeFiles/tests.unit.modules.serialization.polymorphic_pointer.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/polymorphic/CMakeFiles/polymorphic_nonintrusive_test.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/polymorphic/CMakeFiles/tests.unit.modules.serialization.polymorphic_nonintrusive.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/polymorphic/CMakeFiles/polymorphic_nonintrusive_abstract_test.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/polymorphic/CMakeFiles/tests.unit.modules.serialization.polymorphic_nonintrusive_abstract.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/polymorphic/CMakeFiles/polymorphic_semiintrusive_template_test.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/polymorphic/CMakeFiles/tests.unit.modules.serialization.polymorphic_semiintrusive_template.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/polymorphic/CMakeFiles/polymorphic_template_test.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/polymorphic/CMakeFiles/tests.unit.modules.serialization.polymorphic_template.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/polymorphic/CMakeFiles/smart_ptr_polymorphic_test.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/polymorphic/CMakeFiles/tests.unit.modules.serialization.smart_ptr_polymorphic.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/polymorphic/CMakeFiles/smart_ptr_polymorphic_nonintrusive_test.dir/DependInfo.cmake"
+  "libs/core/serialization/tests/unit/polymorphic/CMakeFiles/tests.unit.modules.serialization.smart_ptr_polymorphic_nonintrusive.dir/DependInfo.cmake"
+  "libs/core/static_reinit/CMakeFiles/hpx_static_reinit.dir/DependInfo.cmake"
+  "libs/core/static_reinit/tests/CMakeFiles/tests.unit.modules.static_reinit.dir/DependInfo.cmake"
+  "libs/core/string_util/CMakeFiles/hpx_string_util.dir/DependInfo.cmake"
+  "libs/core/string_util/tests/CMakeFiles/tests.unit.modules.string_util.dir/DependInfo.cmake"
+  "libs/core/string_util/tests/unit/CMakeFiles/string_to_lower_test.dir/DependInfo.cmake"
+  "libs/core/string_util/tests/unit/CMakeFiles/tests.unit.modules.string_util.string_to_lower.dir/DependInfo.cmake"
+  "libs/core/string_util/tests/unit/CMakeFiles/string_split_test.dir/DependInfo.cmake"
+  "libs/core/string_util/tests/unit/CMakeFiles/tests.unit.modules.string_util.string_split.dir/DependInfo.cmake"
+  "libs/core/string_util/tests/unit/CMakeFiles/string_trim_test.dir/DependInfo.cmake"
+  "libs/core/string_util/tests/unit/CMakeFiles/tests.unit.modules.string_util.string_trim.dir/DependInfo.cmake"
+  "libs/core/synchronization/CMakeFiles/hpx_synchronization.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/CMakeFiles/tests.unit.modules.synchronization.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/async_rw_mutex_test.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/tests.unit.modules.synchronization.async_rw_mutex.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/barrier_cpp20_test.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/tests.unit.modules.synchronization.barrier_cpp20.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/binary_semaphore_cpp20_test.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/tests.unit.modules.synchronization.binary_semaphore_cpp20.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/channel_mpmc_fib_test.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/tests.unit.modules.synchronization.channel_mpmc_fib.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/channel_mpmc_shift_test.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/tests.unit.modules.synchronization.channel_mpmc_shift.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/channel_mpsc_fib_test.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/tests.unit.modules.synchronization.channel_mpsc_fib.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/channel_mpsc_shift_test.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/tests.unit.modules.synchronization.channel_mpsc_shift.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/channel_spsc_fib_test.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/tests.unit.modules.synchronization.channel_spsc_fib.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/channel_spsc_shift_test.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/tests.unit.modules.synchronization.channel_spsc_shift.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/condition_variable_test.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/tests.unit.modules.synchronization.condition_variable.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/counting_semaphore_test.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/tests.unit.modules.synchronization.counting_semaphore.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/counting_semaphore_cpp20_test.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/tests.unit.modules.synchronization.counting_semaphore_cpp20.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/in_place_stop_token_test.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/tests.unit.modules.synchronization.in_place_stop_token.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/in_place_stop_token_cb2_test.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/tests.unit.modules.synchronization.in_place_stop_token_cb2.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/latch_cpp20_test.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/tests.unit.modules.synchronization.latch_cpp20.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/local_latch_test.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/tests.unit.modules.synchronization.local_latch.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/local_barrier_test.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/tests.unit.modules.synchronization.local_barrier.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/local_barrier_count_up_test.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/tests.unit.modules.synchronization.local_barrier_count_up.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/local_barrier_reset_test.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/tests.unit.modules.synchronization.local_barrier_reset.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/local_event_test.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/tests.unit.modules.synchronization.local_event.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/local_mutex_test.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/tests.unit.modules.synchronization.local_mutex.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/sliding_semaphore_test.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/tests.unit.modules.synchronization.sliding_semaphore.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/stop_token_test.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/tests.unit.modules.synchronization.stop_token.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/stop_token_cb2_test.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/tests.unit.modules.synchronization.stop_token_cb2.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/tests_unit_modules_synchronization_fail_compile_mutex_move.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/tests.unit.modules.synchronization.fail_compile_mutex_move.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/tests_unit_modules_synchronization_fail_compile_spinlock_move.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/tests.unit.modules.synchronization.fail_compile_spinlock_move.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/tests_unit_modules_synchronization_fail_compile_spinlock_no_backoff_move.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/tests.unit.modules.synchronization.fail_compile_spinlock_no_backoff_move.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/CMakeFiles/tests.unit.modules.synchronization.shared_mutex.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/shared_mutex/CMakeFiles/shared_mutex1_test.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/shared_mutex/CMakeFiles/tests.unit.modules.synchronization.shared_mutex.shared_mutex1.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/shared_mutex/CMakeFiles/shared_mutex2_test.dir/DependInfo.cmake"
+  "libs/core/synchronization/tests/unit/shared_mutex/CMakeFiles/tests.unit.modules.synchronization.shared_mutex.shared_mutex2.dir/DependInfo.cmake"
+  "libs/core/tag_invoke/CMakeFiles/hpx_tag_invoke.dir/DependInfo.cmake"
+  "libs/core/tag_invoke/tests/CMakeFiles/tests.unit.modules.tag_invoke.dir/DependInfo.cmake"
+  "libs/core/tag_invoke/tests/unit/CMakeFiles/tag_invoke_test.dir/DependInfo.cmake"
+  "libs/core/tag_invoke/tests/unit/CMakeFiles/tests.unit.modules.tag_invoke.tag_invoke.dir/DependInfo.cmake"
+  "libs/core/testing/CMakeFiles/hpx_testing.dir/DependInfo.cmake"
+  "libs/core/testing/tests/CMakeFiles/tests.unit.modules.testing.dir/DependInfo.cmake"
+  "libs/core/testing/tests/unit/CMakeFiles/test_macros_test.dir/DependInfo.cmake"
+  "libs/core/testing/tests/unit/CMakeFiles/tests.unit.modules.testing.test_macros.dir/DependInfo.cmake"
+  "libs/core/thread_pool_util/CMakeFiles/hpx_thread_pool_util.dir/DependInfo.cmake"
+  "libs/core/thread_pool_util/tests/CMakeFiles/tests.unit.modules.thread_pool_util.dir/DependInfo.cmake"
+  "libs/core/thread_pools/CMakeFiles/hpx_thread_pools.dir/DependInfo.cmake"
+  "libs/core/thread_pools/tests/CMakeFiles/tests.unit.modules.thread_pools.dir/DependInfo.cmake"
+  "libs/core/thread_support/CMakeFiles/hpx_thread_support.dir/DependInfo.cmake"
+  "libs/core/thread_support/tests/CMakeFiles/tests.unit.modules.thread_support.dir/DependInfo.cmake"
+  "libs/core/threading/CMakeFiles/hpx_threading.dir/DependInfo.cmake"
+  "libs/core/threading/tests/CMakeFiles/tests.unit.modules.threading.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/condition_variable2_test.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/tests.unit.modules.threading.condition_variable2.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/condition_variable3_test.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/tests.unit.modules.threading.condition_variable3.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/condition_variable4_test.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/tests.unit.modules.threading.condition_variable4.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/condition_variable_race_test.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/tests.unit.modules.threading.condition_variable_race.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/error_callback_test.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/tests.unit.modules.threading.error_callback.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/in_place_stop_token_cb1_test.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/tests.unit.modules.threading.in_place_stop_token_cb1.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/in_place_stop_token_race_test.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/tests.unit.modules.threading.in_place_stop_token_race.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/in_place_stop_token_race2_test.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/tests.unit.modules.threading.in_place_stop_token_race2.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/jthread1_test.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/tests.unit.modules.threading.jthread1.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/jthread2_test.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/tests.unit.modules.threading.jthread2.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/stack_check_test.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/tests.unit.modules.threading.stack_check.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/stop_token_cb1_test.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/tests.unit.modules.threading.stop_token_cb1.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/stop_token_race_test.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/tests.unit.modules.threading.stop_token_race.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/stop_token_race2_test.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/tests.unit.modules.threading.stop_token_race2.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/thread_test.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/tests.unit.modules.threading.thread.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/thread_id_test.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/tests.unit.modules.threading.thread_id.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/thread_launching_test.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/tests.unit.modules.threading.thread_launching.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/thread_mf_test.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/tests.unit.modules.threading.thread_mf.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/thread_yield_test.dir/DependInfo.cmake"
+  "libs/core/threading/tests/unit/CMakeFiles/tests.unit.modules.threading.thread_yield.dir/DependInfo.cmake"
+  "libs/core/threading_base/CMakeFiles/hpx_threading_base.dir/DependInfo.cmake"
+  "libs/core/threading_base/tests/CMakeFiles/tests.unit.modules.threading_base.dir/DependInfo.cmake"
+  "libs/core/threading_base/tests/unit/CMakeFiles/idle_parking_lot_test.dir/DependInfo.cmake"
+  "libs/core/threading_base/tests/unit/CMakeFiles/tests.unit.modules.threading_base.idle_parking_lot.dir/DependInfo.cmake"
+  "libs/core/threading_base/tests/unit/CMakeFiles/timer_wheel_test.dir/DependInfo.cmake"
+  "libs/core/threading_base/tests/unit/CMakeFiles/tests.unit.modules.threading_base.timer_wheel.dir/DependInfo.cmake"
+  "libs/core/threadmanager/CMakeFiles/hpx_threadmanager.dir/DependInfo.cmake"
+  "libs/core/threadmanager/tests/CMakeFiles/tests.unit.modules.threadmanager.dir/DependInfo.cmake"
+  "libs/core/timed_execution/CMakeFiles/hpx_timed_execution.dir/DependInfo.cmake"
+  "libs/core/timed_execution/tests/CMakeFiles/tests.unit.modules.timed_execution.dir/DependInfo.cmake"
+  "libs/core/timed_execution/tests/unit/CMakeFiles/minimal_timed_async_executor_test.dir/DependInfo.cmake"
+  "libs/core/timed_execution/tests/unit/CMakeFiles/tests.unit.modules.timed_execution.minimal_timed_async_executor.dir/DependInfo.cmake"
+  "libs/core/timed_execution/tests/unit/CMakeFiles/minimal_timed_sync_executor_test.dir/DependInfo.cmake"
+  "libs/core/timed_execution/tests/unit/CMakeFiles/tests.unit.modules.timed_execution.minimal_timed_sync_executor.dir/DependInfo.cmake"
+  "libs/core/timed_execution/tests/unit/CMakeFiles/timed_parallel_executor_test.dir/DependInfo.cmake"
+  "libs/core/timed_execution/tests/unit/CMakeFiles/tests.unit.modules.timed_execution.timed_parallel_executor.dir/DependInfo.cmake"
+  "libs/core/timing/CMakeFiles/hpx_timing.dir/DependInfo.cmake"
+  "libs/core/timing/tests/CMakeFiles/tests.unit.modules.timing.dir/DependInfo.cmake"
+  "libs/core/topology/CMakeFiles/hpx_topology.dir/DependInfo.cmake"
+  "libs/core/topology/tests/CMakeFiles/tests.unit.modules.topology.dir/DependInfo.cmake"
+  "libs/core/type_support/CMakeFiles/hpx_type_support.dir/DependInfo.cmake"
+  "libs/core/type_support/tests/CMakeFiles/tests.unit.modules.type_support.dir/DependInfo.cmake"
+  "libs/core/util/CMakeFiles/hpx_util.dir/DependInfo.cmake"
+  "libs/core/util/tests/CMakeFiles/tests.unit.modules.util.dir/DependInfo.cmake"
+  "libs/core/version/CMakeFiles/hpx_version.dir/DependInfo.cmake"
+  "libs/full/checkpoint_base/CMakeFiles/hpx_checkpoint_base.dir/DependInfo.cmake"
+  "libs/full/checkpoint_base/tests/CMakeFiles/tests.unit.modules.checkpoint_base.dir/DependInfo.cmake"
+  "libs/full/checkpoint_base/tests/unit/CMakeFiles/checkpoint_data_test.dir/DependInfo.cmake"
+  "libs/full/checkpoint_base/tests/unit/CMakeFiles/tests.unit.modules.checkpoint_base.checkpoint_data.dir/DependInfo.cmake"
+  "libs/full/command_line_handling/CMakeFiles/hpx_command_line_handling.dir/DependInfo.cmake"
+  "libs/full/command_line_handling/tests/CMakeFiles/tests.unit.modules.command_line_handling.dir/DependInfo.cmake"
+  "libs/full/compute/CMakeFiles/hpx_compute.dir/DependInfo.cmake"
+  "libs/full/compute/tests/CMakeFiles/tests.unit.modules.compute.dir/DependInfo.cmake"
+  "libs/full/init_runtime/CMakeFiles/hpx_init_runtime.dir/DependInfo.cmake"
+  "libs/full/init_runtime/tests/CMakeFiles/tests.unit.modules.init_runtime.dir/DependInfo.cmake"
+  "libs/full/init_runtime/tests/unit/CMakeFiles/runtime_type_test.dir/DependInfo.cmake"
+  "libs/full/init_runtime/tests/unit/CMakeFiles/tests.unit.modules.init_runtime.runtime_type.dir/DependInfo.cmake"
+  "libs/full/init_runtime/tests/unit/CMakeFiles/parcel_pool_test.dir/DependInfo.cmake"
+  "libs/full/init_runtime/tests/unit/CMakeFiles/tests.unit.modules.init_runtime.parcel_pool.dir/DependInfo.cmake"
+  "libs/full/init_runtime/tests/unit/CMakeFiles/shutdown_suspended_thread_test.dir/DependInfo.cmake"
+  "libs/full/init_runtime/tests/unit/CMakeFiles/tests.unit.modules.init_runtime.shutdown_suspended_thread.dir/DependInfo.cmake"
+  "libs/full/init_runtime/tests/unit/CMakeFiles/start_stop_callbacks_test.dir/DependInfo.cmake"
+  "libs/full/init_runtime/tests/unit/CMakeFiles/tests.unit.modules.init_runtime.start_stop_callbacks.dir/DependInfo.cmake"
+  "libs/full/parcelset/CMakeFiles/hpx_parcelset.dir/DependInfo.cmake"
+  "libs/full/parcelset/tests/CMakeFiles/tests.unit.modules.parcelset.dir/DependInfo.cmake"
+  "libs/full/parcelset_base/CMakeFiles/hpx_parcelset_base.dir/DependInfo.cmake"
+  "libs/full/parcelset_base/tests/CMakeFiles/tests.unit.modules.parcelset_base.dir/DependInfo.cmake"
+  "libs/full/plugin_factories/CMakeFiles/hpx_plugin_factories.dir/DependInfo.cmake"
+  "libs/full/plugin_factories/tests/CMakeFiles/tests.unit.modules.plugin_factories.dir/DependInfo.cmake"
+  "init/CMakeFiles/hpx_init.dir/DependInfo.cmake"
+  "wrap/CMakeFiles/hpx_wrap.dir/DependInfo.cmake"
+  "tests/unit/CMakeFiles/tests.unit.build.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/cmake_debug_build_dir_targets_test.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/cmake_debug_build_dir_macros_test.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/cmake_debug_install_dir_targets_test.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/cmake_debug_install_dir_macros_test.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/cmake_debug_build_dir_gtest_emulation_test.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/cmake_debug_install_dir_gtest_emulation_test.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/cmake_release_build_dir_targets_test.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/cmake_release_build_dir_macros_test.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/cmake_release_install_dir_targets_test.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/cmake_release_install_dir_macros_test.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/cmake_release_build_dir_gtest_emulation_test.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/cmake_release_install_dir_gtest_emulation_test.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/cmake_relwithdebinfo_build_dir_targets_test.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/cmake_relwithdebinfo_build_dir_macros_test.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/cmake_relwithdebinfo_install_dir_targets_test.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/cmake_relwithdebinfo_install_dir_macros_test.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/cmake_relwithdebinfo_build_dir_gtest_emulation_test.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/cmake_relwithdebinfo_install_dir_gtest_emulation_test.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/cmake_minsizerel_build_dir_targets_test.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/cmake_minsizerel_build_dir_macros_test.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/cmake_minsizerel_install_dir_targets_test.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/cmake_minsizerel_install_dir_macros_test.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/cmake_minsizerel_build_dir_gtest_emulation_test.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/cmake_minsizerel_install_dir_gtest_emulation_test.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/tests.unit.build.cmake.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/tests.unit.build.cmake.debug.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/tests.unit.build.cmake.debug.build_dir_targets.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/tests.unit.build.cmake.debug.install_dir_targets.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/tests.unit.build.cmake.debug.build_dir_macros.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/tests.unit.build.cmake.debug.install_dir_macros.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/tests.unit.build.cmake.debug.build_dir_gtest_emulation.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/tests.unit.build.cmake.debug.install_dir_gtest_emulation.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/tests.unit.build.cmake.release.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/tests.unit.build.cmake.release.build_dir_targets.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/tests.unit.build.cmake.release.install_dir_targets.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/tests.unit.build.cmake.release.build_dir_macros.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/tests.unit.build.cmake.release.install_dir_macros.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/tests.unit.build.cmake.release.build_dir_gtest_emulation.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/tests.unit.build.cmake.release.install_dir_gtest_emulation.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/tests.unit.build.cmake.relwithdebinfo.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/tests.unit.build.cmake.relwithdebinfo.build_dir_targets.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/tests.unit.build.cmake.relwithdebinfo.install_dir_targets.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/tests.unit.build.cmake.relwithdebinfo.build_dir_macros.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/tests.unit.build.cmake.relwithdebinfo.install_dir_macros.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/tests.unit.build.cmake.relwithdebinfo.build_dir_gtest_emulation.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/tests.unit.build.cmake.relwithdebinfo.install_dir_gtest_emulation.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/tests.unit.build.cmake.minsizerel.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/tests.unit.build.cmake.minsizerel.build_dir_targets.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/tests.unit.build.cmake.minsizerel.install_dir_targets.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/tests.unit.build.cmake.minsizerel.build_dir_macros.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/tests.unit.build.cmake.minsizerel.install_dir_macros.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/tests.unit.build.cmake.minsizerel.build_dir_gtest_emulation.dir/DependInfo.cmake"
+  "tests/unit/build/CMakeFiles/tests.unit.build.cmake.minsizerel.install_dir_gtest_emulation.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,60 @@
+//  Copyright (c) 2017-2019 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Do not edit this file! It has been generated by the cmake configuration step.
+
+#pragma once
+
+namespace hpx {
+
+    char const* const config_strings[] =
+    {
+        "HPX_FILESYSTEM_WITH_BOOST_FILESYSTEM_COMPATIBILITY=OFF",
+        "HPX_ITERATOR_SUPPORT_WITH_BOOST_ITERATOR_TRAVERSAL_TAG_COMPATIBILITY=OFF",
+        "HPX_WITH_AGAS_DUMP_REFCNT_ENTRIES=OFF",
+        "HPX_WITH_APEX=OFF",
+        "HPX_WITH_ASYNC_MPI=OFF",
+        "HPX_WITH_ATTACH_DEBUGGER_ON_TEST_FAILURE=OFF",
+        "HPX_WITH_AUTOMATIC_SERIALIZATION_REGISTRATION=ON",
+        "HPX_WITH_COROUTINE_COUNTERS=OFF",
+        "HPX_WITH_DATAPAR=ON",
+        "HPX_WITH_DYNAMIC_HPX_MAIN=ON",
+        "HPX_WITH_IO_POOL=ON",
+        "HPX_WITH_ITTNOTIFY=OFF",
+        "HPX_WITH_LOGGING=ON",
+        "HPX_WITH_NETWORKING=OFF",
+        "HPX_WITH_PAPI=OFF",
+        "HPX_WITH_PARALLEL_TESTS_BIND_NONE=OFF",
+        "HPX_WITH_SANITIZERS=OFF",
+        "HPX_WITH_SCHEDULER_LOCAL_STORAGE=OFF",
+        "HPX_WITH_SPINLOCK_DEADLOCK_DETECTION=OFF",
+        "HPX_WITH_STACKTRACES=ON",
+        "HPX_WITH_STACKTRACES_DEMANGLE_SYMBOLS=ON",
+        "HPX_WITH_STACKTRACES_STATIC_SYMBOLS=OFF",
+        "HPX_WITH_TESTS_DEBUG_LOG=OFF",
+        "HPX_WITH_THREAD_BACKTRACE_ON_SUSPENSION=OFF",
+        "HPX_WITH_THREAD_CREATION_AND_CLEANUP_RATES=OFF",
+        "HPX_WITH_THREAD_CUMULATIVE_COUNTS=ON",
+        "HPX_WITH_THREAD_DEBUG_INFO=OFF",
+        "HPX_WITH_THREAD_DESCRIPTION_FULL=OFF",
+        "HPX_WITH_THREAD_GUARD_PAGE=ON",
+        "HPX_WITH_THREAD_IDLE_RATES=OFF",
+        "HPX_WITH_THREAD_LOCAL_STORAGE=OFF",
+        "HPX_WITH_THREAD_MANAGER_IDLE_BACKOFF=ON",
+        "HPX_WITH_THREAD_QUEUE_WAITTIME=OFF",
+        "HPX_WITH_THREAD_STACK_MMAP=ON",
+        "HPX_WITH_THREAD_STEALING_COUNTS=OFF",
+        "HPX_WITH_THREAD_TARGET_ADDRESS=OFF",
+        "HPX_WITH_TIMER_POOL=ON",
+        "HPX_WITH_TUPLE_RVALUE_SWAP=ON",
+        "HPX_WITH_VALGRIND=OFF",
+        "HPX_WITH_VERIFY_LOCKS=OFF",
+        "HPX_WITH_VERIFY_LOCKS_BACKTRACE=OFF",
+        nullptr
+    };
+}
+
+
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/init/src/hpx_main.cpp" "init/CMakeFiles/hpx_init.dir/src/hpx_main.cpp.o" "gcc" "init/CMakeFiles/hpx_init.dir/src/hpx_main.cpp.o.d"
+  "/root/repo/init/src/hpx_main_argc_argv.cpp" "init/CMakeFiles/hpx_init.dir/src/hpx_main_argc_argv.cpp.o" "gcc" "init/CMakeFiles/hpx_init.dir/src/hpx_main_argc_argv.cpp.o.d"
+  "/root/repo/init/src/hpx_main_variables_map.cpp" "init/CMakeFiles/hpx_init.dir/src/hpx_main_variables_map.cpp.o" "gcc" "init/CMakeFiles/hpx_init.dir/src/hpx_main_variables_map.cpp.o.d"
+  "/root/repo/init/src/hpx_user_main.cpp" "init/CMakeFiles/hpx_init.dir/src/hpx_user_main.cpp.o" "gcc" "init/CMakeFiles/hpx_init.dir/src/hpx_user_main.cpp.o.d"
+  "/root/repo/init/src/hpx_user_main_argc_argv.cpp" "init/CMakeFiles/hpx_init.dir/src/hpx_user_main_argc_argv.cpp.o" "gcc" "init/CMakeFiles/hpx_init.dir/src/hpx_user_main_argc_argv.cpp.o.d"
+  "/root/repo/init/src/main.cpp" "init/CMakeFiles/hpx_init.dir/src/main.cpp.o" "gcc" "init/CMakeFiles/hpx_init.dir/src/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_simd_build/libs/CMakeFiles/hpx_full.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/CMakeFiles/hpx_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "../lib/libhpx_init.a"
+  "../lib/libhpx_init.pdb"
+  "CMakeFiles/hpx_init.dir/src/hpx_main.cpp.o"
+  "CMakeFiles/hpx_init.dir/src/hpx_main.cpp.o.d"
+  "CMakeFiles/hpx_init.dir/src/hpx_main_argc_argv.cpp.o"
+  "CMakeFiles/hpx_init.dir/src/hpx_main_argc_argv.cpp.o.d"
+  "CMakeFiles/hpx_init.dir/src/hpx_main_variables_map.cpp.o"
+  "CMakeFiles/hpx_init.dir/src/hpx_main_variables_map.cpp.o.d"
+  "CMakeFiles/hpx_init.dir/src/hpx_user_main.cpp.o"
+  "CMakeFiles/hpx_init.dir/src/hpx_user_main.cpp.o.d"
+  "CMakeFiles/hpx_init.dir/src/hpx_user_main_argc_argv.cpp.o"
+  "CMakeFiles/hpx_init.dir/src/hpx_user_main_argc_argv.cpp.o.d"
+  "CMakeFiles/hpx_init.dir/src/main.cpp.o"
+  "CMakeFiles/hpx_init.dir/src/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_init.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
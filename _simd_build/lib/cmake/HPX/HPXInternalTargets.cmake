@@ -0,0 +1,1284 @@
+# Generated by CMake
+
+if("${CMAKE_MAJOR_VERSION}.${CMAKE_MINOR_VERSION}" LESS 2.8)
+   message(FATAL_ERROR "CMake >= 2.8.0 required")
+endif()
+if(CMAKE_VERSION VERSION_LESS "2.8.3")
+   message(FATAL_ERROR "CMake >= 2.8.3 required")
+endif()
+cmake_policy(PUSH)
+cmake_policy(VERSION 2.8.3...3.23)
+#----------------------------------------------------------------
+# Generated CMake target import file.
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+if(CMAKE_VERSION VERSION_LESS 3.0.0)
+  message(FATAL_ERROR "This file relies on consumers using CMake 3.0.0 or greater.")
+endif()
+
+# Protect against multiple inclusion, which would fail when already imported targets are added once more.
+set(_cmake_targets_defined "")
+set(_cmake_targets_not_defined "")
+set(_cmake_expected_targets "")
+foreach(_cmake_expected_target IN ITEMS HPXInternal::hpx_private_flags HPXInternal::hpx_public_flags HPXInternal::hpx_full HPXInternal::hpx_interface HPXInternal::hpx_interface_wrap_main HPXInternal::hpx_core HPXInternal::hpx_affinity HPXInternal::hpx_algorithms HPXInternal::hpx_allocator_support HPXInternal::hpx_asio HPXInternal::hpx_assertion HPXInternal::hpx_async_base HPXInternal::hpx_async_combinators HPXInternal::hpx_async_local HPXInternal::hpx_batch_environments HPXInternal::hpx_cache HPXInternal::hpx_command_line_handling_local HPXInternal::hpx_compute_local HPXInternal::hpx_concepts HPXInternal::hpx_concurrency HPXInternal::hpx_config HPXInternal::hpx_config_registry HPXInternal::hpx_coroutines HPXInternal::hpx_datastructures HPXInternal::hpx_debugging HPXInternal::hpx_errors HPXInternal::hpx_execution HPXInternal::hpx_execution_base HPXInternal::hpx_executors HPXInternal::hpx_filesystem HPXInternal::hpx_format HPXInternal::hpx_functional HPXInternal::hpx_futures HPXInternal::hpx_hardware HPXInternal::hpx_hashing HPXInternal::hpx_include_local HPXInternal::hpx_ini HPXInternal::hpx_init_runtime_local HPXInternal::hpx_io_service HPXInternal::hpx_iterator_support HPXInternal::hpx_itt_notify HPXInternal::hpx_lcos_local HPXInternal::hpx_lock_registration HPXInternal::hpx_logging HPXInternal::hpx_memory HPXInternal::hpx_pack_traversal HPXInternal::hpx_plugin HPXInternal::hpx_prefix HPXInternal::hpx_preprocessor HPXInternal::hpx_program_options HPXInternal::hpx_properties HPXInternal::hpx_resiliency HPXInternal::hpx_resource_partitioner HPXInternal::hpx_runtime_configuration HPXInternal::hpx_runtime_local HPXInternal::hpx_schedulers HPXInternal::hpx_serialization HPXInternal::hpx_static_reinit HPXInternal::hpx_string_util HPXInternal::hpx_synchronization HPXInternal::hpx_tag_invoke HPXInternal::hpx_testing HPXInternal::hpx_thread_pool_util HPXInternal::hpx_thread_pools HPXInternal::hpx_thread_support HPXInternal::hpx_threading HPXInternal::hpx_threading_base HPXInternal::hpx_threadmanager HPXInternal::hpx_timed_execution HPXInternal::hpx_timing HPXInternal::hpx_topology HPXInternal::hpx_type_support HPXInternal::hpx_util HPXInternal::hpx_version HPXInternal::hpx_checkpoint_base HPXInternal::hpx_command_line_handling HPXInternal::hpx_compute HPXInternal::hpx_init_runtime HPXInternal::hpx_parcelset HPXInternal::hpx_parcelset_base HPXInternal::hpx_plugin_factories HPXInternal::hpx_init HPXInternal::hpx_wrap HPXInternal::hpx_base_libraries)
+  list(APPEND _cmake_expected_targets "${_cmake_expected_target}")
+  if(TARGET "${_cmake_expected_target}")
+    list(APPEND _cmake_targets_defined "${_cmake_expected_target}")
+  else()
+    list(APPEND _cmake_targets_not_defined "${_cmake_expected_target}")
+  endif()
+endforeach()
+unset(_cmake_expected_target)
+if(_cmake_targets_defined STREQUAL _cmake_expected_targets)
+  unset(_cmake_targets_defined)
+  unset(_cmake_targets_not_defined)
+  unset(_cmake_expected_targets)
+  unset(CMAKE_IMPORT_FILE_VERSION)
+  cmake_policy(POP)
+  return()
+endif()
+if(NOT _cmake_targets_defined STREQUAL "")
+  string(REPLACE ";" ", " _cmake_targets_defined_text "${_cmake_targets_defined}")
+  string(REPLACE ";" ", " _cmake_targets_not_defined_text "${_cmake_targets_not_defined}")
+  message(FATAL_ERROR "Some (but not all) targets in this export set were already defined.\nTargets Defined: ${_cmake_targets_defined_text}\nTargets not yet defined: ${_cmake_targets_not_defined_text}\n")
+endif()
+unset(_cmake_targets_defined)
+unset(_cmake_targets_not_defined)
+unset(_cmake_expected_targets)
+
+
+# Create imported target HPXInternal::hpx_private_flags
+add_library(HPXInternal::hpx_private_flags INTERFACE IMPORTED)
+
+set_target_properties(HPXInternal::hpx_private_flags PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "\$<\$<CONFIG:MinSizeRel>:NDEBUG>;\$<\$<CONFIG:Release>:NDEBUG>;\$<\$<CONFIG:RelWithDebInfo>:NDEBUG>"
+  INTERFACE_COMPILE_FEATURES "cxx_std_20"
+  INTERFACE_COMPILE_OPTIONS "\$<\$<COMPILE_LANGUAGE:CXX>:-Wall>;\$<\$<COMPILE_LANGUAGE:CXX>:-Wextra>;\$<\$<COMPILE_LANGUAGE:CXX>:-Wpedantic>;\$<\$<COMPILE_LANGUAGE:CXX>:-Wno-strict-aliasing>;\$<\$<COMPILE_LANGUAGE:CXX>:-Wno-sign-promo>;\$<\$<COMPILE_LANGUAGE:CXX>:-Wno-attributes>;\$<\$<COMPILE_LANGUAGE:CXX>:-Wno-cast-align>;\$<\$<COMPILE_LANGUAGE:CXX>:-Wno-interference-size>;\$<\$<COMPILE_LANGUAGE:CXX>:-Wno-noexcept-type>;\$<\$<COMPILE_LANGUAGE:CXX>:-Wformat=2>;\$<\$<COMPILE_LANGUAGE:CXX>:-Wno-format-nonliteral>;\$<\$<COMPILE_LANGUAGE:CXX>:-Winit-self>;\$<\$<COMPILE_LANGUAGE:CXX>:-Wdouble-promotion>;\$<\$<COMPILE_LANGUAGE:CXX>:-Wcast-qual>;\$<\$<COMPILE_LANGUAGE:CXX>:-Wcast-align>;\$<\$<COMPILE_LANGUAGE:CXX>:-Werror=trampolines>;\$<\$<COMPILE_LANGUAGE:CXX>:-Werror=parentheses>;\$<\$<COMPILE_LANGUAGE:CXX>:-Werror=reorder>;\$<\$<COMPILE_LANGUAGE:CXX>:-Werror=return-type>;\$<\$<COMPILE_LANGUAGE:CXX>:-Werror=sequence-point>;\$<\$<COMPILE_LANGUAGE:CXX>:-Werror=uninitialized>;\$<\$<COMPILE_LANGUAGE:CXX>:-Werror=format>;\$<\$<COMPILE_LANGUAGE:CXX>:-Werror=missing-braces>;\$<\$<COMPILE_LANGUAGE:CXX>:-Werror=sign-compare>;\$<\$<COMPILE_LANGUAGE:CXX>:-fdiagnostics-show-option>;\$<\$<COMPILE_LANGUAGE:CXX>:-Werror=vla>;\$<\$<COMPILE_LANGUAGE:CXX>:-Werror=return-type>;\$<\$<COMPILE_LANGUAGE:CXX>:-Wno-unused-but-set-parameter>;\$<\$<COMPILE_LANGUAGE:CXX>:-Wno-unused-but-set-variable>;\$<\$<COMPILE_LANGUAGE:CXX>:-Werror=uninitialized>;\$<\$<COMPILE_LANGUAGE:CXX>:-Wno-unused-local-typedefs>;\$<\$<COMPILE_LANGUAGE:CXX>:-Wno-maybe-uninitialized>;\$<\$<COMPILE_LANGUAGE:CXX>:-Wno-sync-nand>;\$<\$<COMPILE_LANGUAGE:CXX>:-Wno-delete-non-virtual-dtor>;\$<\$<COMPILE_LANGUAGE:CXX>:-fvisibility=hidden>"
+  INTERFACE_LINK_OPTIONS "\$<\$<STREQUAL:\$<TARGET_PROPERTY:TYPE>,SHARED_LIBRARY>:-Wl,-z,defs>;\$<\$<STREQUAL:\$<TARGET_PROPERTY:TYPE>,EXECUTABLE>:-Wl,-z,defs>;\$<\$<STREQUAL:\$<TARGET_PROPERTY:TYPE>,SHARED_LIBRARY>:-fvisibility=hidden>;\$<\$<STREQUAL:\$<TARGET_PROPERTY:TYPE>,EXECUTABLE>:-fvisibility=hidden>"
+)
+
+# Create imported target HPXInternal::hpx_public_flags
+add_library(HPXInternal::hpx_public_flags INTERFACE IMPORTED)
+
+set_target_properties(HPXInternal::hpx_public_flags PROPERTIES
+  INTERFACE_COMPILE_FEATURES "cxx_std_20"
+  INTERFACE_COMPILE_OPTIONS "\$<\$<COMPILE_LANGUAGE:CXX>:-pthread>"
+  INTERFACE_LINK_OPTIONS "-pthread"
+)
+
+# Create imported target HPXInternal::hpx_full
+add_library(HPXInternal::hpx_full SHARED IMPORTED)
+
+set_target_properties(HPXInternal::hpx_full PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo;/root/repo/_simd_build;/root/repo/libs/full/checkpoint_base/include;/root/repo/_simd_build/libs/full/checkpoint_base/include;/root/repo/libs/full/command_line_handling/include;/root/repo/_simd_build/libs/full/command_line_handling/include;/root/repo/_simd_build/libs/full/command_line_handling/include_compatibility;/root/repo/libs/full/compute/include;/root/repo/_simd_build/libs/full/compute/include;/root/repo/_simd_build/libs/full/compute/include_compatibility;/root/repo/libs/full/init_runtime/include;/root/repo/_simd_build/libs/full/init_runtime/include;/root/repo/libs/full/parcelset/include;/root/repo/_simd_build/libs/full/parcelset/include;/root/repo/_simd_build/libs/full/parcelset/include_compatibility;/root/repo/libs/full/parcelset_base/include;/root/repo/_simd_build/libs/full/parcelset_base/include;/root/repo/_simd_build/libs/full/parcelset_base/include_compatibility;/root/repo/libs/full/plugin_factories/include;/root/repo/_simd_build/libs/full/plugin_factories/include;/root/repo/_simd_build/libs/full/plugin_factories/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_public_flags;HPXInternal::hpx_core;hpx_dependencies_boost;HPXInternal::hpx_base_libraries"
+)
+
+# Create imported target HPXInternal::hpx_interface
+add_library(HPXInternal::hpx_interface INTERFACE IMPORTED)
+
+set_target_properties(HPXInternal::hpx_interface PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "\$<\$<STREQUAL:\$<TARGET_PROPERTY:TYPE>,EXECUTABLE>:HPX_APPLICATION_NAME_DEFAULT=\$<TARGET_PROPERTY:NAME>>;\$<\$<STREQUAL:\$<TARGET_PROPERTY:TYPE>,EXECUTABLE>:HPX_PREFIX_DEFAULT=\"/usr/local\">;\$<\$<STREQUAL:\$<TARGET_PROPERTY:TYPE>,EXECUTABLE>:HPX_APPLICATION_EXPORTS>;\$<\$<IN_LIST:\$<TARGET_PROPERTY:TYPE>,STATIC_LIBRARY;MODULE_LIBRARY;SHARED_LIBRARY;OBJECT_LIBRARY;INTERFACE_LIBRARY>:HPX_LIBRARY_EXPORTS>"
+  INTERFACE_LINK_LIBRARIES "\$<\$<STREQUAL:\$<TARGET_PROPERTY:TYPE>,EXECUTABLE>:HPXInternal::hpx_init>"
+)
+
+# Create imported target HPXInternal::hpx_interface_wrap_main
+add_library(HPXInternal::hpx_interface_wrap_main INTERFACE IMPORTED)
+
+set_target_properties(HPXInternal::hpx_interface_wrap_main PROPERTIES
+  INTERFACE_LINK_LIBRARIES "\$<\$<STREQUAL:\$<TARGET_PROPERTY:TYPE>,EXECUTABLE>:HPXInternal::hpx_wrap>"
+)
+
+# Create imported target HPXInternal::hpx_core
+add_library(HPXInternal::hpx_core SHARED IMPORTED)
+
+set_target_properties(HPXInternal::hpx_core PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/affinity/include;/root/repo/_simd_build/libs/core/affinity/include;/root/repo/_simd_build/libs/core/affinity/include_compatibility;/root/repo/libs/core/algorithms/include;/root/repo/_simd_build/libs/core/algorithms/include;/root/repo/_simd_build/libs/core/algorithms/include_compatibility;/root/repo/libs/core/allocator_support/include;/root/repo/_simd_build/libs/core/allocator_support/include;/root/repo/_simd_build/libs/core/allocator_support/include_compatibility;/root/repo/libs/core/asio/include;/root/repo/_simd_build/libs/core/asio/include;/root/repo/_simd_build/libs/core/asio/include_compatibility;/root/repo/libs/core/assertion/include;/root/repo/_simd_build/libs/core/assertion/include;/root/repo/_simd_build/libs/core/assertion/include_compatibility;/root/repo/libs/core/async_base/include;/root/repo/_simd_build/libs/core/async_base/include;/root/repo/_simd_build/libs/core/async_base/include_compatibility;/root/repo/libs/core/async_combinators/include;/root/repo/_simd_build/libs/core/async_combinators/include;/root/repo/_simd_build/libs/core/async_combinators/include_compatibility;/root/repo/libs/core/async_local/include;/root/repo/_simd_build/libs/core/async_local/include;/root/repo/libs/core/batch_environments/include;/root/repo/_simd_build/libs/core/batch_environments/include;/root/repo/_simd_build/libs/core/batch_environments/include_compatibility;/root/repo/libs/core/cache/include;/root/repo/_simd_build/libs/core/cache/include;/root/repo/_simd_build/libs/core/cache/include_compatibility;/root/repo/libs/core/command_line_handling_local/include;/root/repo/_simd_build/libs/core/command_line_handling_local/include;/root/repo/libs/core/compute_local/include;/root/repo/_simd_build/libs/core/compute_local/include;/root/repo/_simd_build/libs/core/compute_local/include_compatibility;/root/repo/libs/core/concepts/include;/root/repo/_simd_build/libs/core/concepts/include;/root/repo/_simd_build/libs/core/concepts/include_compatibility;/root/repo/libs/core/concurrency/include;/root/repo/_simd_build/libs/core/concurrency/include;/root/repo/_simd_build/libs/core/concurrency/include_compatibility;/root/repo/libs/core/config/include;/root/repo/_simd_build/libs/core/config/include;/root/repo/libs/core/config_registry/include;/root/repo/_simd_build/libs/core/config_registry/include;/root/repo/libs/core/coroutines/include;/root/repo/_simd_build/libs/core/coroutines/include;/root/repo/_simd_build/libs/core/coroutines/include_compatibility;/root/repo/libs/core/datastructures/include;/root/repo/_simd_build/libs/core/datastructures/include;/root/repo/_simd_build/libs/core/datastructures/include_compatibility;/root/repo/libs/core/debugging/include;/root/repo/_simd_build/libs/core/debugging/include;/root/repo/_simd_build/libs/core/debugging/include_compatibility;/root/repo/libs/core/errors/include;/root/repo/_simd_build/libs/core/errors/include;/root/repo/_simd_build/libs/core/errors/include_compatibility;/root/repo/libs/core/execution/include;/root/repo/_simd_build/libs/core/execution/include;/root/repo/_simd_build/libs/core/execution/include_compatibility;/root/repo/libs/core/execution_base/include;/root/repo/_simd_build/libs/core/execution_base/include;/root/repo/_simd_build/libs/core/execution_base/include_compatibility;/root/repo/libs/core/executors/include;/root/repo/_simd_build/libs/core/executors/include;/root/repo/_simd_build/libs/core/executors/include_compatibility;/root/repo/libs/core/filesystem/include;/root/repo/_simd_build/libs/core/filesystem/include;/root/repo/_simd_build/libs/core/filesystem/include_compatibility;/root/repo/libs/core/format/include;/root/repo/_simd_build/libs/core/format/include;/root/repo/_simd_build/libs/core/format/include_compatibility;/root/repo/libs/core/functional/include;/root/repo/_simd_build/libs/core/functional/include;/root/repo/_simd_build/libs/core/functional/include_compatibility;/root/repo/libs/core/futures/include;/root/repo/_simd_build/libs/core/futures/include;/root/repo/_simd_build/libs/core/futures/include_compatibility;/root/repo/libs/core/hardware/include;/root/repo/_simd_build/libs/core/hardware/include;/root/repo/_simd_build/libs/core/hardware/include_compatibility;/root/repo/libs/core/hashing/include;/root/repo/_simd_build/libs/core/hashing/include;/root/repo/_simd_build/libs/core/hashing/include_compatibility;/root/repo/libs/core/include_local/include;/root/repo/_simd_build/libs/core/include_local/include;/root/repo/libs/core/ini/include;/root/repo/_simd_build/libs/core/ini/include;/root/repo/libs/core/init_runtime_local/include;/root/repo/_simd_build/libs/core/init_runtime_local/include;/root/repo/libs/core/io_service/include;/root/repo/_simd_build/libs/core/io_service/include;/root/repo/_simd_build/libs/core/io_service/include_compatibility;/root/repo/libs/core/iterator_support/include;/root/repo/_simd_build/libs/core/iterator_support/include;/root/repo/_simd_build/libs/core/iterator_support/include_compatibility;/root/repo/libs/core/itt_notify/include;/root/repo/_simd_build/libs/core/itt_notify/include;/root/repo/_simd_build/libs/core/itt_notify/include_compatibility;/root/repo/libs/core/lcos_local/include;/root/repo/_simd_build/libs/core/lcos_local/include;/root/repo/_simd_build/libs/core/lcos_local/include_compatibility;/root/repo/libs/core/lock_registration/include;/root/repo/_simd_build/libs/core/lock_registration/include;/root/repo/libs/core/logging/include;/root/repo/_simd_build/libs/core/logging/include;/root/repo/_simd_build/libs/core/logging/include_compatibility;/root/repo/libs/core/memory/include;/root/repo/_simd_build/libs/core/memory/include;/root/repo/_simd_build/libs/core/memory/include_compatibility;/root/repo/libs/core/pack_traversal/include;/root/repo/_simd_build/libs/core/pack_traversal/include;/root/repo/_simd_build/libs/core/pack_traversal/include_compatibility;/root/repo/libs/core/plugin/include;/root/repo/_simd_build/libs/core/plugin/include;/root/repo/_simd_build/libs/core/plugin/include_compatibility;/root/repo/libs/core/prefix/include;/root/repo/_simd_build/libs/core/prefix/include;/root/repo/_simd_build/libs/core/prefix/include_compatibility;/root/repo/libs/core/preprocessor/include;/root/repo/_simd_build/libs/core/preprocessor/include;/root/repo/_simd_build/libs/core/preprocessor/include_compatibility;/root/repo/libs/core/program_options/include;/root/repo/_simd_build/libs/core/program_options/include;/root/repo/libs/core/properties/include;/root/repo/_simd_build/libs/core/properties/include;/root/repo/libs/core/resiliency/include;/root/repo/_simd_build/libs/core/resiliency/include;/root/repo/libs/core/resource_partitioner/include;/root/repo/_simd_build/libs/core/resource_partitioner/include;/root/repo/_simd_build/libs/core/resource_partitioner/include_compatibility;/root/repo/libs/core/runtime_configuration/include;/root/repo/_simd_build/libs/core/runtime_configuration/include;/root/repo/_simd_build/libs/core/runtime_configuration/include_compatibility;/root/repo/libs/core/runtime_local/include;/root/repo/_simd_build/libs/core/runtime_local/include;/root/repo/_simd_build/libs/core/runtime_local/include_compatibility;/root/repo/libs/core/schedulers/include;/root/repo/_simd_build/libs/core/schedulers/include;/root/repo/_simd_build/libs/core/schedulers/include_compatibility;/root/repo/libs/core/serialization/include;/root/repo/_simd_build/libs/core/serialization/include;/root/repo/_simd_build/libs/core/serialization/include_compatibility;/root/repo/libs/core/static_reinit/include;/root/repo/_simd_build/libs/core/static_reinit/include;/root/repo/_simd_build/libs/core/static_reinit/include_compatibility;/root/repo/libs/core/string_util/include;/root/repo/_simd_build/libs/core/string_util/include;/root/repo/libs/core/synchronization/include;/root/repo/_simd_build/libs/core/synchronization/include;/root/repo/_simd_build/libs/core/synchronization/include_compatibility;/root/repo/libs/core/tag_invoke/include;/root/repo/_simd_build/libs/core/tag_invoke/include;/root/repo/_simd_build/libs/core/tag_invoke/include_compatibility;/root/repo/libs/core/testing/include;/root/repo/_simd_build/libs/core/testing/include;/root/repo/_simd_build/libs/core/testing/include_compatibility;/root/repo/libs/core/thread_pool_util/include;/root/repo/_simd_build/libs/core/thread_pool_util/include;/root/repo/libs/core/thread_pools/include;/root/repo/_simd_build/libs/core/thread_pools/include;/root/repo/_simd_build/libs/core/thread_pools/include_compatibility;/root/repo/libs/core/thread_support/include;/root/repo/_simd_build/libs/core/thread_support/include;/root/repo/_simd_build/libs/core/thread_support/include_compatibility;/root/repo/libs/core/threading/include;/root/repo/_simd_build/libs/core/threading/include;/root/repo/_simd_build/libs/core/threading/include_compatibility;/root/repo/libs/core/threading_base/include;/root/repo/_simd_build/libs/core/threading_base/include;/root/repo/_simd_build/libs/core/threading_base/include_compatibility;/root/repo/libs/core/threadmanager/include;/root/repo/_simd_build/libs/core/threadmanager/include;/root/repo/_simd_build/libs/core/threadmanager/include_compatibility;/root/repo/libs/core/timed_execution/include;/root/repo/_simd_build/libs/core/timed_execution/include;/root/repo/_simd_build/libs/core/timed_execution/include_compatibility;/root/repo/libs/core/timing/include;/root/repo/_simd_build/libs/core/timing/include;/root/repo/_simd_build/libs/core/timing/include_compatibility;/root/repo/libs/core/topology/include;/root/repo/_simd_build/libs/core/topology/include;/root/repo/_simd_build/libs/core/topology/include_compatibility;/root/repo/libs/core/type_support/include;/root/repo/_simd_build/libs/core/type_support/include;/root/repo/_simd_build/libs/core/type_support/include_compatibility;/root/repo/libs/core/util/include;/root/repo/_simd_build/libs/core/util/include;/root/repo/_simd_build/libs/core/util/include_compatibility;/root/repo/libs/core/version/include;/root/repo/_simd_build/libs/core/version/include"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_public_flags;HPXInternal::hpx_base_libraries;hpx_dependencies_boost;hpx_dependencies_allocator;Hwloc::hwloc;Asio::asio"
+)
+
+# Create imported target HPXInternal::hpx_affinity
+add_library(HPXInternal::hpx_affinity STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_affinity PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/affinity/include;/root/repo/_simd_build/libs/core/affinity/include;/root/repo/_simd_build/libs/core/affinity/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_assertion;HPXInternal::hpx_config;HPXInternal::hpx_datastructures;HPXInternal::hpx_errors;HPXInternal::hpx_format;HPXInternal::hpx_topology;HPXInternal::hpx_util;Hwloc::hwloc;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_algorithms
+add_library(HPXInternal::hpx_algorithms STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_algorithms PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/algorithms/include;/root/repo/_simd_build/libs/core/algorithms/include;/root/repo/_simd_build/libs/core/algorithms/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_async_combinators;HPXInternal::hpx_async_local;HPXInternal::hpx_config;HPXInternal::hpx_execution;HPXInternal::hpx_executors;HPXInternal::hpx_filesystem;HPXInternal::hpx_futures;HPXInternal::hpx_lcos_local;HPXInternal::hpx_pack_traversal;HPXInternal::hpx_serialization;HPXInternal::hpx_util;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_allocator_support
+add_library(HPXInternal::hpx_allocator_support STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_allocator_support PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/allocator_support/include;/root/repo/_simd_build/libs/core/allocator_support/include;/root/repo/_simd_build/libs/core/allocator_support/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_concepts;HPXInternal::hpx_config;HPXInternal::hpx_preprocessor;hpx_dependencies_allocator;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_asio
+add_library(HPXInternal::hpx_asio STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_asio PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/asio/include;/root/repo/_simd_build/libs/core/asio/include;/root/repo/_simd_build/libs/core/asio/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_assertion;HPXInternal::hpx_config;HPXInternal::hpx_errors;HPXInternal::hpx_format;HPXInternal::hpx_functional;Asio::asio;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_assertion
+add_library(HPXInternal::hpx_assertion STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_assertion PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/assertion/include;/root/repo/_simd_build/libs/core/assertion/include;/root/repo/_simd_build/libs/core/assertion/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_config;HPXInternal::hpx_preprocessor;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_async_base
+add_library(HPXInternal::hpx_async_base STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_async_base PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/async_base/include;/root/repo/_simd_build/libs/core/async_base/include;/root/repo/_simd_build/libs/core/async_base/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_allocator_support;HPXInternal::hpx_concepts;HPXInternal::hpx_config;HPXInternal::hpx_coroutines;HPXInternal::hpx_tag_invoke;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_async_combinators
+add_library(HPXInternal::hpx_async_combinators STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_async_combinators PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/async_combinators/include;/root/repo/_simd_build/libs/core/async_combinators/include;/root/repo/_simd_build/libs/core/async_combinators/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_async_base;HPXInternal::hpx_config;HPXInternal::hpx_errors;HPXInternal::hpx_futures;HPXInternal::hpx_memory;HPXInternal::hpx_pack_traversal;HPXInternal::hpx_tag_invoke;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_async_local
+add_library(HPXInternal::hpx_async_local STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_async_local PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/async_local/include;/root/repo/_simd_build/libs/core/async_local/include"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_async_base;HPXInternal::hpx_execution;HPXInternal::hpx_executors;HPXInternal::hpx_config;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_batch_environments
+add_library(HPXInternal::hpx_batch_environments STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_batch_environments PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/batch_environments/include;/root/repo/_simd_build/libs/core/batch_environments/include;/root/repo/_simd_build/libs/core/batch_environments/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_config;HPXInternal::hpx_assertion;HPXInternal::hpx_format;HPXInternal::hpx_string_util;HPXInternal::hpx_errors;HPXInternal::hpx_asio;HPXInternal::hpx_type_support;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_cache
+add_library(HPXInternal::hpx_cache STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_cache PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/cache/include;/root/repo/_simd_build/libs/core/cache/include;/root/repo/_simd_build/libs/core/cache/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_config;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_command_line_handling_local
+add_library(HPXInternal::hpx_command_line_handling_local STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_command_line_handling_local PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/command_line_handling_local/include;/root/repo/_simd_build/libs/core/command_line_handling_local/include"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_config;HPXInternal::hpx_program_options;HPXInternal::hpx_runtime_configuration;HPXInternal::hpx_asio;HPXInternal::hpx_debugging;HPXInternal::hpx_errors;HPXInternal::hpx_filesystem;HPXInternal::hpx_format;HPXInternal::hpx_topology;HPXInternal::hpx_util;HPXInternal::hpx_version;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_compute_local
+add_library(HPXInternal::hpx_compute_local STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_compute_local PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/compute_local/include;/root/repo/_simd_build/libs/core/compute_local/include;/root/repo/_simd_build/libs/core/compute_local/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_algorithms;HPXInternal::hpx_allocator_support;HPXInternal::hpx_async_combinators;HPXInternal::hpx_concepts;HPXInternal::hpx_config;HPXInternal::hpx_datastructures;HPXInternal::hpx_execution;HPXInternal::hpx_executors;HPXInternal::hpx_functional;HPXInternal::hpx_futures;HPXInternal::hpx_iterator_support;HPXInternal::hpx_resource_partitioner;HPXInternal::hpx_runtime_local;HPXInternal::hpx_serialization;HPXInternal::hpx_threadmanager;HPXInternal::hpx_topology;HPXInternal::hpx_type_support;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_concepts
+add_library(HPXInternal::hpx_concepts STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_concepts PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/concepts/include;/root/repo/_simd_build/libs/core/concepts/include;/root/repo/_simd_build/libs/core/concepts/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_config;HPXInternal::hpx_preprocessor;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_concurrency
+add_library(HPXInternal::hpx_concurrency STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_concurrency PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/concurrency/include;/root/repo/_simd_build/libs/core/concurrency/include;/root/repo/_simd_build/libs/core/concurrency/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_assertion;HPXInternal::hpx_concepts;HPXInternal::hpx_config;HPXInternal::hpx_datastructures;HPXInternal::hpx_execution_base;HPXInternal::hpx_errors;HPXInternal::hpx_hashing;HPXInternal::hpx_itt_notify;HPXInternal::hpx_lock_registration;HPXInternal::hpx_thread_support;HPXInternal::hpx_version;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_config
+add_library(HPXInternal::hpx_config STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_config PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/config/include;/root/repo/_simd_build/libs/core/config/include"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_preprocessor;hpx_dependencies_boost;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_config_registry
+add_library(HPXInternal::hpx_config_registry STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_config_registry PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/config_registry/include;/root/repo/_simd_build/libs/core/config_registry/include"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries"
+)
+
+# Create imported target HPXInternal::hpx_coroutines
+add_library(HPXInternal::hpx_coroutines STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_coroutines PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/coroutines/include;/root/repo/_simd_build/libs/core/coroutines/include;/root/repo/_simd_build/libs/core/coroutines/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_assertion;HPXInternal::hpx_config;HPXInternal::hpx_debugging;HPXInternal::hpx_errors;HPXInternal::hpx_format;HPXInternal::hpx_functional;HPXInternal::hpx_memory;HPXInternal::hpx_thread_support;HPXInternal::hpx_type_support;HPXInternal::hpx_util;HPXInternal::hpx_version;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_datastructures
+add_library(HPXInternal::hpx_datastructures STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_datastructures PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/datastructures/include;/root/repo/_simd_build/libs/core/datastructures/include;/root/repo/_simd_build/libs/core/datastructures/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_assertion;HPXInternal::hpx_config;HPXInternal::hpx_concepts;HPXInternal::hpx_errors;HPXInternal::hpx_serialization;HPXInternal::hpx_type_support;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_debugging
+add_library(HPXInternal::hpx_debugging STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_debugging PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/debugging/include;/root/repo/_simd_build/libs/core/debugging/include;/root/repo/_simd_build/libs/core/debugging/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_config;Asio::asio;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_errors
+add_library(HPXInternal::hpx_errors STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_errors PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/errors/include;/root/repo/_simd_build/libs/core/errors/include;/root/repo/_simd_build/libs/core/errors/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_assertion;HPXInternal::hpx_config;HPXInternal::hpx_filesystem;HPXInternal::hpx_format;HPXInternal::hpx_logging;HPXInternal::hpx_preprocessor;HPXInternal::hpx_thread_support;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_execution
+add_library(HPXInternal::hpx_execution STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_execution PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/execution/include;/root/repo/_simd_build/libs/core/execution/include;/root/repo/_simd_build/libs/core/execution/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_async_base;HPXInternal::hpx_async_combinators;HPXInternal::hpx_config;HPXInternal::hpx_threading;HPXInternal::hpx_pack_traversal;HPXInternal::hpx_errors;HPXInternal::hpx_lock_registration;HPXInternal::hpx_memory;HPXInternal::hpx_synchronization;HPXInternal::hpx_thread_support;HPXInternal::hpx_timing;HPXInternal::hpx_topology;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_execution_base
+add_library(HPXInternal::hpx_execution_base STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_execution_base PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/execution_base/include;/root/repo/_simd_build/libs/core/execution_base/include;/root/repo/_simd_build/libs/core/execution_base/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_assertion;HPXInternal::hpx_config;HPXInternal::hpx_errors;HPXInternal::hpx_format;HPXInternal::hpx_functional;HPXInternal::hpx_iterator_support;HPXInternal::hpx_lock_registration;HPXInternal::hpx_timing;HPXInternal::hpx_type_support;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_executors
+add_library(HPXInternal::hpx_executors STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_executors PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/executors/include;/root/repo/_simd_build/libs/core/executors/include;/root/repo/_simd_build/libs/core/executors/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_allocator_support;HPXInternal::hpx_async_base;HPXInternal::hpx_concepts;HPXInternal::hpx_config;HPXInternal::hpx_errors;HPXInternal::hpx_execution;HPXInternal::hpx_format;HPXInternal::hpx_functional;HPXInternal::hpx_futures;HPXInternal::hpx_hardware;HPXInternal::hpx_io_service;HPXInternal::hpx_itt_notify;HPXInternal::hpx_memory;HPXInternal::hpx_properties;HPXInternal::hpx_resource_partitioner;HPXInternal::hpx_threading;HPXInternal::hpx_topology;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_filesystem
+add_library(HPXInternal::hpx_filesystem STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_filesystem PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/filesystem/include;/root/repo/_simd_build/libs/core/filesystem/include;/root/repo/_simd_build/libs/core/filesystem/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_config;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_format
+add_library(HPXInternal::hpx_format STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_format PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/format/include;/root/repo/_simd_build/libs/core/format/include;/root/repo/_simd_build/libs/core/format/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_assertion;HPXInternal::hpx_config;HPXInternal::hpx_type_support;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_functional
+add_library(HPXInternal::hpx_functional STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_functional PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/functional/include;/root/repo/_simd_build/libs/core/functional/include;/root/repo/_simd_build/libs/core/functional/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_assertion;HPXInternal::hpx_config;HPXInternal::hpx_datastructures;HPXInternal::hpx_debugging;HPXInternal::hpx_errors;HPXInternal::hpx_itt_notify;HPXInternal::hpx_serialization;HPXInternal::hpx_tag_invoke;HPXInternal::hpx_type_support;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_futures
+add_library(HPXInternal::hpx_futures STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_futures PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/futures/include;/root/repo/_simd_build/libs/core/futures/include;/root/repo/_simd_build/libs/core/futures/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_allocator_support;HPXInternal::hpx_assertion;HPXInternal::hpx_async_base;HPXInternal::hpx_concepts;HPXInternal::hpx_config;HPXInternal::hpx_errors;HPXInternal::hpx_functional;HPXInternal::hpx_memory;HPXInternal::hpx_serialization;HPXInternal::hpx_synchronization;HPXInternal::hpx_timing;HPXInternal::hpx_type_support;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_hardware
+add_library(HPXInternal::hpx_hardware STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_hardware PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/hardware/include;/root/repo/_simd_build/libs/core/hardware/include;/root/repo/_simd_build/libs/core/hardware/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_config;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_hashing
+add_library(HPXInternal::hpx_hashing STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_hashing PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/hashing/include;/root/repo/_simd_build/libs/core/hashing/include;/root/repo/_simd_build/libs/core/hashing/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_config;HPXInternal::hpx_serialization;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_include_local
+add_library(HPXInternal::hpx_include_local STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_include_local PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/include_local/include;/root/repo/_simd_build/libs/core/include_local/include"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_algorithms;HPXInternal::hpx_async_base;HPXInternal::hpx_async_combinators;HPXInternal::hpx_async_local;HPXInternal::hpx_compute_local;HPXInternal::hpx_errors;HPXInternal::hpx_execution;HPXInternal::hpx_executors;HPXInternal::hpx_futures;HPXInternal::hpx_lcos_local;HPXInternal::hpx_runtime_local;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_ini
+add_library(HPXInternal::hpx_ini STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_ini PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/ini/include;/root/repo/_simd_build/libs/core/ini/include"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_assertion;HPXInternal::hpx_config;HPXInternal::hpx_errors;HPXInternal::hpx_serialization;HPXInternal::hpx_string_util;HPXInternal::hpx_thread_support;HPXInternal::hpx_concurrency;HPXInternal::hpx_functional;HPXInternal::hpx_util;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_init_runtime_local
+add_library(HPXInternal::hpx_init_runtime_local STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_init_runtime_local PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/init_runtime_local/include;/root/repo/_simd_build/libs/core/init_runtime_local/include"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_algorithms;HPXInternal::hpx_command_line_handling_local;HPXInternal::hpx_program_options;HPXInternal::hpx_runtime_local;HPXInternal::hpx_errors;HPXInternal::hpx_filesystem;HPXInternal::hpx_format;HPXInternal::hpx_lock_registration;HPXInternal::hpx_logging;HPXInternal::hpx_schedulers;HPXInternal::hpx_testing;HPXInternal::hpx_threading_base;HPXInternal::hpx_timing;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_io_service
+add_library(HPXInternal::hpx_io_service STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_io_service PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/io_service/include;/root/repo/_simd_build/libs/core/io_service/include;/root/repo/_simd_build/libs/core/io_service/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_assertion;HPXInternal::hpx_concurrency;HPXInternal::hpx_config;HPXInternal::hpx_errors;HPXInternal::hpx_functional;HPXInternal::hpx_logging;HPXInternal::hpx_threading_base;HPXInternal::hpx_timing;Asio::asio;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_iterator_support
+add_library(HPXInternal::hpx_iterator_support STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_iterator_support PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/iterator_support/include;/root/repo/_simd_build/libs/core/iterator_support/include;/root/repo/_simd_build/libs/core/iterator_support/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_config;HPXInternal::hpx_datastructures;HPXInternal::hpx_functional;HPXInternal::hpx_serialization;HPXInternal::hpx_type_support;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_itt_notify
+add_library(HPXInternal::hpx_itt_notify STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_itt_notify PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/itt_notify/include;/root/repo/_simd_build/libs/core/itt_notify/include;/root/repo/_simd_build/libs/core/itt_notify/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_config;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_lcos_local
+add_library(HPXInternal::hpx_lcos_local STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_lcos_local PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/lcos_local/include;/root/repo/_simd_build/libs/core/lcos_local/include;/root/repo/_simd_build/libs/core/lcos_local/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_config;HPXInternal::hpx_execution;HPXInternal::hpx_executors;HPXInternal::hpx_futures;HPXInternal::hpx_lock_registration;HPXInternal::hpx_pack_traversal;HPXInternal::hpx_errors;HPXInternal::hpx_memory;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_lock_registration
+add_library(HPXInternal::hpx_lock_registration STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_lock_registration PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/lock_registration/include;/root/repo/_simd_build/libs/core/lock_registration/include"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_assertion;HPXInternal::hpx_concepts;HPXInternal::hpx_config;HPXInternal::hpx_errors;HPXInternal::hpx_functional;HPXInternal::hpx_type_support;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_logging
+add_library(HPXInternal::hpx_logging STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_logging PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/logging/include;/root/repo/_simd_build/libs/core/logging/include;/root/repo/_simd_build/libs/core/logging/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_assertion;HPXInternal::hpx_config;HPXInternal::hpx_format;HPXInternal::hpx_filesystem;HPXInternal::hpx_format;HPXInternal::hpx_timing;HPXInternal::hpx_thread_support;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_memory
+add_library(HPXInternal::hpx_memory STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_memory PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/memory/include;/root/repo/_simd_build/libs/core/memory/include;/root/repo/_simd_build/libs/core/memory/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_config;HPXInternal::hpx_assertion;HPXInternal::hpx_serialization;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_pack_traversal
+add_library(HPXInternal::hpx_pack_traversal STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_pack_traversal PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/pack_traversal/include;/root/repo/_simd_build/libs/core/pack_traversal/include;/root/repo/_simd_build/libs/core/pack_traversal/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_futures;HPXInternal::hpx_memory;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_plugin
+add_library(HPXInternal::hpx_plugin STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_plugin PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/plugin/include;/root/repo/_simd_build/libs/core/plugin/include;/root/repo/_simd_build/libs/core/plugin/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_assertion;HPXInternal::hpx_config;HPXInternal::hpx_errors;HPXInternal::hpx_datastructures;HPXInternal::hpx_filesystem;HPXInternal::hpx_format;HPXInternal::hpx_functional;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_prefix
+add_library(HPXInternal::hpx_prefix STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_prefix PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/prefix/include;/root/repo/_simd_build/libs/core/prefix/include;/root/repo/_simd_build/libs/core/prefix/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_assertion;HPXInternal::hpx_config;HPXInternal::hpx_errors;HPXInternal::hpx_filesystem;HPXInternal::hpx_plugin;HPXInternal::hpx_string_util;HPXInternal::hpx_type_support;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_preprocessor
+add_library(HPXInternal::hpx_preprocessor STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_preprocessor PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/preprocessor/include;/root/repo/_simd_build/libs/core/preprocessor/include;/root/repo/_simd_build/libs/core/preprocessor/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_program_options
+add_library(HPXInternal::hpx_program_options STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_program_options PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/program_options/include;/root/repo/_simd_build/libs/core/program_options/include"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_config;HPXInternal::hpx_datastructures;HPXInternal::hpx_format;HPXInternal::hpx_iterator_support;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_properties
+add_library(HPXInternal::hpx_properties STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_properties PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/properties/include;/root/repo/_simd_build/libs/core/properties/include"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_tag_invoke;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_resiliency
+add_library(HPXInternal::hpx_resiliency STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_resiliency PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/resiliency/include;/root/repo/_simd_build/libs/core/resiliency/include"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_async_local;HPXInternal::hpx_execution;HPXInternal::hpx_futures;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_resource_partitioner
+add_library(HPXInternal::hpx_resource_partitioner STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_resource_partitioner PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/resource_partitioner/include;/root/repo/_simd_build/libs/core/resource_partitioner/include;/root/repo/_simd_build/libs/core/resource_partitioner/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_affinity;HPXInternal::hpx_config;HPXInternal::hpx_runtime_configuration;HPXInternal::hpx_errors;HPXInternal::hpx_format;HPXInternal::hpx_ini;HPXInternal::hpx_prefix;HPXInternal::hpx_threading_base;HPXInternal::hpx_synchronization;HPXInternal::hpx_thread_pools;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_runtime_configuration
+add_library(HPXInternal::hpx_runtime_configuration STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_runtime_configuration PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/runtime_configuration/include;/root/repo/_simd_build/libs/core/runtime_configuration/include;/root/repo/_simd_build/libs/core/runtime_configuration/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_program_options;HPXInternal::hpx_errors;HPXInternal::hpx_filesystem;HPXInternal::hpx_itt_notify;HPXInternal::hpx_logging;HPXInternal::hpx_plugin;HPXInternal::hpx_ini;HPXInternal::hpx_prefix;HPXInternal::hpx_coroutines;HPXInternal::hpx_version;HPXInternal::hpx_synchronization;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_runtime_local
+add_library(HPXInternal::hpx_runtime_local STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_runtime_local PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/runtime_local/include;/root/repo/_simd_build/libs/core/runtime_local/include;/root/repo/_simd_build/libs/core/runtime_local/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_command_line_handling_local;HPXInternal::hpx_debugging;HPXInternal::hpx_errors;HPXInternal::hpx_execution;HPXInternal::hpx_format;HPXInternal::hpx_futures;HPXInternal::hpx_io_service;HPXInternal::hpx_logging;HPXInternal::hpx_plugin;HPXInternal::hpx_program_options;HPXInternal::hpx_resource_partitioner;HPXInternal::hpx_runtime_configuration;HPXInternal::hpx_static_reinit;HPXInternal::hpx_threading;HPXInternal::hpx_threading_base;HPXInternal::hpx_threadmanager;HPXInternal::hpx_timing;HPXInternal::hpx_topology;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_schedulers
+add_library(HPXInternal::hpx_schedulers STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_schedulers PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/schedulers/include;/root/repo/_simd_build/libs/core/schedulers/include;/root/repo/_simd_build/libs/core/schedulers/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_config;HPXInternal::hpx_assertion;HPXInternal::hpx_errors;HPXInternal::hpx_format;HPXInternal::hpx_functional;HPXInternal::hpx_logging;HPXInternal::hpx_threading_base;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_serialization
+add_library(HPXInternal::hpx_serialization STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_serialization PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/serialization/include;/root/repo/_simd_build/libs/core/serialization/include;/root/repo/_simd_build/libs/core/serialization/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_assertion;HPXInternal::hpx_config;HPXInternal::hpx_debugging;HPXInternal::hpx_errors;HPXInternal::hpx_format;HPXInternal::hpx_preprocessor;HPXInternal::hpx_type_support;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_static_reinit
+add_library(HPXInternal::hpx_static_reinit STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_static_reinit PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/static_reinit/include;/root/repo/_simd_build/libs/core/static_reinit/include;/root/repo/_simd_build/libs/core/static_reinit/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_config;HPXInternal::hpx_assertion;HPXInternal::hpx_concurrency;HPXInternal::hpx_functional;HPXInternal::hpx_type_support;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_string_util
+add_library(HPXInternal::hpx_string_util STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_string_util PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/string_util/include;/root/repo/_simd_build/libs/core/string_util/include"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_synchronization
+add_library(HPXInternal::hpx_synchronization STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_synchronization PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/synchronization/include;/root/repo/_simd_build/libs/core/synchronization/include;/root/repo/_simd_build/libs/core/synchronization/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_config;HPXInternal::hpx_assertion;HPXInternal::hpx_execution_base;HPXInternal::hpx_concurrency;HPXInternal::hpx_coroutines;HPXInternal::hpx_errors;HPXInternal::hpx_functional;HPXInternal::hpx_hashing;HPXInternal::hpx_itt_notify;HPXInternal::hpx_memory;HPXInternal::hpx_lock_registration;HPXInternal::hpx_logging;HPXInternal::hpx_memory;HPXInternal::hpx_threading_base;HPXInternal::hpx_thread_support;HPXInternal::hpx_topology;HPXInternal::hpx_timing;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_tag_invoke
+add_library(HPXInternal::hpx_tag_invoke STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_tag_invoke PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/tag_invoke/include;/root/repo/_simd_build/libs/core/tag_invoke/include;/root/repo/_simd_build/libs/core/tag_invoke/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_config;HPXInternal::hpx_type_support;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_testing
+add_library(HPXInternal::hpx_testing STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_testing PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/testing/include;/root/repo/_simd_build/libs/core/testing/include;/root/repo/_simd_build/libs/core/testing/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_assertion;HPXInternal::hpx_config;HPXInternal::hpx_format;HPXInternal::hpx_functional;HPXInternal::hpx_preprocessor;HPXInternal::hpx_util;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_thread_pool_util
+add_library(HPXInternal::hpx_thread_pool_util STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_thread_pool_util PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/thread_pool_util/include;/root/repo/_simd_build/libs/core/thread_pool_util/include"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_async_local;HPXInternal::hpx_futures;HPXInternal::hpx_functional;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_thread_pools
+add_library(HPXInternal::hpx_thread_pools STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_thread_pools PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/thread_pools/include;/root/repo/_simd_build/libs/core/thread_pools/include;/root/repo/_simd_build/libs/core/thread_pools/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_assertion;HPXInternal::hpx_config;HPXInternal::hpx_debugging;HPXInternal::hpx_errors;HPXInternal::hpx_itt_notify;HPXInternal::hpx_logging;HPXInternal::hpx_schedulers;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_thread_support
+add_library(HPXInternal::hpx_thread_support STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_thread_support PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/thread_support/include;/root/repo/_simd_build/libs/core/thread_support/include;/root/repo/_simd_build/libs/core/thread_support/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_assertion;HPXInternal::hpx_config;HPXInternal::hpx_concepts;HPXInternal::hpx_type_support;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_threading
+add_library(HPXInternal::hpx_threading STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_threading PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/threading/include;/root/repo/_simd_build/libs/core/threading/include;/root/repo/_simd_build/libs/core/threading/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_errors;HPXInternal::hpx_futures;HPXInternal::hpx_lock_registration;HPXInternal::hpx_memory;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_threading_base
+add_library(HPXInternal::hpx_threading_base STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_threading_base PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/threading_base/include;/root/repo/_simd_build/libs/core/threading_base/include;/root/repo/_simd_build/libs/core/threading_base/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_affinity;HPXInternal::hpx_allocator_support;HPXInternal::hpx_assertion;HPXInternal::hpx_execution_base;HPXInternal::hpx_config;HPXInternal::hpx_concurrency;HPXInternal::hpx_coroutines;HPXInternal::hpx_debugging;HPXInternal::hpx_errors;HPXInternal::hpx_format;HPXInternal::hpx_functional;HPXInternal::hpx_hardware;HPXInternal::hpx_itt_notify;HPXInternal::hpx_lock_registration;HPXInternal::hpx_logging;HPXInternal::hpx_memory;HPXInternal::hpx_timing;HPXInternal::hpx_type_support;Asio::asio;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_threadmanager
+add_library(HPXInternal::hpx_threadmanager STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_threadmanager PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/threadmanager/include;/root/repo/_simd_build/libs/core/threadmanager/include;/root/repo/_simd_build/libs/core/threadmanager/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_program_options;HPXInternal::hpx_resource_partitioner;HPXInternal::hpx_runtime_configuration;HPXInternal::hpx_errors;HPXInternal::hpx_logging;HPXInternal::hpx_schedulers;HPXInternal::hpx_async_combinators;HPXInternal::hpx_thread_pools;HPXInternal::hpx_io_service;HPXInternal::hpx_thread_pool_util;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_timed_execution
+add_library(HPXInternal::hpx_timed_execution STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_timed_execution PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/timed_execution/include;/root/repo/_simd_build/libs/core/timed_execution/include;/root/repo/_simd_build/libs/core/timed_execution/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_concepts;HPXInternal::hpx_execution;HPXInternal::hpx_executors;HPXInternal::hpx_threading;HPXInternal::hpx_timing;HPXInternal::hpx_topology;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_timing
+add_library(HPXInternal::hpx_timing STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_timing PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/timing/include;/root/repo/_simd_build/libs/core/timing/include;/root/repo/_simd_build/libs/core/timing/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_config;HPXInternal::hpx_hardware;HPXInternal::hpx_type_support;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_topology
+add_library(HPXInternal::hpx_topology STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_topology PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/topology/include;/root/repo/_simd_build/libs/core/topology/include;/root/repo/_simd_build/libs/core/topology/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_assertion;HPXInternal::hpx_async_base;HPXInternal::hpx_config;HPXInternal::hpx_concurrency;HPXInternal::hpx_errors;HPXInternal::hpx_format;HPXInternal::hpx_logging;HPXInternal::hpx_type_support;HPXInternal::hpx_util;Hwloc::hwloc;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_type_support
+add_library(HPXInternal::hpx_type_support STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_type_support PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/type_support/include;/root/repo/_simd_build/libs/core/type_support/include;/root/repo/_simd_build/libs/core/type_support/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_assertion;HPXInternal::hpx_concepts;HPXInternal::hpx_config;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_util
+add_library(HPXInternal::hpx_util STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_util PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/util/include;/root/repo/_simd_build/libs/core/util/include;/root/repo/_simd_build/libs/core/util/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_config;HPXInternal::hpx_concepts;HPXInternal::hpx_errors;HPXInternal::hpx_format;HPXInternal::hpx_iterator_support;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_version
+add_library(HPXInternal::hpx_version STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_version PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/core/version/include;/root/repo/_simd_build/libs/core/version/include"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_config;HPXInternal::hpx_config_registry;HPXInternal::hpx_format;HPXInternal::hpx_prefix;HPXInternal::hpx_config;HPXInternal::hpx_format;HPXInternal::hpx_prefix;Hwloc::hwloc;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries;HPXInternal::hpx_config_registry"
+)
+
+# Create imported target HPXInternal::hpx_checkpoint_base
+add_library(HPXInternal::hpx_checkpoint_base STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_checkpoint_base PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/full/checkpoint_base/include;/root/repo/_simd_build/libs/full/checkpoint_base/include"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_core;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries"
+)
+
+# Create imported target HPXInternal::hpx_command_line_handling
+add_library(HPXInternal::hpx_command_line_handling STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_command_line_handling PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/full/command_line_handling/include;/root/repo/_simd_build/libs/full/command_line_handling/include;/root/repo/_simd_build/libs/full/command_line_handling/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_core;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries"
+)
+
+# Create imported target HPXInternal::hpx_compute
+add_library(HPXInternal::hpx_compute STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_compute PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/full/compute/include;/root/repo/_simd_build/libs/full/compute/include;/root/repo/_simd_build/libs/full/compute/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_core;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries"
+)
+
+# Create imported target HPXInternal::hpx_init_runtime
+add_library(HPXInternal::hpx_init_runtime STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_init_runtime PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/full/init_runtime/include;/root/repo/_simd_build/libs/full/init_runtime/include"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_command_line_handling;HPXInternal::hpx_core;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries"
+)
+
+# Create imported target HPXInternal::hpx_parcelset
+add_library(HPXInternal::hpx_parcelset STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_parcelset PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/full/parcelset/include;/root/repo/_simd_build/libs/full/parcelset/include;/root/repo/_simd_build/libs/full/parcelset/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_parcelset_base;HPXInternal::hpx_plugin_factories;HPXInternal::hpx_core;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries"
+)
+
+# Create imported target HPXInternal::hpx_parcelset_base
+add_library(HPXInternal::hpx_parcelset_base STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_parcelset_base PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/full/parcelset_base/include;/root/repo/_simd_build/libs/full/parcelset_base/include;/root/repo/_simd_build/libs/full/parcelset_base/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_core;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries"
+)
+
+# Create imported target HPXInternal::hpx_plugin_factories
+add_library(HPXInternal::hpx_plugin_factories STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_plugin_factories PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/libs/full/plugin_factories/include;/root/repo/_simd_build/libs/full/plugin_factories/include;/root/repo/_simd_build/libs/full/plugin_factories/include_compatibility"
+  INTERFACE_LINK_LIBRARIES "HPXInternal::hpx_command_line_handling;HPXInternal::hpx_parcelset_base;HPXInternal::hpx_core;HPXInternal::hpx_public_flags;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;HPXInternal::hpx_base_libraries"
+)
+
+# Create imported target HPXInternal::hpx_init
+add_library(HPXInternal::hpx_init STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_init PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/init/include"
+  INTERFACE_LINK_LIBRARIES "\$<LINK_ONLY:HPXInternal::hpx_full>;\$<LINK_ONLY:HPXInternal::hpx_private_flags>"
+)
+
+# Create imported target HPXInternal::hpx_wrap
+add_library(HPXInternal::hpx_wrap STATIC IMPORTED)
+
+set_target_properties(HPXInternal::hpx_wrap PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/wrap/include"
+  INTERFACE_LINK_LIBRARIES "\$<LINK_ONLY:HPXInternal::hpx_full>;\$<LINK_ONLY:HPXInternal::hpx_init>;\$<LINK_ONLY:HPXInternal::hpx_private_flags>;-Wl,-wrap=main"
+)
+
+# Create imported target HPXInternal::hpx_base_libraries
+add_library(HPXInternal::hpx_base_libraries INTERFACE IMPORTED)
+
+set_target_properties(HPXInternal::hpx_base_libraries PROPERTIES
+  INTERFACE_LINK_LIBRARIES "atomic;dl;rt;Threads::Threads"
+)
+
+# Import target "HPXInternal::hpx_full" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_full APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_full PROPERTIES
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx.so.1.9.0"
+  IMPORTED_SONAME_RELEASE "libhpx.so.1"
+  )
+
+# Import target "HPXInternal::hpx_core" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_core APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_core PROPERTIES
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_core.so"
+  IMPORTED_SONAME_RELEASE "libhpx_core.so"
+  )
+
+# Import target "HPXInternal::hpx_affinity" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_affinity APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_affinity PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_affinity.a"
+  )
+
+# Import target "HPXInternal::hpx_algorithms" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_algorithms APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_algorithms PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_algorithms.a"
+  )
+
+# Import target "HPXInternal::hpx_allocator_support" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_allocator_support APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_allocator_support PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_allocator_support.a"
+  )
+
+# Import target "HPXInternal::hpx_asio" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_asio APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_asio PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_asio.a"
+  )
+
+# Import target "HPXInternal::hpx_assertion" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_assertion APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_assertion PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_assertion.a"
+  )
+
+# Import target "HPXInternal::hpx_async_base" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_async_base APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_async_base PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_async_base.a"
+  )
+
+# Import target "HPXInternal::hpx_async_combinators" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_async_combinators APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_async_combinators PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_async_combinators.a"
+  )
+
+# Import target "HPXInternal::hpx_async_local" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_async_local APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_async_local PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_async_local.a"
+  )
+
+# Import target "HPXInternal::hpx_batch_environments" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_batch_environments APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_batch_environments PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_batch_environments.a"
+  )
+
+# Import target "HPXInternal::hpx_cache" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_cache APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_cache PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_cache.a"
+  )
+
+# Import target "HPXInternal::hpx_command_line_handling_local" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_command_line_handling_local APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_command_line_handling_local PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_command_line_handling_local.a"
+  )
+
+# Import target "HPXInternal::hpx_compute_local" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_compute_local APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_compute_local PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_compute_local.a"
+  )
+
+# Import target "HPXInternal::hpx_concepts" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_concepts APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_concepts PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_concepts.a"
+  )
+
+# Import target "HPXInternal::hpx_concurrency" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_concurrency APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_concurrency PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_concurrency.a"
+  )
+
+# Import target "HPXInternal::hpx_config" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_config APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_config PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_config.a"
+  )
+
+# Import target "HPXInternal::hpx_config_registry" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_config_registry APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_config_registry PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_config_registry.a"
+  )
+
+# Import target "HPXInternal::hpx_coroutines" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_coroutines APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_coroutines PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_coroutines.a"
+  )
+
+# Import target "HPXInternal::hpx_datastructures" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_datastructures APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_datastructures PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_datastructures.a"
+  )
+
+# Import target "HPXInternal::hpx_debugging" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_debugging APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_debugging PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_debugging.a"
+  )
+
+# Import target "HPXInternal::hpx_errors" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_errors APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_errors PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_errors.a"
+  )
+
+# Import target "HPXInternal::hpx_execution" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_execution APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_execution PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_execution.a"
+  )
+
+# Import target "HPXInternal::hpx_execution_base" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_execution_base APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_execution_base PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_execution_base.a"
+  )
+
+# Import target "HPXInternal::hpx_executors" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_executors APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_executors PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_executors.a"
+  )
+
+# Import target "HPXInternal::hpx_filesystem" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_filesystem APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_filesystem PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_filesystem.a"
+  )
+
+# Import target "HPXInternal::hpx_format" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_format APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_format PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_format.a"
+  )
+
+# Import target "HPXInternal::hpx_functional" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_functional APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_functional PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_functional.a"
+  )
+
+# Import target "HPXInternal::hpx_futures" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_futures APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_futures PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_futures.a"
+  )
+
+# Import target "HPXInternal::hpx_hardware" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_hardware APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_hardware PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_hardware.a"
+  )
+
+# Import target "HPXInternal::hpx_hashing" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_hashing APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_hashing PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_hashing.a"
+  )
+
+# Import target "HPXInternal::hpx_include_local" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_include_local APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_include_local PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_include_local.a"
+  )
+
+# Import target "HPXInternal::hpx_ini" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_ini APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_ini PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_ini.a"
+  )
+
+# Import target "HPXInternal::hpx_init_runtime_local" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_init_runtime_local APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_init_runtime_local PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_init_runtime_local.a"
+  )
+
+# Import target "HPXInternal::hpx_io_service" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_io_service APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_io_service PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_io_service.a"
+  )
+
+# Import target "HPXInternal::hpx_iterator_support" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_iterator_support APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_iterator_support PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_iterator_support.a"
+  )
+
+# Import target "HPXInternal::hpx_itt_notify" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_itt_notify APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_itt_notify PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_itt_notify.a"
+  )
+
+# Import target "HPXInternal::hpx_lcos_local" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_lcos_local APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_lcos_local PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_lcos_local.a"
+  )
+
+# Import target "HPXInternal::hpx_lock_registration" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_lock_registration APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_lock_registration PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_lock_registration.a"
+  )
+
+# Import target "HPXInternal::hpx_logging" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_logging APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_logging PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_logging.a"
+  )
+
+# Import target "HPXInternal::hpx_memory" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_memory APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_memory PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_memory.a"
+  )
+
+# Import target "HPXInternal::hpx_pack_traversal" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_pack_traversal APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_pack_traversal PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_pack_traversal.a"
+  )
+
+# Import target "HPXInternal::hpx_plugin" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_plugin APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_plugin PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_plugin.a"
+  )
+
+# Import target "HPXInternal::hpx_prefix" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_prefix APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_prefix PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_prefix.a"
+  )
+
+# Import target "HPXInternal::hpx_preprocessor" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_preprocessor APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_preprocessor PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_preprocessor.a"
+  )
+
+# Import target "HPXInternal::hpx_program_options" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_program_options APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_program_options PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_program_options.a"
+  )
+
+# Import target "HPXInternal::hpx_properties" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_properties APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_properties PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_properties.a"
+  )
+
+# Import target "HPXInternal::hpx_resiliency" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_resiliency APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_resiliency PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_resiliency.a"
+  )
+
+# Import target "HPXInternal::hpx_resource_partitioner" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_resource_partitioner APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_resource_partitioner PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_resource_partitioner.a"
+  )
+
+# Import target "HPXInternal::hpx_runtime_configuration" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_runtime_configuration APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_runtime_configuration PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_runtime_configuration.a"
+  )
+
+# Import target "HPXInternal::hpx_runtime_local" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_runtime_local APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_runtime_local PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_runtime_local.a"
+  )
+
+# Import target "HPXInternal::hpx_schedulers" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_schedulers APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_schedulers PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_schedulers.a"
+  )
+
+# Import target "HPXInternal::hpx_serialization" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_serialization APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_serialization PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_serialization.a"
+  )
+
+# Import target "HPXInternal::hpx_static_reinit" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_static_reinit APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_static_reinit PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_static_reinit.a"
+  )
+
+# Import target "HPXInternal::hpx_string_util" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_string_util APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_string_util PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_string_util.a"
+  )
+
+# Import target "HPXInternal::hpx_synchronization" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_synchronization APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_synchronization PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_synchronization.a"
+  )
+
+# Import target "HPXInternal::hpx_tag_invoke" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_tag_invoke APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_tag_invoke PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_tag_invoke.a"
+  )
+
+# Import target "HPXInternal::hpx_testing" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_testing APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_testing PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_testing.a"
+  )
+
+# Import target "HPXInternal::hpx_thread_pool_util" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_thread_pool_util APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_thread_pool_util PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_thread_pool_util.a"
+  )
+
+# Import target "HPXInternal::hpx_thread_pools" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_thread_pools APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_thread_pools PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_thread_pools.a"
+  )
+
+# Import target "HPXInternal::hpx_thread_support" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_thread_support APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_thread_support PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_thread_support.a"
+  )
+
+# Import target "HPXInternal::hpx_threading" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_threading APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_threading PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_threading.a"
+  )
+
+# Import target "HPXInternal::hpx_threading_base" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_threading_base APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_threading_base PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_threading_base.a"
+  )
+
+# Import target "HPXInternal::hpx_threadmanager" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_threadmanager APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_threadmanager PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_threadmanager.a"
+  )
+
+# Import target "HPXInternal::hpx_timed_execution" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_timed_execution APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_timed_execution PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_timed_execution.a"
+  )
+
+# Import target "HPXInternal::hpx_timing" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_timing APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_timing PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_timing.a"
+  )
+
+# Import target "HPXInternal::hpx_topology" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_topology APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_topology PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_topology.a"
+  )
+
+# Import target "HPXInternal::hpx_type_support" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_type_support APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_type_support PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_type_support.a"
+  )
+
+# Import target "HPXInternal::hpx_util" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_util APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_util PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_util.a"
+  )
+
+# Import target "HPXInternal::hpx_version" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_version APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_version PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_version.a"
+  )
+
+# Import target "HPXInternal::hpx_checkpoint_base" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_checkpoint_base APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_checkpoint_base PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_checkpoint_base.a"
+  )
+
+# Import target "HPXInternal::hpx_command_line_handling" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_command_line_handling APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_command_line_handling PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_command_line_handling.a"
+  )
+
+# Import target "HPXInternal::hpx_compute" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_compute APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_compute PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_compute.a"
+  )
+
+# Import target "HPXInternal::hpx_init_runtime" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_init_runtime APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_init_runtime PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_init_runtime.a"
+  )
+
+# Import target "HPXInternal::hpx_parcelset" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_parcelset APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_parcelset PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_parcelset.a"
+  )
+
+# Import target "HPXInternal::hpx_parcelset_base" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_parcelset_base APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_parcelset_base PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_parcelset_base.a"
+  )
+
+# Import target "HPXInternal::hpx_plugin_factories" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_plugin_factories APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_plugin_factories PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_plugin_factories.a"
+  )
+
+# Import target "HPXInternal::hpx_init" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_init APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_init PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_init.a"
+  )
+
+# Import target "HPXInternal::hpx_wrap" for configuration "Release"
+set_property(TARGET HPXInternal::hpx_wrap APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(HPXInternal::hpx_wrap PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_simd_build/lib/libhpx_wrap.a"
+  )
+
+# This file does not depend on other imported targets which have
+# been exported from the same project but in a separate export set.
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
+cmake_policy(POP)
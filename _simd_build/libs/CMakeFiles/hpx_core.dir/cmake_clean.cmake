@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../lib/libhpx_core.pdb"
+  "../lib/libhpx_core.so"
+  "CMakeFiles/hpx_core.dir/src/empty.cpp.o"
+  "CMakeFiles/hpx_core.dir/src/empty.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_core.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs/src/empty.cpp" "libs/CMakeFiles/hpx_full.dir/src/empty.cpp.o" "gcc" "libs/CMakeFiles/hpx_full.dir/src/empty.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_simd_build/lib/libhpx.so" "/root/repo/_simd_build/lib/libhpx.so.1.9.0"
+  "/root/repo/_simd_build/lib/libhpx.so.1" "/root/repo/_simd_build/lib/libhpx.so.1.9.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_simd_build/libs/full/checkpoint_base/CMakeFiles/hpx_checkpoint_base.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/full/command_line_handling/CMakeFiles/hpx_command_line_handling.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/full/compute/CMakeFiles/hpx_compute.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/full/init_runtime/CMakeFiles/hpx_init_runtime.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/full/parcelset/CMakeFiles/hpx_parcelset.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/full/parcelset_base/CMakeFiles/hpx_parcelset_base.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/full/plugin_factories/CMakeFiles/hpx_plugin_factories.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/CMakeFiles/hpx_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
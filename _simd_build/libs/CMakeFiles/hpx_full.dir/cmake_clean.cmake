@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../lib/libhpx.pdb"
+  "../lib/libhpx.so"
+  "../lib/libhpx.so.1"
+  "../lib/libhpx.so.1.9.0"
+  "CMakeFiles/hpx_full.dir/src/empty.cpp.o"
+  "CMakeFiles/hpx_full.dir/src/empty.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_full.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
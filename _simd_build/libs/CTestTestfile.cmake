@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs
+# Build directory: /root/repo/_simd_build/libs
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("core")
+subdirs("full")
@@ -0,0 +1,78 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core
+# Build directory: /root/repo/_simd_build/libs/core
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("affinity")
+subdirs("algorithms")
+subdirs("allocator_support")
+subdirs("asio")
+subdirs("assertion")
+subdirs("async_base")
+subdirs("async_combinators")
+subdirs("async_cuda")
+subdirs("async_local")
+subdirs("async_mpi")
+subdirs("batch_environments")
+subdirs("cache")
+subdirs("command_line_handling_local")
+subdirs("compute_local")
+subdirs("concepts")
+subdirs("concurrency")
+subdirs("config")
+subdirs("config_registry")
+subdirs("coroutines")
+subdirs("datastructures")
+subdirs("debugging")
+subdirs("errors")
+subdirs("execution")
+subdirs("execution_base")
+subdirs("executors")
+subdirs("filesystem")
+subdirs("format")
+subdirs("functional")
+subdirs("futures")
+subdirs("hardware")
+subdirs("hashing")
+subdirs("include_local")
+subdirs("ini")
+subdirs("init_runtime_local")
+subdirs("io_service")
+subdirs("iterator_support")
+subdirs("itt_notify")
+subdirs("lci_base")
+subdirs("lcos_local")
+subdirs("lock_registration")
+subdirs("logging")
+subdirs("memory")
+subdirs("mpi_base")
+subdirs("pack_traversal")
+subdirs("plugin")
+subdirs("prefix")
+subdirs("preprocessor")
+subdirs("program_options")
+subdirs("properties")
+subdirs("resiliency")
+subdirs("resource_partitioner")
+subdirs("runtime_configuration")
+subdirs("runtime_local")
+subdirs("schedulers")
+subdirs("serialization")
+subdirs("static_reinit")
+subdirs("string_util")
+subdirs("synchronization")
+subdirs("tag_invoke")
+subdirs("testing")
+subdirs("thread_pool_util")
+subdirs("thread_pools")
+subdirs("thread_support")
+subdirs("threading")
+subdirs("threading_base")
+subdirs("threadmanager")
+subdirs("timed_execution")
+subdirs("timing")
+subdirs("topology")
+subdirs("type_support")
+subdirs("util")
+subdirs("version")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_affinity.a"
+  "../../../lib/libhpx_affinity.pdb"
+  "CMakeFiles/hpx_affinity.dir/src/affinity_data.cpp.o"
+  "CMakeFiles/hpx_affinity.dir/src/affinity_data.cpp.o.d"
+  "CMakeFiles/hpx_affinity.dir/src/parse_affinity_options.cpp.o"
+  "CMakeFiles/hpx_affinity.dir/src/parse_affinity_options.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_affinity.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/affinity
+# Build directory: /root/repo/_simd_build/libs/core/affinity
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("tests")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/parse_affinity_options_test"
+  "../../../../../bin/parse_affinity_options_test.pdb"
+  "CMakeFiles/parse_affinity_options_test.dir/parse_affinity_options.cpp.o"
+  "CMakeFiles/parse_affinity_options_test.dir/parse_affinity_options.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/parse_affinity_options_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
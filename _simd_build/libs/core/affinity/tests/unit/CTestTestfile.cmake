@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/affinity/tests/unit
+# Build directory: /root/repo/_simd_build/libs/core/affinity/tests/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tests.unit.modules.affinity.parse_affinity_options "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/parse_affinity_options_test" "-e" "0" "-t" "2" "-v" "--")
+set_tests_properties(tests.unit.modules.affinity.parse_affinity_options PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/affinity/tests/unit/CMakeLists.txt;25;add_hpx_unit_test;/root/repo/libs/core/affinity/tests/unit/CMakeLists.txt;0;")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_algorithms.a"
+  "../../../lib/libhpx_algorithms.pdb"
+  "CMakeFiles/hpx_algorithms.dir/src/handle_exception_termination_handler.cpp.o"
+  "CMakeFiles/hpx_algorithms.dir/src/handle_exception_termination_handler.cpp.o.d"
+  "CMakeFiles/hpx_algorithms.dir/src/task_group.cpp.o"
+  "CMakeFiles/hpx_algorithms.dir/src/task_group.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_algorithms.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/algorithms
+# Build directory: /root/repo/_simd_build/libs/core/algorithms
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("examples")
+subdirs("tests")
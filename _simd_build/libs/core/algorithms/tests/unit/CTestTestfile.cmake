@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/algorithms/tests/unit
+# Build directory: /root/repo/_simd_build/libs/core/algorithms/tests/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("algorithms")
+subdirs("block")
+subdirs("container_algorithms")
+subdirs("datapar_algorithms")
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs/core/algorithms/tests/unit/algorithms/adjacentdifference_sender.cpp" "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/adjacentdifference_sender_test.dir/adjacentdifference_sender.cpp.o" "gcc" "libs/core/algorithms/tests/unit/algorithms/CMakeFiles/adjacentdifference_sender_test.dir/adjacentdifference_sender.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_simd_build/wrap/CMakeFiles/hpx_wrap.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/init/CMakeFiles/hpx_init.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/CMakeFiles/hpx_full.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/CMakeFiles/hpx_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/adjacentdifference_sender_test"
+  "../../../../../../bin/adjacentdifference_sender_test.pdb"
+  "CMakeFiles/adjacentdifference_sender_test.dir/adjacentdifference_sender.cpp.o"
+  "CMakeFiles/adjacentdifference_sender_test.dir/adjacentdifference_sender.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/adjacentdifference_sender_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
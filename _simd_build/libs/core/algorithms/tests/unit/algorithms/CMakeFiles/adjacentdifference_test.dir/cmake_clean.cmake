@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/adjacentdifference_test"
+  "../../../../../../bin/adjacentdifference_test.pdb"
+  "CMakeFiles/adjacentdifference_test.dir/adjacentdifference.cpp.o"
+  "CMakeFiles/adjacentdifference_test.dir/adjacentdifference.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/adjacentdifference_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
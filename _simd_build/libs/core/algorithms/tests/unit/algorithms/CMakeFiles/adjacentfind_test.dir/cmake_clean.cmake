@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/adjacentfind_test"
+  "../../../../../../bin/adjacentfind_test.pdb"
+  "CMakeFiles/adjacentfind_test.dir/adjacentfind.cpp.o"
+  "CMakeFiles/adjacentfind_test.dir/adjacentfind.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/adjacentfind_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/all_of_test"
+  "../../../../../../bin/all_of_test.pdb"
+  "CMakeFiles/all_of_test.dir/all_of.cpp.o"
+  "CMakeFiles/all_of_test.dir/all_of.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/all_of_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/any_of_test"
+  "../../../../../../bin/any_of_test.pdb"
+  "CMakeFiles/any_of_test.dir/any_of.cpp.o"
+  "CMakeFiles/any_of_test.dir/any_of.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/any_of_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/copy_test"
+  "../../../../../../bin/copy_test.pdb"
+  "CMakeFiles/copy_test.dir/copy.cpp.o"
+  "CMakeFiles/copy_test.dir/copy.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/copy_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
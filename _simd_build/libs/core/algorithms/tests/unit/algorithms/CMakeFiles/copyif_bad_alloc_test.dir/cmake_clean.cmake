@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/copyif_bad_alloc_test"
+  "../../../../../../bin/copyif_bad_alloc_test.pdb"
+  "CMakeFiles/copyif_bad_alloc_test.dir/copyif_bad_alloc.cpp.o"
+  "CMakeFiles/copyif_bad_alloc_test.dir/copyif_bad_alloc.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/copyif_bad_alloc_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/copyif_exception_test"
+  "../../../../../../bin/copyif_exception_test.pdb"
+  "CMakeFiles/copyif_exception_test.dir/copyif_exception.cpp.o"
+  "CMakeFiles/copyif_exception_test.dir/copyif_exception.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/copyif_exception_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/copyif_forward_test"
+  "../../../../../../bin/copyif_forward_test.pdb"
+  "CMakeFiles/copyif_forward_test.dir/copyif_forward.cpp.o"
+  "CMakeFiles/copyif_forward_test.dir/copyif_forward.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/copyif_forward_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
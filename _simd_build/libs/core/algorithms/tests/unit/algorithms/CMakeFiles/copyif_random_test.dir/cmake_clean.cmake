@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/copyif_random_test"
+  "../../../../../../bin/copyif_random_test.pdb"
+  "CMakeFiles/copyif_random_test.dir/copyif_random.cpp.o"
+  "CMakeFiles/copyif_random_test.dir/copyif_random.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/copyif_random_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/copyn_test"
+  "../../../../../../bin/copyn_test.pdb"
+  "CMakeFiles/copyn_test.dir/copyn.cpp.o"
+  "CMakeFiles/copyn_test.dir/copyn.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/copyn_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/count_test"
+  "../../../../../../bin/count_test.pdb"
+  "CMakeFiles/count_test.dir/count.cpp.o"
+  "CMakeFiles/count_test.dir/count.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/count_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/countif_test"
+  "../../../../../../bin/countif_test.pdb"
+  "CMakeFiles/countif_test.dir/countif.cpp.o"
+  "CMakeFiles/countif_test.dir/countif.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/countif_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
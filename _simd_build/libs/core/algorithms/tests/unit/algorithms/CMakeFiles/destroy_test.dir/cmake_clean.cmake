@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/destroy_test"
+  "../../../../../../bin/destroy_test.pdb"
+  "CMakeFiles/destroy_test.dir/destroy.cpp.o"
+  "CMakeFiles/destroy_test.dir/destroy.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/destroy_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/destroyn_test"
+  "../../../../../../bin/destroyn_test.pdb"
+  "CMakeFiles/destroyn_test.dir/destroyn.cpp.o"
+  "CMakeFiles/destroyn_test.dir/destroyn.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/destroyn_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/equal_test"
+  "../../../../../../bin/equal_test.pdb"
+  "CMakeFiles/equal_test.dir/equal.cpp.o"
+  "CMakeFiles/equal_test.dir/equal.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/equal_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/exclusive_scan_bad_alloc_test"
+  "../../../../../../bin/exclusive_scan_bad_alloc_test.pdb"
+  "CMakeFiles/exclusive_scan_bad_alloc_test.dir/exclusive_scan_bad_alloc.cpp.o"
+  "CMakeFiles/exclusive_scan_bad_alloc_test.dir/exclusive_scan_bad_alloc.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exclusive_scan_bad_alloc_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/exclusive_scan_exception_test"
+  "../../../../../../bin/exclusive_scan_exception_test.pdb"
+  "CMakeFiles/exclusive_scan_exception_test.dir/exclusive_scan_exception.cpp.o"
+  "CMakeFiles/exclusive_scan_exception_test.dir/exclusive_scan_exception.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exclusive_scan_exception_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/exclusive_scan_test"
+  "../../../../../../bin/exclusive_scan_test.pdb"
+  "CMakeFiles/exclusive_scan_test.dir/exclusive_scan.cpp.o"
+  "CMakeFiles/exclusive_scan_test.dir/exclusive_scan.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exclusive_scan_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
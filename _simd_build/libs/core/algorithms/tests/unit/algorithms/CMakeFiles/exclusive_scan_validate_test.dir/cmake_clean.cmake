@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/exclusive_scan_validate_test"
+  "../../../../../../bin/exclusive_scan_validate_test.pdb"
+  "CMakeFiles/exclusive_scan_validate_test.dir/exclusive_scan_validate.cpp.o"
+  "CMakeFiles/exclusive_scan_validate_test.dir/exclusive_scan_validate.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exclusive_scan_validate_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/external_sort_test"
+  "../../../../../../bin/external_sort_test.pdb"
+  "CMakeFiles/external_sort_test.dir/external_sort.cpp.o"
+  "CMakeFiles/external_sort_test.dir/external_sort.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/external_sort_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
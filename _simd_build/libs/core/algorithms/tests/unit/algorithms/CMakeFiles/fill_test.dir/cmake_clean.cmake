@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/fill_test"
+  "../../../../../../bin/fill_test.pdb"
+  "CMakeFiles/fill_test.dir/fill.cpp.o"
+  "CMakeFiles/fill_test.dir/fill.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fill_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/filln_test"
+  "../../../../../../bin/filln_test.pdb"
+  "CMakeFiles/filln_test.dir/filln.cpp.o"
+  "CMakeFiles/filln_test.dir/filln.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/filln_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/find_test"
+  "../../../../../../bin/find_test.pdb"
+  "CMakeFiles/find_test.dir/find.cpp.o"
+  "CMakeFiles/find_test.dir/find.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/find_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
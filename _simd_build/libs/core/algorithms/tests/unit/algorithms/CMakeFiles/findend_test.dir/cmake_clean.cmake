@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/findend_test"
+  "../../../../../../bin/findend_test.pdb"
+  "CMakeFiles/findend_test.dir/findend.cpp.o"
+  "CMakeFiles/findend_test.dir/findend.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/findend_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/findfirstof_binary_test"
+  "../../../../../../bin/findfirstof_binary_test.pdb"
+  "CMakeFiles/findfirstof_binary_test.dir/findfirstof_binary.cpp.o"
+  "CMakeFiles/findfirstof_binary_test.dir/findfirstof_binary.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/findfirstof_binary_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
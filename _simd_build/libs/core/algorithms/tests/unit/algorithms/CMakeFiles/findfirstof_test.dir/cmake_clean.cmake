@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/findfirstof_test"
+  "../../../../../../bin/findfirstof_test.pdb"
+  "CMakeFiles/findfirstof_test.dir/findfirstof.cpp.o"
+  "CMakeFiles/findfirstof_test.dir/findfirstof.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/findfirstof_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
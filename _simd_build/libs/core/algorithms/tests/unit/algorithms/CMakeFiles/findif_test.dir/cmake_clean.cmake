@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/findif_test"
+  "../../../../../../bin/findif_test.pdb"
+  "CMakeFiles/findif_test.dir/findif.cpp.o"
+  "CMakeFiles/findif_test.dir/findif.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/findif_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
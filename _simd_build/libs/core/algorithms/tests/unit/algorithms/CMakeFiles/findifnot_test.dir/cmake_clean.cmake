@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/findifnot_test"
+  "../../../../../../bin/findifnot_test.pdb"
+  "CMakeFiles/findifnot_test.dir/findifnot.cpp.o"
+  "CMakeFiles/findifnot_test.dir/findifnot.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/findifnot_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
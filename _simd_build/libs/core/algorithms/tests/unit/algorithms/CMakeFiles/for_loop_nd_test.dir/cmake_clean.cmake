@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/for_loop_nd_test"
+  "../../../../../../bin/for_loop_nd_test.pdb"
+  "CMakeFiles/for_loop_nd_test.dir/for_loop_nd.cpp.o"
+  "CMakeFiles/for_loop_nd_test.dir/for_loop_nd.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/for_loop_nd_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/for_loop_strided_test"
+  "../../../../../../bin/for_loop_strided_test.pdb"
+  "CMakeFiles/for_loop_strided_test.dir/for_loop_strided.cpp.o"
+  "CMakeFiles/for_loop_strided_test.dir/for_loop_strided.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/for_loop_strided_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/for_loop_test"
+  "../../../../../../bin/for_loop_test.pdb"
+  "CMakeFiles/for_loop_test.dir/for_loop.cpp.o"
+  "CMakeFiles/for_loop_test.dir/for_loop.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/for_loop_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/foreach_executors_test"
+  "../../../../../../bin/foreach_executors_test.pdb"
+  "CMakeFiles/foreach_executors_test.dir/foreach_executors.cpp.o"
+  "CMakeFiles/foreach_executors_test.dir/foreach_executors.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/foreach_executors_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
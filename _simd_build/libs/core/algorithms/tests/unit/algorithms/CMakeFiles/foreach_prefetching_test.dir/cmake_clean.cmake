@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/foreach_prefetching_test"
+  "../../../../../../bin/foreach_prefetching_test.pdb"
+  "CMakeFiles/foreach_prefetching_test.dir/foreach_prefetching.cpp.o"
+  "CMakeFiles/foreach_prefetching_test.dir/foreach_prefetching.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/foreach_prefetching_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/foreach_test"
+  "../../../../../../bin/foreach_test.pdb"
+  "CMakeFiles/foreach_test.dir/foreach.cpp.o"
+  "CMakeFiles/foreach_test.dir/foreach.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/foreach_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
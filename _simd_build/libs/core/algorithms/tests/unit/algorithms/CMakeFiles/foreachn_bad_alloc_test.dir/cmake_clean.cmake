@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/foreachn_bad_alloc_test"
+  "../../../../../../bin/foreachn_bad_alloc_test.pdb"
+  "CMakeFiles/foreachn_bad_alloc_test.dir/foreachn_bad_alloc.cpp.o"
+  "CMakeFiles/foreachn_bad_alloc_test.dir/foreachn_bad_alloc.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/foreachn_bad_alloc_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
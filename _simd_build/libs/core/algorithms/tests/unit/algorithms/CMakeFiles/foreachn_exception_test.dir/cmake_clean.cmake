@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/foreachn_exception_test"
+  "../../../../../../bin/foreachn_exception_test.pdb"
+  "CMakeFiles/foreachn_exception_test.dir/foreachn_exception.cpp.o"
+  "CMakeFiles/foreachn_exception_test.dir/foreachn_exception.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/foreachn_exception_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/foreachn_test"
+  "../../../../../../bin/foreachn_test.pdb"
+  "CMakeFiles/foreachn_test.dir/foreachn.cpp.o"
+  "CMakeFiles/foreachn_test.dir/foreachn.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/foreachn_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/generate_test"
+  "../../../../../../bin/generate_test.pdb"
+  "CMakeFiles/generate_test.dir/generate.cpp.o"
+  "CMakeFiles/generate_test.dir/generate.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/generate_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
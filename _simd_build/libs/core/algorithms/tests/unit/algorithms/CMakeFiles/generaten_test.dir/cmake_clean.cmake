@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/generaten_test"
+  "../../../../../../bin/generaten_test.pdb"
+  "CMakeFiles/generaten_test.dir/generaten.cpp.o"
+  "CMakeFiles/generaten_test.dir/generaten.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/generaten_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/group_by_test"
+  "../../../../../../bin/group_by_test.pdb"
+  "CMakeFiles/group_by_test.dir/group_by.cpp.o"
+  "CMakeFiles/group_by_test.dir/group_by.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/group_by_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/includes_test"
+  "../../../../../../bin/includes_test.pdb"
+  "CMakeFiles/includes_test.dir/includes.cpp.o"
+  "CMakeFiles/includes_test.dir/includes.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/includes_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/is_sorted_until_test"
+  "../../../../../../bin/is_sorted_until_test.pdb"
+  "CMakeFiles/is_sorted_until_test.dir/is_sorted_until.cpp.o"
+  "CMakeFiles/is_sorted_until_test.dir/is_sorted_until.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/is_sorted_until_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/kway_merge_test"
+  "../../../../../../bin/kway_merge_test.pdb"
+  "CMakeFiles/kway_merge_test.dir/kway_merge.cpp.o"
+  "CMakeFiles/kway_merge_test.dir/kway_merge.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kway_merge_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/lazy_binary_splitting_test"
+  "../../../../../../bin/lazy_binary_splitting_test.pdb"
+  "CMakeFiles/lazy_binary_splitting_test.dir/lazy_binary_splitting.cpp.o"
+  "CMakeFiles/lazy_binary_splitting_test.dir/lazy_binary_splitting.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lazy_binary_splitting_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
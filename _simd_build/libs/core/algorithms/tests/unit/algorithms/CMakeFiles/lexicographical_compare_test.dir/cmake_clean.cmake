@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/lexicographical_compare_test"
+  "../../../../../../bin/lexicographical_compare_test.pdb"
+  "CMakeFiles/lexicographical_compare_test.dir/lexicographical_compare.cpp.o"
+  "CMakeFiles/lexicographical_compare_test.dir/lexicographical_compare.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lexicographical_compare_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
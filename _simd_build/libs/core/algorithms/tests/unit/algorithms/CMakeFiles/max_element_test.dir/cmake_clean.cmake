@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/max_element_test"
+  "../../../../../../bin/max_element_test.pdb"
+  "CMakeFiles/max_element_test.dir/max_element.cpp.o"
+  "CMakeFiles/max_element_test.dir/max_element.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/max_element_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/memory_hints_test"
+  "../../../../../../bin/memory_hints_test.pdb"
+  "CMakeFiles/memory_hints_test.dir/memory_hints.cpp.o"
+  "CMakeFiles/memory_hints_test.dir/memory_hints.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/memory_hints_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/merge_test"
+  "../../../../../../bin/merge_test.pdb"
+  "CMakeFiles/merge_test.dir/merge.cpp.o"
+  "CMakeFiles/merge_test.dir/merge.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/merge_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/min_element_test"
+  "../../../../../../bin/min_element_test.pdb"
+  "CMakeFiles/min_element_test.dir/min_element.cpp.o"
+  "CMakeFiles/min_element_test.dir/min_element.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/min_element_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
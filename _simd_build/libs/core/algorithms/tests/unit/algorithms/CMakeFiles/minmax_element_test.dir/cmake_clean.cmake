@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/minmax_element_test"
+  "../../../../../../bin/minmax_element_test.pdb"
+  "CMakeFiles/minmax_element_test.dir/minmax_element.cpp.o"
+  "CMakeFiles/minmax_element_test.dir/minmax_element.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/minmax_element_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/mismatch_test"
+  "../../../../../../bin/mismatch_test.pdb"
+  "CMakeFiles/mismatch_test.dir/mismatch.cpp.o"
+  "CMakeFiles/mismatch_test.dir/mismatch.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mismatch_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
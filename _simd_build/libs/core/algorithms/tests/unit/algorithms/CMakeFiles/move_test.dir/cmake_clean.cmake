@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/move_test"
+  "../../../../../../bin/move_test.pdb"
+  "CMakeFiles/move_test.dir/move.cpp.o"
+  "CMakeFiles/move_test.dir/move.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/move_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
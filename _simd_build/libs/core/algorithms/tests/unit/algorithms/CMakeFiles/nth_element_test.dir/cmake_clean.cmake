@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/nth_element_test"
+  "../../../../../../bin/nth_element_test.pdb"
+  "CMakeFiles/nth_element_test.dir/nth_element.cpp.o"
+  "CMakeFiles/nth_element_test.dir/nth_element.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nth_element_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/parallel_sort_test"
+  "../../../../../../bin/parallel_sort_test.pdb"
+  "CMakeFiles/parallel_sort_test.dir/parallel_sort.cpp.o"
+  "CMakeFiles/parallel_sort_test.dir/parallel_sort.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/parallel_sort_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
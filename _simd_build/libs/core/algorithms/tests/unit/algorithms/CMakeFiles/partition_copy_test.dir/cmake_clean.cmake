@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/partition_copy_test"
+  "../../../../../../bin/partition_copy_test.pdb"
+  "CMakeFiles/partition_copy_test.dir/partition_copy.cpp.o"
+  "CMakeFiles/partition_copy_test.dir/partition_copy.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/partition_copy_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
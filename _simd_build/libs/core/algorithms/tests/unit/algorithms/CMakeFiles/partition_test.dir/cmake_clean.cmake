@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/partition_test"
+  "../../../../../../bin/partition_test.pdb"
+  "CMakeFiles/partition_test.dir/partition.cpp.o"
+  "CMakeFiles/partition_test.dir/partition.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/partition_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/radix_sort_test"
+  "../../../../../../bin/radix_sort_test.pdb"
+  "CMakeFiles/radix_sort_test.dir/radix_sort.cpp.o"
+  "CMakeFiles/radix_sort_test.dir/radix_sort.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/radix_sort_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
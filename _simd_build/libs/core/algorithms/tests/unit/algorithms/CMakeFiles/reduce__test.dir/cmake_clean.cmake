@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/reduce__test"
+  "../../../../../../bin/reduce__test.pdb"
+  "CMakeFiles/reduce__test.dir/reduce_.cpp.o"
+  "CMakeFiles/reduce__test.dir/reduce_.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/reduce__test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
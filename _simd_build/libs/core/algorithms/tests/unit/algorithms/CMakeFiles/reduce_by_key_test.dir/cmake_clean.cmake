@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/reduce_by_key_test"
+  "../../../../../../bin/reduce_by_key_test.pdb"
+  "CMakeFiles/reduce_by_key_test.dir/reduce_by_key.cpp.o"
+  "CMakeFiles/reduce_by_key_test.dir/reduce_by_key.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/reduce_by_key_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/remove1_test"
+  "../../../../../../bin/remove1_test.pdb"
+  "CMakeFiles/remove1_test.dir/remove1.cpp.o"
+  "CMakeFiles/remove1_test.dir/remove1.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/remove1_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
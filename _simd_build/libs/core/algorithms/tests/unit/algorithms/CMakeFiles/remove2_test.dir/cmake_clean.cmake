@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/remove2_test"
+  "../../../../../../bin/remove2_test.pdb"
+  "CMakeFiles/remove2_test.dir/remove2.cpp.o"
+  "CMakeFiles/remove2_test.dir/remove2.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/remove2_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
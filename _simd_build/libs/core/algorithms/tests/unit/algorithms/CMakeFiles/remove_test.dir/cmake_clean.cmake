@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/remove_test"
+  "../../../../../../bin/remove_test.pdb"
+  "CMakeFiles/remove_test.dir/remove.cpp.o"
+  "CMakeFiles/remove_test.dir/remove.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/remove_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
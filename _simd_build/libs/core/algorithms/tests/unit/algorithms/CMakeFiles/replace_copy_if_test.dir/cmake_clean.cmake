@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/replace_copy_if_test"
+  "../../../../../../bin/replace_copy_if_test.pdb"
+  "CMakeFiles/replace_copy_if_test.dir/replace_copy_if.cpp.o"
+  "CMakeFiles/replace_copy_if_test.dir/replace_copy_if.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/replace_copy_if_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
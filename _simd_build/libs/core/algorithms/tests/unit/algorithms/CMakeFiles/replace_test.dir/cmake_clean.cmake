@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/replace_test"
+  "../../../../../../bin/replace_test.pdb"
+  "CMakeFiles/replace_test.dir/replace.cpp.o"
+  "CMakeFiles/replace_test.dir/replace.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/replace_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
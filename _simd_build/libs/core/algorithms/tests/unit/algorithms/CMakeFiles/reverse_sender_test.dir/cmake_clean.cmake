@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/reverse_sender_test"
+  "../../../../../../bin/reverse_sender_test.pdb"
+  "CMakeFiles/reverse_sender_test.dir/reverse_sender.cpp.o"
+  "CMakeFiles/reverse_sender_test.dir/reverse_sender.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/reverse_sender_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/reverse_test"
+  "../../../../../../bin/reverse_test.pdb"
+  "CMakeFiles/reverse_test.dir/reverse.cpp.o"
+  "CMakeFiles/reverse_test.dir/reverse.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/reverse_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
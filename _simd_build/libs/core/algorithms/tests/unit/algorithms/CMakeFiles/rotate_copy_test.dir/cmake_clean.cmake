@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/rotate_copy_test"
+  "../../../../../../bin/rotate_copy_test.pdb"
+  "CMakeFiles/rotate_copy_test.dir/rotate_copy.cpp.o"
+  "CMakeFiles/rotate_copy_test.dir/rotate_copy.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rotate_copy_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
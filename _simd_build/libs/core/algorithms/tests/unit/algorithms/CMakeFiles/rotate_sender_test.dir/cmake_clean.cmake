@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/rotate_sender_test"
+  "../../../../../../bin/rotate_sender_test.pdb"
+  "CMakeFiles/rotate_sender_test.dir/rotate_sender.cpp.o"
+  "CMakeFiles/rotate_sender_test.dir/rotate_sender.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rotate_sender_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
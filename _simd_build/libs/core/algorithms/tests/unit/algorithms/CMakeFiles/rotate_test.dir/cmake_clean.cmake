@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/rotate_test"
+  "../../../../../../bin/rotate_test.pdb"
+  "CMakeFiles/rotate_test.dir/rotate.cpp.o"
+  "CMakeFiles/rotate_test.dir/rotate.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rotate_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/scan_single_pass_test"
+  "../../../../../../bin/scan_single_pass_test.pdb"
+  "CMakeFiles/scan_single_pass_test.dir/scan_single_pass.cpp.o"
+  "CMakeFiles/scan_single_pass_test.dir/scan_single_pass.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scan_single_pass_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/search_test"
+  "../../../../../../bin/search_test.pdb"
+  "CMakeFiles/search_test.dir/search.cpp.o"
+  "CMakeFiles/search_test.dir/search.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/search_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/searchn_test"
+  "../../../../../../bin/searchn_test.pdb"
+  "CMakeFiles/searchn_test.dir/searchn.cpp.o"
+  "CMakeFiles/searchn_test.dir/searchn.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/searchn_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
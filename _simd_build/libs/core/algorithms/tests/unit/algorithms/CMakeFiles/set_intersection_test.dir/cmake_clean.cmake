@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/set_intersection_test"
+  "../../../../../../bin/set_intersection_test.pdb"
+  "CMakeFiles/set_intersection_test.dir/set_intersection.cpp.o"
+  "CMakeFiles/set_intersection_test.dir/set_intersection.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/set_intersection_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
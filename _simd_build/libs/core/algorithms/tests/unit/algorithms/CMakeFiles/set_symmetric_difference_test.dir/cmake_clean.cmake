@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/set_symmetric_difference_test"
+  "../../../../../../bin/set_symmetric_difference_test.pdb"
+  "CMakeFiles/set_symmetric_difference_test.dir/set_symmetric_difference.cpp.o"
+  "CMakeFiles/set_symmetric_difference_test.dir/set_symmetric_difference.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/set_symmetric_difference_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/shift_right_test"
+  "../../../../../../bin/shift_right_test.pdb"
+  "CMakeFiles/shift_right_test.dir/shift_right.cpp.o"
+  "CMakeFiles/shift_right_test.dir/shift_right.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shift_right_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
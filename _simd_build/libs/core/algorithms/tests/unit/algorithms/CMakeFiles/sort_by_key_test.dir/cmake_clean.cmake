@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/sort_by_key_test"
+  "../../../../../../bin/sort_by_key_test.pdb"
+  "CMakeFiles/sort_by_key_test.dir/sort_by_key.cpp.o"
+  "CMakeFiles/sort_by_key_test.dir/sort_by_key.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sort_by_key_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
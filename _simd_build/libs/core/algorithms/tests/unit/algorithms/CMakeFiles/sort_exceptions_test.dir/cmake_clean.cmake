@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/sort_exceptions_test"
+  "../../../../../../bin/sort_exceptions_test.pdb"
+  "CMakeFiles/sort_exceptions_test.dir/sort_exceptions.cpp.o"
+  "CMakeFiles/sort_exceptions_test.dir/sort_exceptions.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sort_exceptions_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
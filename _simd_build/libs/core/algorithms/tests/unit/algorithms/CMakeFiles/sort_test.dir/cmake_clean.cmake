@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/sort_test"
+  "../../../../../../bin/sort_test.pdb"
+  "CMakeFiles/sort_test.dir/sort.cpp.o"
+  "CMakeFiles/sort_test.dir/sort.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sort_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/stable_sort_test"
+  "../../../../../../bin/stable_sort_test.pdb"
+  "CMakeFiles/stable_sort_test.dir/stable_sort.cpp.o"
+  "CMakeFiles/stable_sort_test.dir/stable_sort.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stable_sort_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
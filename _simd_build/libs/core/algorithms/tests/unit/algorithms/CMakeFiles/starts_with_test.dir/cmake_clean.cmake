@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/starts_with_test"
+  "../../../../../../bin/starts_with_test.pdb"
+  "CMakeFiles/starts_with_test.dir/starts_with.cpp.o"
+  "CMakeFiles/starts_with_test.dir/starts_with.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/starts_with_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/swapranges_test"
+  "../../../../../../bin/swapranges_test.pdb"
+  "CMakeFiles/swapranges_test.dir/swapranges.cpp.o"
+  "CMakeFiles/swapranges_test.dir/swapranges.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/swapranges_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,5 @@
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/tests.unit.modules.algorithms.algorithms.stable_sort_exceptions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,5 @@
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/tests.unit.modules.algorithms.algorithms.starts_with.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
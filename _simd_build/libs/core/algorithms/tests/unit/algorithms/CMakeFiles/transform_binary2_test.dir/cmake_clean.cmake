@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/transform_binary2_test"
+  "../../../../../../bin/transform_binary2_test.pdb"
+  "CMakeFiles/transform_binary2_test.dir/transform_binary2.cpp.o"
+  "CMakeFiles/transform_binary2_test.dir/transform_binary2.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/transform_binary2_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/transform_inclusive_scan_test"
+  "../../../../../../bin/transform_inclusive_scan_test.pdb"
+  "CMakeFiles/transform_inclusive_scan_test.dir/transform_inclusive_scan.cpp.o"
+  "CMakeFiles/transform_inclusive_scan_test.dir/transform_inclusive_scan.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/transform_inclusive_scan_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
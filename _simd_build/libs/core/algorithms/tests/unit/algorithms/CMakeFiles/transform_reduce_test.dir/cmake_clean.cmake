@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/transform_reduce_test"
+  "../../../../../../bin/transform_reduce_test.pdb"
+  "CMakeFiles/transform_reduce_test.dir/transform_reduce.cpp.o"
+  "CMakeFiles/transform_reduce_test.dir/transform_reduce.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/transform_reduce_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/transform_test"
+  "../../../../../../bin/transform_test.pdb"
+  "CMakeFiles/transform_test.dir/transform.cpp.o"
+  "CMakeFiles/transform_test.dir/transform.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/transform_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
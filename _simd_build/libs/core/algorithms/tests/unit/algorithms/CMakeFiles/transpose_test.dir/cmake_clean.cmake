@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/transpose_test"
+  "../../../../../../bin/transpose_test.pdb"
+  "CMakeFiles/transpose_test.dir/transpose.cpp.o"
+  "CMakeFiles/transpose_test.dir/transpose.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/transpose_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/uninitialized_copyn_test"
+  "../../../../../../bin/uninitialized_copyn_test.pdb"
+  "CMakeFiles/uninitialized_copyn_test.dir/uninitialized_copyn.cpp.o"
+  "CMakeFiles/uninitialized_copyn_test.dir/uninitialized_copyn.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/uninitialized_copyn_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
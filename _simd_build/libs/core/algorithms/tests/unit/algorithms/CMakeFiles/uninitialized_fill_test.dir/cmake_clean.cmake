@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/uninitialized_fill_test"
+  "../../../../../../bin/uninitialized_fill_test.pdb"
+  "CMakeFiles/uninitialized_fill_test.dir/uninitialized_fill.cpp.o"
+  "CMakeFiles/uninitialized_fill_test.dir/uninitialized_fill.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/uninitialized_fill_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
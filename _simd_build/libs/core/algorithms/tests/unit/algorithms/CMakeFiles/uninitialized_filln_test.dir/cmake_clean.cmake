@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/uninitialized_filln_test"
+  "../../../../../../bin/uninitialized_filln_test.pdb"
+  "CMakeFiles/uninitialized_filln_test.dir/uninitialized_filln.cpp.o"
+  "CMakeFiles/uninitialized_filln_test.dir/uninitialized_filln.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/uninitialized_filln_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
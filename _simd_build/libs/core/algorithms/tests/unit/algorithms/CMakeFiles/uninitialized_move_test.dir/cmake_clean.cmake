@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/uninitialized_move_test"
+  "../../../../../../bin/uninitialized_move_test.pdb"
+  "CMakeFiles/uninitialized_move_test.dir/uninitialized_move.cpp.o"
+  "CMakeFiles/uninitialized_move_test.dir/uninitialized_move.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/uninitialized_move_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
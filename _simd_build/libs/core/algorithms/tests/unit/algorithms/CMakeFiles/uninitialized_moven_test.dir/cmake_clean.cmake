@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/uninitialized_moven_test"
+  "../../../../../../bin/uninitialized_moven_test.pdb"
+  "CMakeFiles/uninitialized_moven_test.dir/uninitialized_moven.cpp.o"
+  "CMakeFiles/uninitialized_moven_test.dir/uninitialized_moven.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/uninitialized_moven_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
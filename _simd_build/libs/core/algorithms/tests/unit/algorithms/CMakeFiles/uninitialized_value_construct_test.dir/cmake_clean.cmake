@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/uninitialized_value_construct_test"
+  "../../../../../../bin/uninitialized_value_construct_test.pdb"
+  "CMakeFiles/uninitialized_value_construct_test.dir/uninitialized_value_construct.cpp.o"
+  "CMakeFiles/uninitialized_value_construct_test.dir/uninitialized_value_construct.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/uninitialized_value_construct_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/uninitialized_value_constructn_test"
+  "../../../../../../bin/uninitialized_value_constructn_test.pdb"
+  "CMakeFiles/uninitialized_value_constructn_test.dir/uninitialized_value_constructn.cpp.o"
+  "CMakeFiles/uninitialized_value_constructn_test.dir/uninitialized_value_constructn.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/uninitialized_value_constructn_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/unique_test"
+  "../../../../../../bin/unique_test.pdb"
+  "CMakeFiles/unique_test.dir/unique.cpp.o"
+  "CMakeFiles/unique_test.dir/unique.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unique_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
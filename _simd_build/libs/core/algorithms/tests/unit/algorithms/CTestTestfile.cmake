@@ -0,0 +1,288 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/algorithms/tests/unit/algorithms
+# Build directory: /root/repo/_simd_build/libs/core/algorithms/tests/unit/algorithms
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tests.unit.modules.algorithms.algorithms.adjacentdifference "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/adjacentdifference_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.adjacentdifference PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.adjacentdifference_sender "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/adjacentdifference_sender_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.adjacentdifference_sender PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.adjacentfind "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/adjacentfind_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.adjacentfind PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.adjacentfind_binary "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/adjacentfind_binary_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.adjacentfind_binary PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.all_of "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/all_of_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.all_of PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.any_of "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/any_of_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.any_of PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.copy "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/copy_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.copy PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.copyif_random "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/copyif_random_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.copyif_random PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.copyif_forward "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/copyif_forward_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.copyif_forward PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.copyif_exception "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/copyif_exception_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.copyif_exception PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.copyif_bad_alloc "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/copyif_bad_alloc_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.copyif_bad_alloc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.copyn "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/copyn_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.copyn PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.count "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/count_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.count PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.countif "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/countif_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.countif PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.destroy "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/destroy_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.destroy PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.destroyn "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/destroyn_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.destroyn PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.ends_with "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/ends_with_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.ends_with PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.equal "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/equal_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.equal PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.equal_binary "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/equal_binary_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.equal_binary PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.exclusive_scan "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/exclusive_scan_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.exclusive_scan PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.exclusive_scan2 "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/exclusive_scan2_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.exclusive_scan2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.exclusive_scan_exception "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/exclusive_scan_exception_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.exclusive_scan_exception PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.exclusive_scan_bad_alloc "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/exclusive_scan_bad_alloc_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.exclusive_scan_bad_alloc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.exclusive_scan_validate "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/exclusive_scan_validate_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.exclusive_scan_validate PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.external_sort "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/external_sort_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.external_sort PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.fill "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/fill_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.fill PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.filln "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/filln_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.filln PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.find "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/find_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.find PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.findend "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/findend_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.findend PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.findfirstof "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/findfirstof_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.findfirstof PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.findfirstof_binary "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/findfirstof_binary_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.findfirstof_binary PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.findif "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/findif_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.findif PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.findifnot "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/findifnot_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.findifnot PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.foreach "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/foreach_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.foreach PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.foreach_executors "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/foreach_executors_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.foreach_executors PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.foreach_prefetching "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/foreach_prefetching_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.foreach_prefetching PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.foreach_sender "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/foreach_sender_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.foreach_sender PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.foreachn "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/foreachn_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.foreachn PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.foreachn_exception "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/foreachn_exception_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.foreachn_exception PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.foreachn_bad_alloc "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/foreachn_bad_alloc_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.foreachn_bad_alloc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.for_loop "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/for_loop_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.for_loop PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.for_loop_exception "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/for_loop_exception_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.for_loop_exception PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.for_loop_induction "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/for_loop_induction_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.for_loop_induction PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.for_loop_induction_async "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/for_loop_induction_async_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.for_loop_induction_async PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.for_loop_n "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/for_loop_n_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.for_loop_n PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.for_loop_nd "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/for_loop_nd_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.for_loop_nd PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.for_loop_n_strided "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/for_loop_n_strided_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.for_loop_n_strided PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.for_loop_reduction "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/for_loop_reduction_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.for_loop_reduction PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.for_loop_reduction_async "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/for_loop_reduction_async_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.for_loop_reduction_async PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.for_loop_sender "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/for_loop_sender_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.for_loop_sender PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.for_loop_strided "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/for_loop_strided_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.for_loop_strided PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.generate "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/generate_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.generate PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.group_by "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/group_by_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.group_by PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.generaten "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/generaten_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.generaten PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.is_heap "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/is_heap_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.is_heap PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.is_heap_until "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/is_heap_until_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.is_heap_until PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.includes "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/includes_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.includes PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.inclusive_scan "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/inclusive_scan_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.inclusive_scan PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.inplace_merge "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/inplace_merge_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.inplace_merge PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.is_partitioned "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/is_partitioned_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.is_partitioned PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.is_sorted "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/is_sorted_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.is_sorted PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.is_sorted_until "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/is_sorted_until_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.is_sorted_until PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.kway_merge "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/kway_merge_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.kway_merge PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.lazy_binary_splitting "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/lazy_binary_splitting_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.lazy_binary_splitting PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.lexicographical_compare "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/lexicographical_compare_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.lexicographical_compare PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.make_heap "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/make_heap_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.make_heap PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.max_element "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/max_element_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.max_element PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.memory_hints "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/memory_hints_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.memory_hints PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.merge "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/merge_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.merge PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.min_element "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/min_element_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.min_element PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.minmax_element "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/minmax_element_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.minmax_element PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.mismatch "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/mismatch_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.mismatch PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.mismatch_binary "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/mismatch_binary_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.mismatch_binary PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.move "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/move_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.move PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.nth_element "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/nth_element_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.nth_element PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.none_of "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/none_of_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.none_of PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.parallel_sort "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/parallel_sort_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.parallel_sort PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.partial_sort "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/partial_sort_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.partial_sort PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.partial_sort_copy "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/partial_sort_copy_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.partial_sort_copy PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.partition "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/partition_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.partition PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.partition_copy "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/partition_copy_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.partition_copy PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.radix_sort "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/radix_sort_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.radix_sort PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.reduce_ "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/reduce__test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.reduce_ PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.reduce_by_key "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/reduce_by_key_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.reduce_by_key PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.remove "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/remove_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.remove PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.remove1 "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/remove1_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.remove1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.remove2 "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/remove2_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.remove2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.remove_if "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/remove_if_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.remove_if PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.remove_if1 "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/remove_if1_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.remove_if1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.remove_copy "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/remove_copy_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.remove_copy PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.remove_copy_if "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/remove_copy_if_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.remove_copy_if PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.replace "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/replace_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.replace PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.replace_if "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/replace_if_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.replace_if PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.replace_copy "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/replace_copy_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.replace_copy PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.replace_copy_if "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/replace_copy_if_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.replace_copy_if PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.reverse "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/reverse_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.reverse PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.reverse_copy "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/reverse_copy_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.reverse_copy PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.reverse_sender "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/reverse_sender_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.reverse_sender PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.rotate "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/rotate_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.rotate PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.rotate_copy "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/rotate_copy_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.rotate_copy PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.rotate_sender "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/rotate_sender_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.rotate_sender PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.scan_single_pass "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/scan_single_pass_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.scan_single_pass PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.search "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/search_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.search PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.searchn "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/searchn_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.searchn PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.set_difference "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/set_difference_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.set_difference PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.set_intersection "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/set_intersection_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.set_intersection PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.set_symmetric_difference "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/set_symmetric_difference_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.set_symmetric_difference PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.set_union "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/set_union_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.set_union PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.shift_left "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/shift_left_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.shift_left PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.shift_right "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/shift_right_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.shift_right PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.sort "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/sort_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.sort PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.sort_by_key "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/sort_by_key_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.sort_by_key PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.sort_exceptions "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/sort_exceptions_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.sort_exceptions PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.stable_partition "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/stable_partition_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.stable_partition PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.stable_sort "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/stable_sort_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.stable_sort PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.stable_sort_exceptions "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/stable_sort_exceptions_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.stable_sort_exceptions PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.starts_with "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/starts_with_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.starts_with PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.swapranges "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/swapranges_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.swapranges PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.transform "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/transform_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.transform PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.transform_binary "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/transform_binary_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.transform_binary PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.transform_binary2 "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/transform_binary2_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.transform_binary2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.transform_exclusive_scan "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/transform_exclusive_scan_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.transform_exclusive_scan PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.transform_inclusive_scan "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/transform_inclusive_scan_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.transform_inclusive_scan PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.transform_reduce "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/transform_reduce_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.transform_reduce PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.transform_reduce_binary "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/transform_reduce_binary_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.transform_reduce_binary PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.transform_reduce_binary_exception "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/transform_reduce_binary_exception_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.transform_reduce_binary_exception PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.transform_reduce_binary_bad_alloc "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/transform_reduce_binary_bad_alloc_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.transform_reduce_binary_bad_alloc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.transpose "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/transpose_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.transpose PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.uninitialized_copy "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/uninitialized_copy_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.uninitialized_copy PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.uninitialized_copyn "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/uninitialized_copyn_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.uninitialized_copyn PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.uninitialized_default_construct "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/uninitialized_default_construct_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.uninitialized_default_construct PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.uninitialized_default_constructn "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/uninitialized_default_constructn_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.uninitialized_default_constructn PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.uninitialized_fill "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/uninitialized_fill_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.uninitialized_fill PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.uninitialized_filln "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/uninitialized_filln_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.uninitialized_filln PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.uninitialized_move "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/uninitialized_move_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.uninitialized_move PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.uninitialized_moven "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/uninitialized_moven_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.uninitialized_moven PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.uninitialized_value_construct "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/uninitialized_value_construct_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.uninitialized_value_construct PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.uninitialized_value_constructn "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/uninitialized_value_constructn_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.uninitialized_value_constructn PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.unique "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/unique_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.unique PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.algorithms.unique_copy "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/unique_copy_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.algorithms.unique_copy PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;184;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/CMakeLists.txt;0;")
+subdirs("detail")
+subdirs("util")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../../bin/chunk_size_idx_iterator_test"
+  "../../../../../../../bin/chunk_size_idx_iterator_test.pdb"
+  "CMakeFiles/chunk_size_idx_iterator_test.dir/chunk_size_idx_iterator.cpp.o"
+  "CMakeFiles/chunk_size_idx_iterator_test.dir/chunk_size_idx_iterator.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/chunk_size_idx_iterator_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../../bin/test_spin_sort_test"
+  "../../../../../../../bin/test_spin_sort_test.pdb"
+  "CMakeFiles/test_spin_sort_test.dir/test_spin_sort.cpp.o"
+  "CMakeFiles/test_spin_sort_test.dir/test_spin_sort.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_spin_sort_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,5 @@
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/tests.unit.modules.algorithms.detail.test_spin_sort.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
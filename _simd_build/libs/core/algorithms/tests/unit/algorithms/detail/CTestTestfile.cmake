@@ -0,0 +1,18 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/algorithms/tests/unit/algorithms/detail
+# Build directory: /root/repo/_simd_build/libs/core/algorithms/tests/unit/algorithms/detail
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tests.unit.modules.algorithms.detail.chunk_size_iterator "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/chunk_size_iterator_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.detail.chunk_size_iterator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/detail/CMakeLists.txt;34;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/detail/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.detail.chunk_size_idx_iterator "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/chunk_size_idx_iterator_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.detail.chunk_size_idx_iterator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/detail/CMakeLists.txt;34;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/detail/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.detail.test_insertion_sort "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/test_insertion_sort_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.detail.test_insertion_sort PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/detail/CMakeLists.txt;34;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/detail/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.detail.test_parallel_stable_sort "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/test_parallel_stable_sort_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.detail.test_parallel_stable_sort PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/detail/CMakeLists.txt;34;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/detail/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.detail.test_sample_sort "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/test_sample_sort_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.detail.test_sample_sort PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/detail/CMakeLists.txt;34;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/detail/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.detail.test_spin_sort "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/test_spin_sort_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.detail.test_spin_sort PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/detail/CMakeLists.txt;34;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/detail/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../../bin/test_low_level_test"
+  "../../../../../../../bin/test_low_level_test.pdb"
+  "CMakeFiles/test_low_level_test.dir/test_low_level.cpp.o"
+  "CMakeFiles/test_low_level_test.dir/test_low_level.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_low_level_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
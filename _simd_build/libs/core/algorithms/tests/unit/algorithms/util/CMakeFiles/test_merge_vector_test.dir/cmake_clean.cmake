@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../../bin/test_merge_vector_test"
+  "../../../../../../../bin/test_merge_vector_test.pdb"
+  "CMakeFiles/test_merge_vector_test.dir/test_merge_vector.cpp.o"
+  "CMakeFiles/test_merge_vector_test.dir/test_merge_vector.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_merge_vector_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../../bin/test_nbits_test"
+  "../../../../../../../bin/test_nbits_test.pdb"
+  "CMakeFiles/test_nbits_test.dir/test_nbits.cpp.o"
+  "CMakeFiles/test_nbits_test.dir/test_nbits.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_nbits_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../../bin/test_range_test"
+  "../../../../../../../bin/test_range_test.pdb"
+  "CMakeFiles/test_range_test.dir/test_range.cpp.o"
+  "CMakeFiles/test_range_test.dir/test_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,5 @@
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/tests.unit.modules.algorithms.util.test_low_level.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
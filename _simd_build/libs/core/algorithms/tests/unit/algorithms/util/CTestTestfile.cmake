@@ -0,0 +1,16 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/algorithms/tests/unit/algorithms/util
+# Build directory: /root/repo/_simd_build/libs/core/algorithms/tests/unit/algorithms/util
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tests.unit.modules.algorithms.util.test_low_level "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/test_low_level_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.util.test_low_level PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/util/CMakeLists.txt;27;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/util/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.util.test_merge_four "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/test_merge_four_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.util.test_merge_four PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/util/CMakeLists.txt;27;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/util/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.util.test_merge_vector "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/test_merge_vector_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.util.test_merge_vector PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/util/CMakeLists.txt;27;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/util/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.util.test_nbits "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/test_nbits_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.util.test_nbits PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/util/CMakeLists.txt;27;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/util/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.util.test_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/test_range_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.util.test_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/util/CMakeLists.txt;27;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/algorithms/util/CMakeLists.txt;0;")
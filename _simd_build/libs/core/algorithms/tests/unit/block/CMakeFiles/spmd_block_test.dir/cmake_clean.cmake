@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/spmd_block_test"
+  "../../../../../../bin/spmd_block_test.pdb"
+  "CMakeFiles/spmd_block_test.dir/spmd_block.cpp.o"
+  "CMakeFiles/spmd_block_test.dir/spmd_block.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/spmd_block_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/task_block_par_test"
+  "../../../../../../bin/task_block_par_test.pdb"
+  "CMakeFiles/task_block_par_test.dir/task_block_par.cpp.o"
+  "CMakeFiles/task_block_par_test.dir/task_block_par.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/task_block_par_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
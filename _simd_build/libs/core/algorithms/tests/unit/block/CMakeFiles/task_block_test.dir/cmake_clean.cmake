@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/task_block_test"
+  "../../../../../../bin/task_block_test.pdb"
+  "CMakeFiles/task_block_test.dir/task_block.cpp.o"
+  "CMakeFiles/task_block_test.dir/task_block.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/task_block_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/task_group_test"
+  "../../../../../../bin/task_group_test.pdb"
+  "CMakeFiles/task_group_test.dir/task_group.cpp.o"
+  "CMakeFiles/task_group_test.dir/task_group.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/task_group_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
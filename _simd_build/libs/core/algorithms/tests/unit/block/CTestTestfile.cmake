@@ -0,0 +1,16 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/algorithms/tests/unit/block
+# Build directory: /root/repo/_simd_build/libs/core/algorithms/tests/unit/block
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tests.unit.modules.algorithms.block.spmd_block "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/spmd_block_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.block.spmd_block PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/block/CMakeLists.txt;25;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/block/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.block.task_block "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/task_block_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.block.task_block PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/block/CMakeLists.txt;25;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/block/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.block.task_block_executor "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/task_block_executor_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.block.task_block_executor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/block/CMakeLists.txt;25;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/block/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.block.task_block_par "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/task_block_par_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.block.task_block_par PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/block/CMakeLists.txt;25;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/block/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.block.task_group "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/task_group_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.block.task_group PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/block/CMakeLists.txt;25;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/block/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/adjacentdifference_range_test"
+  "../../../../../../bin/adjacentdifference_range_test.pdb"
+  "CMakeFiles/adjacentdifference_range_test.dir/adjacentdifference_range.cpp.o"
+  "CMakeFiles/adjacentdifference_range_test.dir/adjacentdifference_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/adjacentdifference_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/adjacentfind_binary_range_test"
+  "../../../../../../bin/adjacentfind_binary_range_test.pdb"
+  "CMakeFiles/adjacentfind_binary_range_test.dir/adjacentfind_binary_range.cpp.o"
+  "CMakeFiles/adjacentfind_binary_range_test.dir/adjacentfind_binary_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/adjacentfind_binary_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/copy_range_test"
+  "../../../../../../bin/copy_range_test.pdb"
+  "CMakeFiles/copy_range_test.dir/copy_range.cpp.o"
+  "CMakeFiles/copy_range_test.dir/copy_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/copy_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
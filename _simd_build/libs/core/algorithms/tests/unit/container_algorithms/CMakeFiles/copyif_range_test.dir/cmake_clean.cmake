@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/copyif_range_test"
+  "../../../../../../bin/copyif_range_test.pdb"
+  "CMakeFiles/copyif_range_test.dir/copyif_range.cpp.o"
+  "CMakeFiles/copyif_range_test.dir/copyif_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/copyif_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/copyn_range_test"
+  "../../../../../../bin/copyn_range_test.pdb"
+  "CMakeFiles/copyn_range_test.dir/copyn_range.cpp.o"
+  "CMakeFiles/copyn_range_test.dir/copyn_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/copyn_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
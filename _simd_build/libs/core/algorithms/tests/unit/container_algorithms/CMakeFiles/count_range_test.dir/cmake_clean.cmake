@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/count_range_test"
+  "../../../../../../bin/count_range_test.pdb"
+  "CMakeFiles/count_range_test.dir/count_range.cpp.o"
+  "CMakeFiles/count_range_test.dir/count_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/count_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
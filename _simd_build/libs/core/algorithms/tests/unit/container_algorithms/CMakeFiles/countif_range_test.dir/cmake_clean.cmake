@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/countif_range_test"
+  "../../../../../../bin/countif_range_test.pdb"
+  "CMakeFiles/countif_range_test.dir/countif_range.cpp.o"
+  "CMakeFiles/countif_range_test.dir/countif_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/countif_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/destroy_range_test"
+  "../../../../../../bin/destroy_range_test.pdb"
+  "CMakeFiles/destroy_range_test.dir/destroy_range.cpp.o"
+  "CMakeFiles/destroy_range_test.dir/destroy_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/destroy_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
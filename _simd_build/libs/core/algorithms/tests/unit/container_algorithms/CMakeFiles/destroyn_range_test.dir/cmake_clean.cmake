@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/destroyn_range_test"
+  "../../../../../../bin/destroyn_range_test.pdb"
+  "CMakeFiles/destroyn_range_test.dir/destroyn_range.cpp.o"
+  "CMakeFiles/destroyn_range_test.dir/destroyn_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/destroyn_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
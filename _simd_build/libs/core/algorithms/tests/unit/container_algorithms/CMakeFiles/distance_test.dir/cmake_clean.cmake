@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/distance_test"
+  "../../../../../../bin/distance_test.pdb"
+  "CMakeFiles/distance_test.dir/distance.cpp.o"
+  "CMakeFiles/distance_test.dir/distance.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/distance_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
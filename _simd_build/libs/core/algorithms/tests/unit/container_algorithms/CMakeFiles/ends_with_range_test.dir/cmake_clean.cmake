@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/ends_with_range_test"
+  "../../../../../../bin/ends_with_range_test.pdb"
+  "CMakeFiles/ends_with_range_test.dir/ends_with_range.cpp.o"
+  "CMakeFiles/ends_with_range_test.dir/ends_with_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ends_with_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/equal_range_test"
+  "../../../../../../bin/equal_range_test.pdb"
+  "CMakeFiles/equal_range_test.dir/equal_range.cpp.o"
+  "CMakeFiles/equal_range_test.dir/equal_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/equal_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
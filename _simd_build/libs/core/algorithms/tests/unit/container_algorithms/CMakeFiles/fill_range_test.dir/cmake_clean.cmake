@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/fill_range_test"
+  "../../../../../../bin/fill_range_test.pdb"
+  "CMakeFiles/fill_range_test.dir/fill_range.cpp.o"
+  "CMakeFiles/fill_range_test.dir/fill_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fill_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
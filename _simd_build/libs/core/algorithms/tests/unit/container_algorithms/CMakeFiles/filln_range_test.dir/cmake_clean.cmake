@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/filln_range_test"
+  "../../../../../../bin/filln_range_test.pdb"
+  "CMakeFiles/filln_range_test.dir/filln_range.cpp.o"
+  "CMakeFiles/filln_range_test.dir/filln_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/filln_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/find_end_range2_test"
+  "../../../../../../bin/find_end_range2_test.pdb"
+  "CMakeFiles/find_end_range2_test.dir/find_end_range2.cpp.o"
+  "CMakeFiles/find_end_range2_test.dir/find_end_range2.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/find_end_range2_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
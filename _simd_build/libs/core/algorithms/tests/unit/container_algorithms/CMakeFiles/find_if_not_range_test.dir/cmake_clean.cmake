@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/find_if_not_range_test"
+  "../../../../../../bin/find_if_not_range_test.pdb"
+  "CMakeFiles/find_if_not_range_test.dir/find_if_not_range.cpp.o"
+  "CMakeFiles/find_if_not_range_test.dir/find_if_not_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/find_if_not_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
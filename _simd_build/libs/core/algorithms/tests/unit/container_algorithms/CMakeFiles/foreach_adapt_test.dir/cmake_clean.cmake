@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/foreach_adapt_test"
+  "../../../../../../bin/foreach_adapt_test.pdb"
+  "CMakeFiles/foreach_adapt_test.dir/foreach_adapt.cpp.o"
+  "CMakeFiles/foreach_adapt_test.dir/foreach_adapt.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/foreach_adapt_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/foreach_range_sender_test"
+  "../../../../../../bin/foreach_range_sender_test.pdb"
+  "CMakeFiles/foreach_range_sender_test.dir/foreach_range_sender.cpp.o"
+  "CMakeFiles/foreach_range_sender_test.dir/foreach_range_sender.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/foreach_range_sender_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
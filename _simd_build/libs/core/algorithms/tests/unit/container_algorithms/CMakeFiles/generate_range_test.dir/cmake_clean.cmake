@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/generate_range_test"
+  "../../../../../../bin/generate_range_test.pdb"
+  "CMakeFiles/generate_range_test.dir/generate_range.cpp.o"
+  "CMakeFiles/generate_range_test.dir/generate_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/generate_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/includes_range_test"
+  "../../../../../../bin/includes_range_test.pdb"
+  "CMakeFiles/includes_range_test.dir/includes_range.cpp.o"
+  "CMakeFiles/includes_range_test.dir/includes_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/includes_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
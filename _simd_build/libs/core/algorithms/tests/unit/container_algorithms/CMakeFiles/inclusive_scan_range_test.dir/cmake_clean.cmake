@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/inclusive_scan_range_test"
+  "../../../../../../bin/inclusive_scan_range_test.pdb"
+  "CMakeFiles/inclusive_scan_range_test.dir/inclusive_scan_range.cpp.o"
+  "CMakeFiles/inclusive_scan_range_test.dir/inclusive_scan_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/inclusive_scan_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/inplace_merge_range_test"
+  "../../../../../../bin/inplace_merge_range_test.pdb"
+  "CMakeFiles/inplace_merge_range_test.dir/inplace_merge_range.cpp.o"
+  "CMakeFiles/inplace_merge_range_test.dir/inplace_merge_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/inplace_merge_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/is_partitioned_projection_range_test"
+  "../../../../../../bin/is_partitioned_projection_range_test.pdb"
+  "CMakeFiles/is_partitioned_projection_range_test.dir/is_partitioned_projection_range.cpp.o"
+  "CMakeFiles/is_partitioned_projection_range_test.dir/is_partitioned_projection_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/is_partitioned_projection_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/lexicographical_compare_range_test"
+  "../../../../../../bin/lexicographical_compare_range_test.pdb"
+  "CMakeFiles/lexicographical_compare_range_test.dir/lexicographical_compare_range.cpp.o"
+  "CMakeFiles/lexicographical_compare_range_test.dir/lexicographical_compare_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lexicographical_compare_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
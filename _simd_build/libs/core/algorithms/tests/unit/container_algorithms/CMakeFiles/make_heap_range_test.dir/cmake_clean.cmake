@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/make_heap_range_test"
+  "../../../../../../bin/make_heap_range_test.pdb"
+  "CMakeFiles/make_heap_range_test.dir/make_heap_range.cpp.o"
+  "CMakeFiles/make_heap_range_test.dir/make_heap_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/make_heap_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/merge_range_test"
+  "../../../../../../bin/merge_range_test.pdb"
+  "CMakeFiles/merge_range_test.dir/merge_range.cpp.o"
+  "CMakeFiles/merge_range_test.dir/merge_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/merge_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
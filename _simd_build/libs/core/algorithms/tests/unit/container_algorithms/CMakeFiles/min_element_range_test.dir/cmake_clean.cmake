@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/min_element_range_test"
+  "../../../../../../bin/min_element_range_test.pdb"
+  "CMakeFiles/min_element_range_test.dir/min_element_range.cpp.o"
+  "CMakeFiles/min_element_range_test.dir/min_element_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/min_element_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/mismatch_binary_range_test"
+  "../../../../../../bin/mismatch_binary_range_test.pdb"
+  "CMakeFiles/mismatch_binary_range_test.dir/mismatch_binary_range.cpp.o"
+  "CMakeFiles/mismatch_binary_range_test.dir/mismatch_binary_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mismatch_binary_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
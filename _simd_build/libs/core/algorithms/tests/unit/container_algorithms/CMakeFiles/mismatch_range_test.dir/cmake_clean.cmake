@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/mismatch_range_test"
+  "../../../../../../bin/mismatch_range_test.pdb"
+  "CMakeFiles/mismatch_range_test.dir/mismatch_range.cpp.o"
+  "CMakeFiles/mismatch_range_test.dir/mismatch_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mismatch_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
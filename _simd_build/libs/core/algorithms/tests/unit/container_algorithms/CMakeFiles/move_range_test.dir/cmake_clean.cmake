@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/move_range_test"
+  "../../../../../../bin/move_range_test.pdb"
+  "CMakeFiles/move_range_test.dir/move_range.cpp.o"
+  "CMakeFiles/move_range_test.dir/move_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/move_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/partial_sort_range_test"
+  "../../../../../../bin/partial_sort_range_test.pdb"
+  "CMakeFiles/partial_sort_range_test.dir/partial_sort_range.cpp.o"
+  "CMakeFiles/partial_sort_range_test.dir/partial_sort_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/partial_sort_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
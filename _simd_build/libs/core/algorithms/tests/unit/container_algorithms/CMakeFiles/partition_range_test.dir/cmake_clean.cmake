@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/partition_range_test"
+  "../../../../../../bin/partition_range_test.pdb"
+  "CMakeFiles/partition_range_test.dir/partition_range.cpp.o"
+  "CMakeFiles/partition_range_test.dir/partition_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/partition_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
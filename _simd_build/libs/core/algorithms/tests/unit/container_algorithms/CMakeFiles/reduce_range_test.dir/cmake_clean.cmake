@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/reduce_range_test"
+  "../../../../../../bin/reduce_range_test.pdb"
+  "CMakeFiles/reduce_range_test.dir/reduce_range.cpp.o"
+  "CMakeFiles/reduce_range_test.dir/reduce_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/reduce_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
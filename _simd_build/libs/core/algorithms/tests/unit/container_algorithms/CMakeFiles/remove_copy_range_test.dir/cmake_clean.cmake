@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/remove_copy_range_test"
+  "../../../../../../bin/remove_copy_range_test.pdb"
+  "CMakeFiles/remove_copy_range_test.dir/remove_copy_range.cpp.o"
+  "CMakeFiles/remove_copy_range_test.dir/remove_copy_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/remove_copy_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
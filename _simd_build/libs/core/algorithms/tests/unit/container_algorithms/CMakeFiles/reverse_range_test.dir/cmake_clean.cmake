@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/reverse_range_test"
+  "../../../../../../bin/reverse_range_test.pdb"
+  "CMakeFiles/reverse_range_test.dir/reverse_range.cpp.o"
+  "CMakeFiles/reverse_range_test.dir/reverse_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/reverse_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
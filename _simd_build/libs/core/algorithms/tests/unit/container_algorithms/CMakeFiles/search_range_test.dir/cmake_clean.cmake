@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/search_range_test"
+  "../../../../../../bin/search_range_test.pdb"
+  "CMakeFiles/search_range_test.dir/search_range.cpp.o"
+  "CMakeFiles/search_range_test.dir/search_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/search_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/searchn_range_test"
+  "../../../../../../bin/searchn_range_test.pdb"
+  "CMakeFiles/searchn_range_test.dir/searchn_range.cpp.o"
+  "CMakeFiles/searchn_range_test.dir/searchn_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/searchn_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
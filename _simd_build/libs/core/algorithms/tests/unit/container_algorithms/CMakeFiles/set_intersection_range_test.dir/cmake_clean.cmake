@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/set_intersection_range_test"
+  "../../../../../../bin/set_intersection_range_test.pdb"
+  "CMakeFiles/set_intersection_range_test.dir/set_intersection_range.cpp.o"
+  "CMakeFiles/set_intersection_range_test.dir/set_intersection_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/set_intersection_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/set_symmetric_difference_range_test"
+  "../../../../../../bin/set_symmetric_difference_range_test.pdb"
+  "CMakeFiles/set_symmetric_difference_range_test.dir/set_symmetric_difference_range.cpp.o"
+  "CMakeFiles/set_symmetric_difference_range_test.dir/set_symmetric_difference_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/set_symmetric_difference_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
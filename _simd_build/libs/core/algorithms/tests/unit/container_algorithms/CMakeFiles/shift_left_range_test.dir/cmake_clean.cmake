@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/shift_left_range_test"
+  "../../../../../../bin/shift_left_range_test.pdb"
+  "CMakeFiles/shift_left_range_test.dir/shift_left_range.cpp.o"
+  "CMakeFiles/shift_left_range_test.dir/shift_left_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shift_left_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/sort_range_test"
+  "../../../../../../bin/sort_range_test.pdb"
+  "CMakeFiles/sort_range_test.dir/sort_range.cpp.o"
+  "CMakeFiles/sort_range_test.dir/sort_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sort_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
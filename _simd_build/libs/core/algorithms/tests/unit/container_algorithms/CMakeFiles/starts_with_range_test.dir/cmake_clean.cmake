@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/starts_with_range_test"
+  "../../../../../../bin/starts_with_range_test.pdb"
+  "CMakeFiles/starts_with_range_test.dir/starts_with_range.cpp.o"
+  "CMakeFiles/starts_with_range_test.dir/starts_with_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/starts_with_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/swap_ranges_range_test"
+  "../../../../../../bin/swap_ranges_range_test.pdb"
+  "CMakeFiles/swap_ranges_range_test.dir/swap_ranges_range.cpp.o"
+  "CMakeFiles/swap_ranges_range_test.dir/swap_ranges_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/swap_ranges_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
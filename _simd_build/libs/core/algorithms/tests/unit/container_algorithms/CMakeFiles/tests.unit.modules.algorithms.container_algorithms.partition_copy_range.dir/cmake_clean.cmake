@@ -0,0 +1,5 @@
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/tests.unit.modules.algorithms.container_algorithms.partition_copy_range.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/transform_range2_test"
+  "../../../../../../bin/transform_range2_test.pdb"
+  "CMakeFiles/transform_range2_test.dir/transform_range2.cpp.o"
+  "CMakeFiles/transform_range2_test.dir/transform_range2.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/transform_range2_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/transform_range_binary_test"
+  "../../../../../../bin/transform_range_binary_test.pdb"
+  "CMakeFiles/transform_range_binary_test.dir/transform_range_binary.cpp.o"
+  "CMakeFiles/transform_range_binary_test.dir/transform_range_binary.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/transform_range_binary_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/uninitialized_copy_n_range_test"
+  "../../../../../../bin/uninitialized_copy_n_range_test.pdb"
+  "CMakeFiles/uninitialized_copy_n_range_test.dir/uninitialized_copy_n_range.cpp.o"
+  "CMakeFiles/uninitialized_copy_n_range_test.dir/uninitialized_copy_n_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/uninitialized_copy_n_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
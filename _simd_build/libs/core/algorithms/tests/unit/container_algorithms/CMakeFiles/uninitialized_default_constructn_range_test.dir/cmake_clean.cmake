@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/uninitialized_default_constructn_range_test"
+  "../../../../../../bin/uninitialized_default_constructn_range_test.pdb"
+  "CMakeFiles/uninitialized_default_constructn_range_test.dir/uninitialized_default_constructn_range.cpp.o"
+  "CMakeFiles/uninitialized_default_constructn_range_test.dir/uninitialized_default_constructn_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/uninitialized_default_constructn_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
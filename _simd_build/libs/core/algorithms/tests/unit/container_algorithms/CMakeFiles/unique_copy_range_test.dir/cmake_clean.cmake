@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/unique_copy_range_test"
+  "../../../../../../bin/unique_copy_range_test.pdb"
+  "CMakeFiles/unique_copy_range_test.dir/unique_copy_range.cpp.o"
+  "CMakeFiles/unique_copy_range_test.dir/unique_copy_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unique_copy_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
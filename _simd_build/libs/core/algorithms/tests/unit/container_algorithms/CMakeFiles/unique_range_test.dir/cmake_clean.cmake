@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/unique_range_test"
+  "../../../../../../bin/unique_range_test.pdb"
+  "CMakeFiles/unique_range_test.dir/unique_range.cpp.o"
+  "CMakeFiles/unique_range_test.dir/unique_range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unique_range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,240 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/algorithms/tests/unit/container_algorithms
+# Build directory: /root/repo/_simd_build/libs/core/algorithms/tests/unit/container_algorithms
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tests.unit.modules.algorithms.container_algorithms.adjacentdifference_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/adjacentdifference_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.adjacentdifference_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.adjacentdifference_range_sender "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/adjacentdifference_range_sender_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.adjacentdifference_range_sender PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.adjacentfind_bad_alloc_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/adjacentfind_bad_alloc_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.adjacentfind_bad_alloc_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.adjacentfind_binary_bad_alloc_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/adjacentfind_binary_bad_alloc_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.adjacentfind_binary_bad_alloc_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.adjacentfind_binary_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/adjacentfind_binary_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.adjacentfind_binary_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.adjacentfind_binary_projection_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/adjacentfind_binary_projection_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.adjacentfind_binary_projection_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.adjacentfind_binary_exception_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/adjacentfind_binary_exception_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.adjacentfind_binary_exception_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.adjacentfind_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/adjacentfind_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.adjacentfind_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.adjacentfind_exception_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/adjacentfind_exception_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.adjacentfind_exception_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.all_of_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/all_of_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.all_of_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.any_of_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/any_of_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.any_of_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.copy_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/copy_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.copy_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.copyn_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/copyn_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.copyn_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.copyif_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/copyif_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.copyif_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.count_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/count_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.count_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.countif_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/countif_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.countif_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.destroy_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/destroy_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.destroy_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.destroyn_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/destroyn_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.destroyn_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.distance "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/distance_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.distance PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.ends_with_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/ends_with_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.ends_with_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.equal_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/equal_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.equal_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.equal_binary_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/equal_binary_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.equal_binary_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.exclusive_scan_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/exclusive_scan_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.exclusive_scan_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.fill_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/fill_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.fill_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.filln_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/filln_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.filln_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.find_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/find_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.find_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.find_if_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/find_if_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.find_if_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.find_if_not_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/find_if_not_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.find_if_not_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.find_if_not_exception_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/find_if_not_exception_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.find_if_not_exception_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.find_end_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/find_end_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.find_end_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.find_end_range2 "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/find_end_range2_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.find_end_range2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.find_first_of_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/find_first_of_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.find_first_of_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.find_first_of_range2 "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/find_first_of_range2_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.find_first_of_range2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.for_loop_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/for_loop_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.for_loop_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.for_loop_exception_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/for_loop_exception_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.for_loop_exception_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.for_loop_induction_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/for_loop_induction_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.for_loop_induction_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.for_loop_induction_async_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/for_loop_induction_async_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.for_loop_induction_async_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.for_loop_reduction_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/for_loop_reduction_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.for_loop_reduction_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.for_loop_reduction_async_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/for_loop_reduction_async_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.for_loop_reduction_async_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.for_loop_strided_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/for_loop_strided_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.for_loop_strided_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.foreach_adapt "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/foreach_adapt_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.foreach_adapt PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.foreach_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/foreach_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.foreach_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.foreach_range_projection "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/foreach_range_projection_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.foreach_range_projection PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.foreach_range_sender "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/foreach_range_sender_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.foreach_range_sender PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.generate_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/generate_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.generate_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.includes_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/includes_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.includes_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.inclusive_scan_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/inclusive_scan_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.inclusive_scan_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.inplace_merge_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/inplace_merge_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.inplace_merge_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.is_heap_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/is_heap_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.is_heap_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.is_heap_until_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/is_heap_until_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.is_heap_until_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.is_partitioned_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/is_partitioned_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.is_partitioned_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.is_partitioned_projection_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/is_partitioned_projection_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.is_partitioned_projection_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.is_sorted_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/is_sorted_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.is_sorted_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.is_sorted_until_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/is_sorted_until_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.is_sorted_until_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.lexicographical_compare_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/lexicographical_compare_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.lexicographical_compare_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.make_heap_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/make_heap_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.make_heap_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.max_element_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/max_element_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.max_element_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.merge_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/merge_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.merge_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.min_element_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/min_element_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.min_element_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.minmax_element_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/minmax_element_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.minmax_element_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.mismatch_binary_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/mismatch_binary_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.mismatch_binary_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.mismatch_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/mismatch_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.mismatch_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.move_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/move_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.move_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.nth_element_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/nth_element_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.nth_element_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.none_of_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/none_of_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.none_of_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.partial_sort_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/partial_sort_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.partial_sort_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.partial_sort_copy_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/partial_sort_copy_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.partial_sort_copy_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.partition_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/partition_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.partition_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.partition_copy_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/partition_copy_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.partition_copy_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.reduce_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/reduce_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.reduce_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.remove_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/remove_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.remove_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.remove_if_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/remove_if_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.remove_if_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.remove_copy_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/remove_copy_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.remove_copy_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.remove_copy_if_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/remove_copy_if_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.remove_copy_if_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.replace_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/replace_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.replace_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.replace_copy_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/replace_copy_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.replace_copy_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.replace_copy_if_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/replace_copy_if_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.replace_copy_if_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.replace_if_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/replace_if_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.replace_if_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.reverse_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/reverse_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.reverse_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.reverse_copy_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/reverse_copy_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.reverse_copy_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.rotate_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/rotate_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.rotate_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.rotate_copy_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/rotate_copy_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.rotate_copy_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.search_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/search_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.search_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.searchn_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/searchn_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.searchn_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.set_difference_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/set_difference_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.set_difference_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.set_intersection_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/set_intersection_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.set_intersection_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.set_symmetric_difference_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/set_symmetric_difference_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.set_symmetric_difference_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.set_union_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/set_union_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.set_union_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.shift_left_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/shift_left_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.shift_left_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.shift_right_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/shift_right_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.shift_right_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.sort_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/sort_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.sort_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.stable_partition_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/stable_partition_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.stable_partition_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.stable_sort_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/stable_sort_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.stable_sort_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.starts_with_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/starts_with_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.starts_with_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.swap_ranges_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/swap_ranges_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.swap_ranges_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.transform_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/transform_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.transform_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.transform_range_binary "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/transform_range_binary_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.transform_range_binary PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.transform_range2 "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/transform_range2_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.transform_range2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.transform_range_binary2 "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/transform_range_binary2_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.transform_range_binary2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.transform_exclusive_scan_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/transform_exclusive_scan_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.transform_exclusive_scan_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.transform_inclusive_scan_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/transform_inclusive_scan_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.transform_inclusive_scan_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.transform_reduce_binary_bad_alloc_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/transform_reduce_binary_bad_alloc_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.transform_reduce_binary_bad_alloc_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.transform_reduce_binary_exception_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/transform_reduce_binary_exception_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.transform_reduce_binary_exception_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.transform_reduce_binary_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/transform_reduce_binary_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.transform_reduce_binary_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.transform_reduce_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/transform_reduce_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.transform_reduce_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.uninitialized_copy_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/uninitialized_copy_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.uninitialized_copy_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.uninitialized_copy_n_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/uninitialized_copy_n_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.uninitialized_copy_n_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.uninitialized_default_construct_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/uninitialized_default_construct_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.uninitialized_default_construct_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.uninitialized_default_constructn_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/uninitialized_default_constructn_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.uninitialized_default_constructn_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.uninitialized_fill_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/uninitialized_fill_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.uninitialized_fill_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.uninitialized_filln_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/uninitialized_filln_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.uninitialized_filln_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.uninitialized_move_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/uninitialized_move_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.uninitialized_move_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.uninitialized_move_n_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/uninitialized_move_n_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.uninitialized_move_n_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.uninitialized_value_construct_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/uninitialized_value_construct_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.uninitialized_value_construct_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.uninitialized_value_constructn_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/uninitialized_value_constructn_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.uninitialized_value_constructn_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.unique_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/unique_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.unique_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.container_algorithms.unique_copy_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/unique_copy_range_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.container_algorithms.unique_copy_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;149;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/container_algorithms/CMakeLists.txt;0;")
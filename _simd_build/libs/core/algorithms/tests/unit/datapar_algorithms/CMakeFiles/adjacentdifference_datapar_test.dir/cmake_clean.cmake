@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/adjacentdifference_datapar_test"
+  "../../../../../../bin/adjacentdifference_datapar_test.pdb"
+  "CMakeFiles/adjacentdifference_datapar_test.dir/adjacentdifference_datapar.cpp.o"
+  "CMakeFiles/adjacentdifference_datapar_test.dir/adjacentdifference_datapar.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/adjacentdifference_datapar_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/adjacentfind_datapar_test"
+  "../../../../../../bin/adjacentfind_datapar_test.pdb"
+  "CMakeFiles/adjacentfind_datapar_test.dir/adjacentfind_datapar.cpp.o"
+  "CMakeFiles/adjacentfind_datapar_test.dir/adjacentfind_datapar.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/adjacentfind_datapar_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/any_of_datapar_test"
+  "../../../../../../bin/any_of_datapar_test.pdb"
+  "CMakeFiles/any_of_datapar_test.dir/any_of_datapar.cpp.o"
+  "CMakeFiles/any_of_datapar_test.dir/any_of_datapar.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/any_of_datapar_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
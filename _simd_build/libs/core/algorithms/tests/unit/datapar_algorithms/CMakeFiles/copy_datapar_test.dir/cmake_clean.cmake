@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/copy_datapar_test"
+  "../../../../../../bin/copy_datapar_test.pdb"
+  "CMakeFiles/copy_datapar_test.dir/copy_datapar.cpp.o"
+  "CMakeFiles/copy_datapar_test.dir/copy_datapar.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/copy_datapar_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
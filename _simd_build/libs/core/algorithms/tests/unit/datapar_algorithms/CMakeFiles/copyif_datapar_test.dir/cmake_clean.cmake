@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/copyif_datapar_test"
+  "../../../../../../bin/copyif_datapar_test.pdb"
+  "CMakeFiles/copyif_datapar_test.dir/copyif_datapar.cpp.o"
+  "CMakeFiles/copyif_datapar_test.dir/copyif_datapar.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/copyif_datapar_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
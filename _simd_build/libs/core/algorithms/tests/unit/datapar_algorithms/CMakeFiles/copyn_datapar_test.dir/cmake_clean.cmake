@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/copyn_datapar_test"
+  "../../../../../../bin/copyn_datapar_test.pdb"
+  "CMakeFiles/copyn_datapar_test.dir/copyn_datapar.cpp.o"
+  "CMakeFiles/copyn_datapar_test.dir/copyn_datapar.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/copyn_datapar_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
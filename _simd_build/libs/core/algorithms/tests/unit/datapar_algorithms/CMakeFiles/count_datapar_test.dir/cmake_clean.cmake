@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/count_datapar_test"
+  "../../../../../../bin/count_datapar_test.pdb"
+  "CMakeFiles/count_datapar_test.dir/count_datapar.cpp.o"
+  "CMakeFiles/count_datapar_test.dir/count_datapar.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/count_datapar_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/countif_datapar_test"
+  "../../../../../../bin/countif_datapar_test.pdb"
+  "CMakeFiles/countif_datapar_test.dir/countif_datapar.cpp.o"
+  "CMakeFiles/countif_datapar_test.dir/countif_datapar.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/countif_datapar_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/equal_binary_datapar_test"
+  "../../../../../../bin/equal_binary_datapar_test.pdb"
+  "CMakeFiles/equal_binary_datapar_test.dir/equal_binary_datapar.cpp.o"
+  "CMakeFiles/equal_binary_datapar_test.dir/equal_binary_datapar.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/equal_binary_datapar_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/fill_datapar_test"
+  "../../../../../../bin/fill_datapar_test.pdb"
+  "CMakeFiles/fill_datapar_test.dir/fill_datapar.cpp.o"
+  "CMakeFiles/fill_datapar_test.dir/fill_datapar.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fill_datapar_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
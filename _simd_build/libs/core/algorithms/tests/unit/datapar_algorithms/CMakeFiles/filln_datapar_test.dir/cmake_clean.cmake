@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/filln_datapar_test"
+  "../../../../../../bin/filln_datapar_test.pdb"
+  "CMakeFiles/filln_datapar_test.dir/filln_datapar.cpp.o"
+  "CMakeFiles/filln_datapar_test.dir/filln_datapar.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/filln_datapar_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
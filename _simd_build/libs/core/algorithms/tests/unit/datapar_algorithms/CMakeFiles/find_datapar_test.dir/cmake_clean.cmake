@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/find_datapar_test"
+  "../../../../../../bin/find_datapar_test.pdb"
+  "CMakeFiles/find_datapar_test.dir/find_datapar.cpp.o"
+  "CMakeFiles/find_datapar_test.dir/find_datapar.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/find_datapar_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/findend_datapar_test"
+  "../../../../../../bin/findend_datapar_test.pdb"
+  "CMakeFiles/findend_datapar_test.dir/findend_datapar.cpp.o"
+  "CMakeFiles/findend_datapar_test.dir/findend_datapar.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/findend_datapar_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
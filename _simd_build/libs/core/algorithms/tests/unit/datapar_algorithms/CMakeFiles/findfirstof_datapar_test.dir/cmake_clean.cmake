@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/findfirstof_datapar_test"
+  "../../../../../../bin/findfirstof_datapar_test.pdb"
+  "CMakeFiles/findfirstof_datapar_test.dir/findfirstof_datapar.cpp.o"
+  "CMakeFiles/findfirstof_datapar_test.dir/findfirstof_datapar.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/findfirstof_datapar_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/findif_datapar_test"
+  "../../../../../../bin/findif_datapar_test.pdb"
+  "CMakeFiles/findif_datapar_test.dir/findif_datapar.cpp.o"
+  "CMakeFiles/findif_datapar_test.dir/findif_datapar.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/findif_datapar_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
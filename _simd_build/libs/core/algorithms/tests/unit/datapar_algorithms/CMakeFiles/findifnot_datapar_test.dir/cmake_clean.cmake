@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/findifnot_datapar_test"
+  "../../../../../../bin/findifnot_datapar_test.pdb"
+  "CMakeFiles/findifnot_datapar_test.dir/findifnot_datapar.cpp.o"
+  "CMakeFiles/findifnot_datapar_test.dir/findifnot_datapar.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/findifnot_datapar_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
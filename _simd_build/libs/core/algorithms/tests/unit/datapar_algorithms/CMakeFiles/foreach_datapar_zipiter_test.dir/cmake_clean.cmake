@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/foreach_datapar_zipiter_test"
+  "../../../../../../bin/foreach_datapar_zipiter_test.pdb"
+  "CMakeFiles/foreach_datapar_zipiter_test.dir/foreach_datapar_zipiter.cpp.o"
+  "CMakeFiles/foreach_datapar_zipiter_test.dir/foreach_datapar_zipiter.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/foreach_datapar_zipiter_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/foreachn_datapar_test"
+  "../../../../../../bin/foreachn_datapar_test.pdb"
+  "CMakeFiles/foreachn_datapar_test.dir/foreachn_datapar.cpp.o"
+  "CMakeFiles/foreachn_datapar_test.dir/foreachn_datapar.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/foreachn_datapar_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
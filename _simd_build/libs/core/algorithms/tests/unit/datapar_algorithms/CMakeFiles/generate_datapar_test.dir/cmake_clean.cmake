@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/generate_datapar_test"
+  "../../../../../../bin/generate_datapar_test.pdb"
+  "CMakeFiles/generate_datapar_test.dir/generate_datapar.cpp.o"
+  "CMakeFiles/generate_datapar_test.dir/generate_datapar.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/generate_datapar_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/generaten_datapar_test"
+  "../../../../../../bin/generaten_datapar_test.pdb"
+  "CMakeFiles/generaten_datapar_test.dir/generaten_datapar.cpp.o"
+  "CMakeFiles/generaten_datapar_test.dir/generaten_datapar.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/generaten_datapar_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
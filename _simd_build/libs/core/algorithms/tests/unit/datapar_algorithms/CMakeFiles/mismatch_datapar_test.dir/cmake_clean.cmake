@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/mismatch_datapar_test"
+  "../../../../../../bin/mismatch_datapar_test.pdb"
+  "CMakeFiles/mismatch_datapar_test.dir/mismatch_datapar.cpp.o"
+  "CMakeFiles/mismatch_datapar_test.dir/mismatch_datapar.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mismatch_datapar_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/none_of_datapar_test"
+  "../../../../../../bin/none_of_datapar_test.pdb"
+  "CMakeFiles/none_of_datapar_test.dir/none_of_datapar.cpp.o"
+  "CMakeFiles/none_of_datapar_test.dir/none_of_datapar.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/none_of_datapar_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/reduce_datapar_test"
+  "../../../../../../bin/reduce_datapar_test.pdb"
+  "CMakeFiles/reduce_datapar_test.dir/reduce_datapar.cpp.o"
+  "CMakeFiles/reduce_datapar_test.dir/reduce_datapar.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/reduce_datapar_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/replace_if_datapar_test"
+  "../../../../../../bin/replace_if_datapar_test.pdb"
+  "CMakeFiles/replace_if_datapar_test.dir/replace_if_datapar.cpp.o"
+  "CMakeFiles/replace_if_datapar_test.dir/replace_if_datapar.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/replace_if_datapar_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,5 @@
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/tests.unit.modules.algorithms.datapar_algorithms.inclusive_scan_datapar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
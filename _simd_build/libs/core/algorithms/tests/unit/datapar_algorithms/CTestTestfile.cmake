@@ -0,0 +1,82 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/algorithms/tests/unit/datapar_algorithms
+# Build directory: /root/repo/_simd_build/libs/core/algorithms/tests/unit/datapar_algorithms
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tests.unit.modules.algorithms.datapar_algorithms.adjacentfind_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/adjacentfind_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.adjacentfind_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.adjacentdifference_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/adjacentdifference_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.adjacentdifference_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.all_of_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/all_of_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.all_of_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.any_of_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/any_of_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.any_of_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.copy_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/copy_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.copy_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.copyif_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/copyif_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.copyif_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.copyn_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/copyn_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.copyn_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.count_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/count_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.count_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.countif_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/countif_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.countif_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.equal_binary_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/equal_binary_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.equal_binary_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.equal_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/equal_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.equal_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.fill_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/fill_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.fill_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.filln_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/filln_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.filln_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.find_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/find_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.find_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.findend_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/findend_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.findend_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.findfirstof_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/findfirstof_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.findfirstof_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.findif_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/findif_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.findif_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.findifnot_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/findifnot_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.findifnot_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.foreach_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/foreach_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.foreach_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.foreach_datapar_zipiter "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/foreach_datapar_zipiter_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.foreach_datapar_zipiter PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.foreachn_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/foreachn_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.foreachn_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.generate_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/generate_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.generate_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.generaten_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/generaten_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.generaten_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.inclusive_scan_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/inclusive_scan_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.inclusive_scan_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.mismatch_binary_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/mismatch_binary_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.mismatch_binary_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.minmax_element_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/minmax_element_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.minmax_element_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.mismatch_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/mismatch_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.mismatch_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.none_of_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/none_of_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.none_of_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.reduce_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/reduce_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.reduce_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.replace_copy_if_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/replace_copy_if_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.replace_copy_if_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.replace_copy_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/replace_copy_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.replace_copy_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.replace_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/replace_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.replace_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.replace_if_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/replace_if_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.replace_if_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.transform_binary_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/transform_binary_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.transform_binary_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.transform_binary2_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/transform_binary2_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.transform_binary2_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.transform_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/transform_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.transform_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.transform_reduce_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/transform_reduce_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.transform_reduce_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
+add_test(tests.unit.modules.algorithms.datapar_algorithms.transform_reduce_binary_datapar "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/transform_reduce_binary_datapar_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.algorithms.datapar_algorithms.transform_reduce_binary_datapar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;69;add_hpx_unit_test;/root/repo/libs/core/algorithms/tests/unit/datapar_algorithms/CMakeLists.txt;0;")
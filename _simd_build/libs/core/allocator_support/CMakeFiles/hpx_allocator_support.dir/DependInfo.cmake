@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs/src/empty.cpp" "libs/core/allocator_support/CMakeFiles/hpx_allocator_support.dir/__/__/src/empty.cpp.o" "gcc" "libs/core/allocator_support/CMakeFiles/hpx_allocator_support.dir/__/__/src/empty.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_simd_build/libs/core/concepts/CMakeFiles/hpx_concepts.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/config/CMakeFiles/hpx_config.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/preprocessor/CMakeFiles/hpx_preprocessor.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/config_registry/CMakeFiles/hpx_config_registry.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
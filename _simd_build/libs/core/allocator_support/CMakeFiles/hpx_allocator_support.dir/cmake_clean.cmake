@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_allocator_support.a"
+  "../../../lib/libhpx_allocator_support.pdb"
+  "CMakeFiles/hpx_allocator_support.dir/__/__/src/empty.cpp.o"
+  "CMakeFiles/hpx_allocator_support.dir/__/__/src/empty.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_allocator_support.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_allocator_support.a"
+)
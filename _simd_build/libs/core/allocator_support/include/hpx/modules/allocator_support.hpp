@@ -0,0 +1,19 @@
+//  Copyright (c) 2019-2022 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Do not edit this file! It has been generated by the cmake configuration step.
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_MODULE_ALLOCATOR_SUPPORT)
+#include <hpx/allocator_support/aligned_allocator.hpp>
+#include <hpx/allocator_support/allocator_deleter.hpp>
+#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/allocator_support/traits/is_allocator.hpp>
+#endif
+
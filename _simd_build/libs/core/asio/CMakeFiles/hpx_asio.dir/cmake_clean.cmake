@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_asio.a"
+  "../../../lib/libhpx_asio.pdb"
+  "CMakeFiles/hpx_asio.dir/src/asio_util.cpp.o"
+  "CMakeFiles/hpx_asio.dir/src/asio_util.cpp.o.d"
+  "CMakeFiles/hpx_asio.dir/src/map_hostnames.cpp.o"
+  "CMakeFiles/hpx_asio.dir/src/map_hostnames.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_asio.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
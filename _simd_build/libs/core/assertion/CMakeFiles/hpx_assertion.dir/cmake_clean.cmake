@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_assertion.a"
+  "../../../lib/libhpx_assertion.pdb"
+  "CMakeFiles/hpx_assertion.dir/src/assertion.cpp.o"
+  "CMakeFiles/hpx_assertion.dir/src/assertion.cpp.o.d"
+  "CMakeFiles/hpx_assertion.dir/src/source_location.cpp.o"
+  "CMakeFiles/hpx_assertion.dir/src/source_location.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_assertion.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
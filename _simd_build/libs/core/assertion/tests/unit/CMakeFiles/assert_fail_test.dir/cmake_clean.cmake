@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/assert_fail_test"
+  "../../../../../bin/assert_fail_test.pdb"
+  "CMakeFiles/assert_fail_test.dir/assert_fail.cpp.o"
+  "CMakeFiles/assert_fail_test.dir/assert_fail.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/assert_fail_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
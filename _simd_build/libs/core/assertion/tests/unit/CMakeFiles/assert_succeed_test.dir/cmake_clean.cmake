@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/assert_succeed_test"
+  "../../../../../bin/assert_succeed_test.pdb"
+  "CMakeFiles/assert_succeed_test.dir/assert_succeed.cpp.o"
+  "CMakeFiles/assert_succeed_test.dir/assert_succeed.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/assert_succeed_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
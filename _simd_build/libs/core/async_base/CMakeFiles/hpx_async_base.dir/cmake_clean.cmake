@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_async_base.a"
+  "../../../lib/libhpx_async_base.pdb"
+  "CMakeFiles/hpx_async_base.dir/src/launch_policy.cpp.o"
+  "CMakeFiles/hpx_async_base.dir/src/launch_policy.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_async_base.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+//  Copyright (c) 2019-2022 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Do not edit this file! It has been generated by the cmake configuration step.
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_MODULE_ASYNC_BASE)
+#include <hpx/async_base/apply.hpp>
+#include <hpx/async_base/async.hpp>
+#include <hpx/async_base/dataflow.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_base/sync.hpp>
+#include <hpx/async_base/traits/is_launch_policy.hpp>
+#include <hpx/async_base/scheduling_properties.hpp>
+#endif
+
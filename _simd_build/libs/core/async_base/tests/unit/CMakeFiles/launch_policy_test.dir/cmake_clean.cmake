@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/launch_policy_test"
+  "../../../../../bin/launch_policy_test.pdb"
+  "CMakeFiles/launch_policy_test.dir/launch_policy.cpp.o"
+  "CMakeFiles/launch_policy_test.dir/launch_policy.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/launch_policy_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_async_combinators.a"
+  "../../../lib/libhpx_async_combinators.pdb"
+  "CMakeFiles/hpx_async_combinators.dir/__/__/src/empty.cpp.o"
+  "CMakeFiles/hpx_async_combinators.dir/__/__/src/empty.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_async_combinators.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/wait_all_test"
+  "../../../../../bin/wait_all_test.pdb"
+  "CMakeFiles/wait_all_test.dir/wait_all.cpp.o"
+  "CMakeFiles/wait_all_test.dir/wait_all.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wait_all_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
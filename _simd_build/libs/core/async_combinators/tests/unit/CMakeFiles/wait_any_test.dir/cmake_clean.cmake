@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/wait_any_test"
+  "../../../../../bin/wait_any_test.pdb"
+  "CMakeFiles/wait_any_test.dir/wait_any.cpp.o"
+  "CMakeFiles/wait_any_test.dir/wait_any.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wait_any_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
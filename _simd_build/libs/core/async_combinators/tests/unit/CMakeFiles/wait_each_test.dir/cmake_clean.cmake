@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/wait_each_test"
+  "../../../../../bin/wait_each_test.pdb"
+  "CMakeFiles/wait_each_test.dir/wait_each.cpp.o"
+  "CMakeFiles/wait_each_test.dir/wait_each.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wait_each_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
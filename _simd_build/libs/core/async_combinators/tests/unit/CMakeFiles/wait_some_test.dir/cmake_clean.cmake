@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/wait_some_test"
+  "../../../../../bin/wait_some_test.pdb"
+  "CMakeFiles/wait_some_test.dir/wait_some.cpp.o"
+  "CMakeFiles/wait_some_test.dir/wait_some.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wait_some_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
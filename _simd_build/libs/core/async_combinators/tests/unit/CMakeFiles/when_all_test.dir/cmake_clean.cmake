@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/when_all_test"
+  "../../../../../bin/when_all_test.pdb"
+  "CMakeFiles/when_all_test.dir/when_all.cpp.o"
+  "CMakeFiles/when_all_test.dir/when_all.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/when_all_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/when_any_std_array_test"
+  "../../../../../bin/when_any_std_array_test.pdb"
+  "CMakeFiles/when_any_std_array_test.dir/when_any_std_array.cpp.o"
+  "CMakeFiles/when_any_std_array_test.dir/when_any_std_array.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/when_any_std_array_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/when_any_test"
+  "../../../../../bin/when_any_test.pdb"
+  "CMakeFiles/when_any_test.dir/when_any.cpp.o"
+  "CMakeFiles/when_any_test.dir/when_any.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/when_any_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
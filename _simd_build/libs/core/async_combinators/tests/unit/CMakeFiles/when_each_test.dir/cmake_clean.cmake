@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/when_each_test"
+  "../../../../../bin/when_each_test.pdb"
+  "CMakeFiles/when_each_test.dir/when_each.cpp.o"
+  "CMakeFiles/when_each_test.dir/when_each.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/when_each_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
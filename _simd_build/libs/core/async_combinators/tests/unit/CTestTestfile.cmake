@@ -0,0 +1,36 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/async_combinators/tests/unit
+# Build directory: /root/repo/_simd_build/libs/core/async_combinators/tests/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tests.unit.modules.async_combinators.split_shared_future "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/split_shared_future_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.async_combinators.split_shared_future PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/async_combinators/tests/unit/CMakeLists.txt;40;add_hpx_unit_test;/root/repo/libs/core/async_combinators/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.async_combinators.wait_all "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/wait_all_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.async_combinators.wait_all PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/async_combinators/tests/unit/CMakeLists.txt;40;add_hpx_unit_test;/root/repo/libs/core/async_combinators/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.async_combinators.wait_all_std_array "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/wait_all_std_array_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.async_combinators.wait_all_std_array PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/async_combinators/tests/unit/CMakeLists.txt;40;add_hpx_unit_test;/root/repo/libs/core/async_combinators/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.async_combinators.wait_any "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/wait_any_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.async_combinators.wait_any PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/async_combinators/tests/unit/CMakeLists.txt;40;add_hpx_unit_test;/root/repo/libs/core/async_combinators/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.async_combinators.wait_any_std_array "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/wait_any_std_array_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.async_combinators.wait_any_std_array PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/async_combinators/tests/unit/CMakeLists.txt;40;add_hpx_unit_test;/root/repo/libs/core/async_combinators/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.async_combinators.wait_each "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/wait_each_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.async_combinators.wait_each PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/async_combinators/tests/unit/CMakeLists.txt;40;add_hpx_unit_test;/root/repo/libs/core/async_combinators/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.async_combinators.wait_some "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/wait_some_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.async_combinators.wait_some PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/async_combinators/tests/unit/CMakeLists.txt;40;add_hpx_unit_test;/root/repo/libs/core/async_combinators/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.async_combinators.wait_some_std_array "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/wait_some_std_array_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.async_combinators.wait_some_std_array PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/async_combinators/tests/unit/CMakeLists.txt;40;add_hpx_unit_test;/root/repo/libs/core/async_combinators/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.async_combinators.when_all "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/when_all_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.async_combinators.when_all PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/async_combinators/tests/unit/CMakeLists.txt;40;add_hpx_unit_test;/root/repo/libs/core/async_combinators/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.async_combinators.when_all_std_array "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/when_all_std_array_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.async_combinators.when_all_std_array PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/async_combinators/tests/unit/CMakeLists.txt;40;add_hpx_unit_test;/root/repo/libs/core/async_combinators/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.async_combinators.when_any "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/when_any_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.async_combinators.when_any PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/async_combinators/tests/unit/CMakeLists.txt;40;add_hpx_unit_test;/root/repo/libs/core/async_combinators/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.async_combinators.when_any_std_array "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/when_any_std_array_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.async_combinators.when_any_std_array PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/async_combinators/tests/unit/CMakeLists.txt;40;add_hpx_unit_test;/root/repo/libs/core/async_combinators/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.async_combinators.when_each "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/when_each_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.async_combinators.when_each PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/async_combinators/tests/unit/CMakeLists.txt;40;add_hpx_unit_test;/root/repo/libs/core/async_combinators/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.async_combinators.when_some "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/when_some_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.async_combinators.when_some PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/async_combinators/tests/unit/CMakeLists.txt;40;add_hpx_unit_test;/root/repo/libs/core/async_combinators/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.async_combinators.when_some_std_array "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/when_some_std_array_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.async_combinators.when_some_std_array PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/async_combinators/tests/unit/CMakeLists.txt;40;add_hpx_unit_test;/root/repo/libs/core/async_combinators/tests/unit/CMakeLists.txt;0;")
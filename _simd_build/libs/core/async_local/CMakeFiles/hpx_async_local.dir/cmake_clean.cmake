@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_async_local.a"
+  "../../../lib/libhpx_async_local.pdb"
+  "CMakeFiles/hpx_async_local.dir/__/__/src/empty.cpp.o"
+  "CMakeFiles/hpx_async_local.dir/__/__/src/empty.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_async_local.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
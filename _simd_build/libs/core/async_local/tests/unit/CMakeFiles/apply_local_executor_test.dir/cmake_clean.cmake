@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/apply_local_executor_test"
+  "../../../../../bin/apply_local_executor_test.pdb"
+  "CMakeFiles/apply_local_executor_test.dir/apply_local_executor.cpp.o"
+  "CMakeFiles/apply_local_executor_test.dir/apply_local_executor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/apply_local_executor_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
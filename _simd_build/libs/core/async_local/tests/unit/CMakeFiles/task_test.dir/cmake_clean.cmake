@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/task_test"
+  "../../../../../bin/task_test.pdb"
+  "CMakeFiles/task_test.dir/task.cpp.o"
+  "CMakeFiles/task_test.dir/task.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/task_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,18 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/async_local/tests/unit
+# Build directory: /root/repo/_simd_build/libs/core/async_local/tests/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tests.unit.modules.async_local.apply_local "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/apply_local_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.async_local.apply_local PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/async_local/tests/unit/CMakeLists.txt;38;add_hpx_unit_test;/root/repo/libs/core/async_local/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.async_local.apply_local_executor "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/apply_local_executor_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.async_local.apply_local_executor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/async_local/tests/unit/CMakeLists.txt;38;add_hpx_unit_test;/root/repo/libs/core/async_local/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.async_local.async_local "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/async_local_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.async_local.async_local PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/async_local/tests/unit/CMakeLists.txt;38;add_hpx_unit_test;/root/repo/libs/core/async_local/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.async_local.async_local_executor "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/async_local_executor_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.async_local.async_local_executor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/async_local/tests/unit/CMakeLists.txt;38;add_hpx_unit_test;/root/repo/libs/core/async_local/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.async_local.async_local_executor_additional_arguments "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/async_local_executor_additional_arguments_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.async_local.async_local_executor_additional_arguments PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/async_local/tests/unit/CMakeLists.txt;38;add_hpx_unit_test;/root/repo/libs/core/async_local/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.async_local.task "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/task_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.async_local.task PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/async_local/tests/unit/CMakeLists.txt;38;add_hpx_unit_test;/root/repo/libs/core/async_local/tests/unit/CMakeLists.txt;0;")
@@ -0,0 +1,44 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs/core/batch_environments/src/alps_environment.cpp" "libs/core/batch_environments/CMakeFiles/hpx_batch_environments.dir/src/alps_environment.cpp.o" "gcc" "libs/core/batch_environments/CMakeFiles/hpx_batch_environments.dir/src/alps_environment.cpp.o.d"
+  "/root/repo/libs/core/batch_environments/src/batch_environment.cpp" "libs/core/batch_environments/CMakeFiles/hpx_batch_environments.dir/src/batch_environment.cpp.o" "gcc" "libs/core/batch_environments/CMakeFiles/hpx_batch_environments.dir/src/batch_environment.cpp.o.d"
+  "/root/repo/libs/core/batch_environments/src/pbs_environment.cpp" "libs/core/batch_environments/CMakeFiles/hpx_batch_environments.dir/src/pbs_environment.cpp.o" "gcc" "libs/core/batch_environments/CMakeFiles/hpx_batch_environments.dir/src/pbs_environment.cpp.o.d"
+  "/root/repo/libs/core/batch_environments/src/pjm_environment.cpp" "libs/core/batch_environments/CMakeFiles/hpx_batch_environments.dir/src/pjm_environment.cpp.o" "gcc" "libs/core/batch_environments/CMakeFiles/hpx_batch_environments.dir/src/pjm_environment.cpp.o.d"
+  "/root/repo/libs/core/batch_environments/src/slurm_environment.cpp" "libs/core/batch_environments/CMakeFiles/hpx_batch_environments.dir/src/slurm_environment.cpp.o" "gcc" "libs/core/batch_environments/CMakeFiles/hpx_batch_environments.dir/src/slurm_environment.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_simd_build/libs/core/config/CMakeFiles/hpx_config.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/assertion/CMakeFiles/hpx_assertion.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/format/CMakeFiles/hpx_format.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/string_util/CMakeFiles/hpx_string_util.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/errors/CMakeFiles/hpx_errors.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/asio/CMakeFiles/hpx_asio.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/type_support/CMakeFiles/hpx_type_support.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/config_registry/CMakeFiles/hpx_config_registry.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/functional/CMakeFiles/hpx_functional.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/datastructures/CMakeFiles/hpx_datastructures.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/itt_notify/CMakeFiles/hpx_itt_notify.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/serialization/CMakeFiles/hpx_serialization.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/logging/CMakeFiles/hpx_logging.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/filesystem/CMakeFiles/hpx_filesystem.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/timing/CMakeFiles/hpx_timing.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/hardware/CMakeFiles/hpx_hardware.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/thread_support/CMakeFiles/hpx_thread_support.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/debugging/CMakeFiles/hpx_debugging.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/tag_invoke/CMakeFiles/hpx_tag_invoke.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/concepts/CMakeFiles/hpx_concepts.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/preprocessor/CMakeFiles/hpx_preprocessor.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_batch_environments.a"
+  "../../../lib/libhpx_batch_environments.pdb"
+  "CMakeFiles/hpx_batch_environments.dir/src/alps_environment.cpp.o"
+  "CMakeFiles/hpx_batch_environments.dir/src/alps_environment.cpp.o.d"
+  "CMakeFiles/hpx_batch_environments.dir/src/batch_environment.cpp.o"
+  "CMakeFiles/hpx_batch_environments.dir/src/batch_environment.cpp.o.d"
+  "CMakeFiles/hpx_batch_environments.dir/src/pbs_environment.cpp.o"
+  "CMakeFiles/hpx_batch_environments.dir/src/pbs_environment.cpp.o.d"
+  "CMakeFiles/hpx_batch_environments.dir/src/pjm_environment.cpp.o"
+  "CMakeFiles/hpx_batch_environments.dir/src/pjm_environment.cpp.o.d"
+  "CMakeFiles/hpx_batch_environments.dir/src/slurm_environment.cpp.o"
+  "CMakeFiles/hpx_batch_environments.dir/src/slurm_environment.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_batch_environments.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+//  Copyright (c) 2019-2022 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Do not edit this file! It has been generated by the cmake configuration step.
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_MODULE_BATCH_ENVIRONMENTS)
+#include <hpx/batch_environments/alps_environment.hpp>
+#include <hpx/batch_environments/batch_environment.hpp>
+#include <hpx/batch_environments/pjm_environment.hpp>
+#include <hpx/batch_environments/pbs_environment.hpp>
+#include <hpx/batch_environments/slurm_environment.hpp>
+#endif
+
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/parse_slurm_nodelist_test"
+  "../../../../../bin/parse_slurm_nodelist_test.pdb"
+  "CMakeFiles/parse_slurm_nodelist_test.dir/parse_slurm_nodelist.cpp.o"
+  "CMakeFiles/parse_slurm_nodelist_test.dir/parse_slurm_nodelist.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/parse_slurm_nodelist_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
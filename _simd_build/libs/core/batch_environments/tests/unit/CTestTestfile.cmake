@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/batch_environments/tests/unit
+# Build directory: /root/repo/_simd_build/libs/core/batch_environments/tests/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tests.unit.modules.batch_environments.parse_slurm_environment "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/parse_slurm_environment_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.batch_environments.parse_slurm_environment PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/batch_environments/tests/unit/CMakeLists.txt;22;add_hpx_unit_test;/root/repo/libs/core/batch_environments/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.batch_environments.parse_slurm_nodelist "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/parse_slurm_nodelist_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.batch_environments.parse_slurm_nodelist PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/batch_environments/tests/unit/CMakeLists.txt;22;add_hpx_unit_test;/root/repo/libs/core/batch_environments/tests/unit/CMakeLists.txt;0;")
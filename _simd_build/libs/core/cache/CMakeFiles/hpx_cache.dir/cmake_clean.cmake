@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_cache.a"
+  "../../../lib/libhpx_cache.pdb"
+  "CMakeFiles/hpx_cache.dir/__/__/src/empty.cpp.o"
+  "CMakeFiles/hpx_cache.dir/__/__/src/empty.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_cache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
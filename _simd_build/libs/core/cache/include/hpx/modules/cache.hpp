@@ -0,0 +1,26 @@
+//  Copyright (c) 2019-2022 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Do not edit this file! It has been generated by the cmake configuration step.
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_MODULE_CACHE)
+#include <hpx/cache/local_cache.hpp>
+#include <hpx/cache/lru_cache.hpp>
+#include <hpx/cache/entries/entry.hpp>
+#include <hpx/cache/entries/fifo_entry.hpp>
+#include <hpx/cache/entries/lfu_entry.hpp>
+#include <hpx/cache/entries/lru_entry.hpp>
+#include <hpx/cache/entries/size_entry.hpp>
+#include <hpx/cache/policies/always.hpp>
+#include <hpx/cache/statistics/local_full_statistics.hpp>
+#include <hpx/cache/statistics/local_statistics.hpp>
+#include <hpx/cache/statistics/no_statistics.hpp>
+#endif
+
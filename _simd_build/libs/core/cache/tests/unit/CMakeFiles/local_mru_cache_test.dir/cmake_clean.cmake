@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/local_mru_cache_test"
+  "../../../../../bin/local_mru_cache_test.pdb"
+  "CMakeFiles/local_mru_cache_test.dir/local_mru_cache.cpp.o"
+  "CMakeFiles/local_mru_cache_test.dir/local_mru_cache.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/local_mru_cache_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
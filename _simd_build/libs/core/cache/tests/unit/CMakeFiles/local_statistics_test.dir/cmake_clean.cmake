@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/local_statistics_test"
+  "../../../../../bin/local_statistics_test.pdb"
+  "CMakeFiles/local_statistics_test.dir/local_statistics.cpp.o"
+  "CMakeFiles/local_statistics_test.dir/local_statistics.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/local_statistics_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_command_line_handling_local.a"
+  "../../../lib/libhpx_command_line_handling_local.pdb"
+  "CMakeFiles/hpx_command_line_handling_local.dir/src/command_line_handling_local.cpp.o"
+  "CMakeFiles/hpx_command_line_handling_local.dir/src/command_line_handling_local.cpp.o.d"
+  "CMakeFiles/hpx_command_line_handling_local.dir/src/late_command_line_handling_local.cpp.o"
+  "CMakeFiles/hpx_command_line_handling_local.dir/src/late_command_line_handling_local.cpp.o.d"
+  "CMakeFiles/hpx_command_line_handling_local.dir/src/parse_command_line_local.cpp.o"
+  "CMakeFiles/hpx_command_line_handling_local.dir/src/parse_command_line_local.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_command_line_handling_local.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,18 @@
+//  Copyright (c) 2019-2022 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Do not edit this file! It has been generated by the cmake configuration step.
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_MODULE_COMMAND_LINE_HANDLING_LOCAL)
+#include <hpx/command_line_handling_local/command_line_handling_local.hpp>
+#include <hpx/command_line_handling_local/late_command_line_handling_local.hpp>
+#include <hpx/command_line_handling_local/parse_command_line_local.hpp>
+#endif
+
@@ -0,0 +1,81 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs/core/compute_local/src/get_host_targets.cpp" "libs/core/compute_local/CMakeFiles/hpx_compute_local.dir/src/get_host_targets.cpp.o" "gcc" "libs/core/compute_local/CMakeFiles/hpx_compute_local.dir/src/get_host_targets.cpp.o.d"
+  "/root/repo/libs/core/compute_local/src/host_target.cpp" "libs/core/compute_local/CMakeFiles/hpx_compute_local.dir/src/host_target.cpp.o" "gcc" "libs/core/compute_local/CMakeFiles/hpx_compute_local.dir/src/host_target.cpp.o.d"
+  "/root/repo/libs/core/compute_local/src/numa_domains.cpp" "libs/core/compute_local/CMakeFiles/hpx_compute_local.dir/src/numa_domains.cpp.o" "gcc" "libs/core/compute_local/CMakeFiles/hpx_compute_local.dir/src/numa_domains.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_simd_build/libs/core/algorithms/CMakeFiles/hpx_algorithms.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/allocator_support/CMakeFiles/hpx_allocator_support.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/async_combinators/CMakeFiles/hpx_async_combinators.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/concepts/CMakeFiles/hpx_concepts.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/config/CMakeFiles/hpx_config.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/datastructures/CMakeFiles/hpx_datastructures.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/execution/CMakeFiles/hpx_execution.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/executors/CMakeFiles/hpx_executors.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/functional/CMakeFiles/hpx_functional.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/futures/CMakeFiles/hpx_futures.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/iterator_support/CMakeFiles/hpx_iterator_support.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/resource_partitioner/CMakeFiles/hpx_resource_partitioner.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/runtime_local/CMakeFiles/hpx_runtime_local.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/serialization/CMakeFiles/hpx_serialization.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/threadmanager/CMakeFiles/hpx_threadmanager.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/topology/CMakeFiles/hpx_topology.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/type_support/CMakeFiles/hpx_type_support.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/config_registry/CMakeFiles/hpx_config_registry.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/lcos_local/CMakeFiles/hpx_lcos_local.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/thread_pool_util/CMakeFiles/hpx_thread_pool_util.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/async_local/CMakeFiles/hpx_async_local.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/pack_traversal/CMakeFiles/hpx_pack_traversal.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/thread_pools/CMakeFiles/hpx_thread_pools.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/schedulers/CMakeFiles/hpx_schedulers.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/properties/CMakeFiles/hpx_properties.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/threading/CMakeFiles/hpx_threading.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/io_service/CMakeFiles/hpx_io_service.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/command_line_handling_local/CMakeFiles/hpx_command_line_handling_local.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/runtime_configuration/CMakeFiles/hpx_runtime_configuration.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/synchronization/CMakeFiles/hpx_synchronization.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/threading_base/CMakeFiles/hpx_threading_base.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/affinity/CMakeFiles/hpx_affinity.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/async_base/CMakeFiles/hpx_async_base.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/ini/CMakeFiles/hpx_ini.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/coroutines/CMakeFiles/hpx_coroutines.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/util/CMakeFiles/hpx_util.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/memory/CMakeFiles/hpx_memory.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/asio/CMakeFiles/hpx_asio.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/program_options/CMakeFiles/hpx_program_options.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/static_reinit/CMakeFiles/hpx_static_reinit.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/concurrency/CMakeFiles/hpx_concurrency.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/execution_base/CMakeFiles/hpx_execution_base.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/lock_registration/CMakeFiles/hpx_lock_registration.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/hashing/CMakeFiles/hpx_hashing.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/version/CMakeFiles/hpx_version.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/prefix/CMakeFiles/hpx_prefix.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/plugin/CMakeFiles/hpx_plugin.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/tag_invoke/CMakeFiles/hpx_tag_invoke.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/itt_notify/CMakeFiles/hpx_itt_notify.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/debugging/CMakeFiles/hpx_debugging.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/errors/CMakeFiles/hpx_errors.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/logging/CMakeFiles/hpx_logging.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/filesystem/CMakeFiles/hpx_filesystem.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/thread_support/CMakeFiles/hpx_thread_support.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/timing/CMakeFiles/hpx_timing.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/hardware/CMakeFiles/hpx_hardware.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/format/CMakeFiles/hpx_format.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/assertion/CMakeFiles/hpx_assertion.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/preprocessor/CMakeFiles/hpx_preprocessor.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/string_util/CMakeFiles/hpx_string_util.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
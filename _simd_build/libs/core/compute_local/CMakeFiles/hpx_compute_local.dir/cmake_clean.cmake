@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_compute_local.a"
+  "../../../lib/libhpx_compute_local.pdb"
+  "CMakeFiles/hpx_compute_local.dir/src/get_host_targets.cpp.o"
+  "CMakeFiles/hpx_compute_local.dir/src/get_host_targets.cpp.o.d"
+  "CMakeFiles/hpx_compute_local.dir/src/host_target.cpp.o"
+  "CMakeFiles/hpx_compute_local.dir/src/host_target.cpp.o.d"
+  "CMakeFiles/hpx_compute_local.dir/src/numa_domains.cpp.o"
+  "CMakeFiles/hpx_compute_local.dir/src/numa_domains.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_compute_local.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,30 @@
+//  Copyright (c) 2019-2022 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Do not edit this file! It has been generated by the cmake configuration step.
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_MODULE_COMPUTE_LOCAL)
+#include <hpx/compute_local/host.hpp>
+#include <hpx/compute_local/host/block_allocator.hpp>
+#include <hpx/compute_local/host/block_executor.hpp>
+#include <hpx/compute_local/host/block_fork_join_executor.hpp>
+#include <hpx/compute_local/host/get_targets.hpp>
+#include <hpx/compute_local/host/numa_allocator.hpp>
+#include <hpx/compute_local/host/numa_binding_allocator.hpp>
+#include <hpx/compute_local/host/numa_domains.hpp>
+#include <hpx/compute_local/host/target.hpp>
+#include <hpx/compute_local/host/traits/access_target.hpp>
+#include <hpx/compute_local/serialization/vector.hpp>
+#include <hpx/compute_local/traits/access_target.hpp>
+#include <hpx/compute_local/traits/allocator_traits.hpp>
+#include <hpx/compute_local/traits.hpp>
+#include <hpx/compute_local/vector.hpp>
+#endif
+
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/block_allocator_test"
+  "../../../../../bin/block_allocator_test.pdb"
+  "CMakeFiles/block_allocator_test.dir/block_allocator.cpp.o"
+  "CMakeFiles/block_allocator_test.dir/block_allocator.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/block_allocator_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/block_fork_join_executor_test"
+  "../../../../../bin/block_fork_join_executor_test.pdb"
+  "CMakeFiles/block_fork_join_executor_test.dir/block_fork_join_executor.cpp.o"
+  "CMakeFiles/block_fork_join_executor_test.dir/block_fork_join_executor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/block_fork_join_executor_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
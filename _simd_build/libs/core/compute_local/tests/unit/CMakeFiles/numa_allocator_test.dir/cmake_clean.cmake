@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/numa_allocator_test"
+  "../../../../../bin/numa_allocator_test.pdb"
+  "CMakeFiles/numa_allocator_test.dir/numa_allocator.cpp.o"
+  "CMakeFiles/numa_allocator_test.dir/numa_allocator.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/numa_allocator_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
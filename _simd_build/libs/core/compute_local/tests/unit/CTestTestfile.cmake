@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/compute_local/tests/unit
+# Build directory: /root/repo/_simd_build/libs/core/compute_local/tests/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tests.unit.modules.compute_local.block_allocator "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/block_allocator_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.compute_local.block_allocator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/compute_local/tests/unit/CMakeLists.txt;37;add_hpx_unit_test;/root/repo/libs/core/compute_local/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.compute_local.block_fork_join_executor "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/block_fork_join_executor_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.compute_local.block_fork_join_executor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/compute_local/tests/unit/CMakeLists.txt;37;add_hpx_unit_test;/root/repo/libs/core/compute_local/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.compute_local.numa_allocator "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/numa_allocator_test" "-e" "0" "-t" "-2" "-v" "--")
+set_tests_properties(tests.unit.modules.compute_local.numa_allocator PROPERTIES  RUN_SERIAL "TRUE" _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/compute_local/tests/unit/CMakeLists.txt;37;add_hpx_unit_test;/root/repo/libs/core/compute_local/tests/unit/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_concepts.a"
+  "../../../lib/libhpx_concepts.pdb"
+  "CMakeFiles/hpx_concepts.dir/__/__/src/empty.cpp.o"
+  "CMakeFiles/hpx_concepts.dir/__/__/src/empty.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_concepts.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
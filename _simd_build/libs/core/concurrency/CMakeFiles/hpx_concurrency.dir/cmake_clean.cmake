@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_concurrency.a"
+  "../../../lib/libhpx_concurrency.pdb"
+  "CMakeFiles/hpx_concurrency.dir/src/barrier.cpp.o"
+  "CMakeFiles/hpx_concurrency.dir/src/barrier.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_concurrency.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+//  Copyright (c) 2019-2022 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Do not edit this file! It has been generated by the cmake configuration step.
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_MODULE_CONCURRENCY)
+#include <hpx/concurrency/barrier.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/chase_lev_deque.hpp>
+#include <hpx/concurrency/concurrentqueue.hpp>
+#include <hpx/concurrency/deque.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+#include <hpx/concurrency/spinlock_pool.hpp>
+#endif
+
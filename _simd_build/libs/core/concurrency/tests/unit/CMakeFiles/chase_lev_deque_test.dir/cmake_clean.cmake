@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/chase_lev_deque_test"
+  "../../../../../bin/chase_lev_deque_test.pdb"
+  "CMakeFiles/chase_lev_deque_test.dir/chase_lev_deque.cpp.o"
+  "CMakeFiles/chase_lev_deque_test.dir/chase_lev_deque.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/chase_lev_deque_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/contiguous_index_queue_test"
+  "../../../../../bin/contiguous_index_queue_test.pdb"
+  "CMakeFiles/contiguous_index_queue_test.dir/contiguous_index_queue.cpp.o"
+  "CMakeFiles/contiguous_index_queue_test.dir/contiguous_index_queue.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/contiguous_index_queue_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
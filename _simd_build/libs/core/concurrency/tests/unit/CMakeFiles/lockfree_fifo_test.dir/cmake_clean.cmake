@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/lockfree_fifo_test"
+  "../../../../../bin/lockfree_fifo_test.pdb"
+  "CMakeFiles/lockfree_fifo_test.dir/lockfree_fifo.cpp.o"
+  "CMakeFiles/lockfree_fifo_test.dir/lockfree_fifo.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lockfree_fifo_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/concurrency/tests/unit
+# Build directory: /root/repo/_simd_build/libs/core/concurrency/tests/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tests.unit.modules.concurrency.chase_lev_deque "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/chase_lev_deque_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.concurrency.chase_lev_deque PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/concurrency/tests/unit/CMakeLists.txt;24;add_hpx_unit_test;/root/repo/libs/core/concurrency/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.concurrency.contiguous_index_queue "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/contiguous_index_queue_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.concurrency.contiguous_index_queue PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/concurrency/tests/unit/CMakeLists.txt;24;add_hpx_unit_test;/root/repo/libs/core/concurrency/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.concurrency.lockfree_fifo "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/lockfree_fifo_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.concurrency.lockfree_fifo PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/concurrency/tests/unit/CMakeLists.txt;24;add_hpx_unit_test;/root/repo/libs/core/concurrency/tests/unit/CMakeLists.txt;0;")
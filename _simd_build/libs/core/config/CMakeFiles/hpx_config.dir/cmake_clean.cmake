@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_config.a"
+  "../../../lib/libhpx_config.pdb"
+  "CMakeFiles/hpx_config.dir/src/version.cpp.o"
+  "CMakeFiles/hpx_config.dir/src/version.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_config.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
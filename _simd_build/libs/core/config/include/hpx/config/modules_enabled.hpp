@@ -0,0 +1,86 @@
+//  Copyright (c) 2019 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Do not edit this file! It has been generated by the cmake configuration step.
+
+#pragma once
+
+#define HPX_HAVE_MODULE_AFFINITY
+#define HPX_HAVE_MODULE_ALGORITHMS
+#define HPX_HAVE_MODULE_ALLOCATOR_SUPPORT
+#define HPX_HAVE_MODULE_ASIO
+#define HPX_HAVE_MODULE_ASSERTION
+#define HPX_HAVE_MODULE_ASYNC_BASE
+#define HPX_HAVE_MODULE_ASYNC_COMBINATORS
+#define HPX_HAVE_MODULE_ASYNC_LOCAL
+#define HPX_HAVE_MODULE_BATCH_ENVIRONMENTS
+#define HPX_HAVE_MODULE_CACHE
+#define HPX_HAVE_MODULE_CHECKPOINT_BASE
+#define HPX_HAVE_MODULE_COMMAND_LINE_HANDLING
+#define HPX_HAVE_MODULE_COMMAND_LINE_HANDLING_LOCAL
+#define HPX_HAVE_MODULE_COMPUTE
+#define HPX_HAVE_MODULE_COMPUTE_LOCAL
+#define HPX_HAVE_MODULE_CONCEPTS
+#define HPX_HAVE_MODULE_CONCURRENCY
+#define HPX_HAVE_MODULE_CONFIG
+#define HPX_HAVE_MODULE_CONFIG_REGISTRY
+#define HPX_HAVE_MODULE_COROUTINES
+#define HPX_HAVE_MODULE_DATASTRUCTURES
+#define HPX_HAVE_MODULE_DEBUGGING
+#define HPX_HAVE_MODULE_ERRORS
+#define HPX_HAVE_MODULE_EXECUTION
+#define HPX_HAVE_MODULE_EXECUTION_BASE
+#define HPX_HAVE_MODULE_EXECUTORS
+#define HPX_HAVE_MODULE_FILESYSTEM
+#define HPX_HAVE_MODULE_FORMAT
+#define HPX_HAVE_MODULE_FUNCTIONAL
+#define HPX_HAVE_MODULE_FUTURES
+#define HPX_HAVE_MODULE_HARDWARE
+#define HPX_HAVE_MODULE_HASHING
+#define HPX_HAVE_MODULE_INCLUDE_LOCAL
+#define HPX_HAVE_MODULE_INI
+#define HPX_HAVE_MODULE_INIT_RUNTIME
+#define HPX_HAVE_MODULE_INIT_RUNTIME_LOCAL
+#define HPX_HAVE_MODULE_IO_SERVICE
+#define HPX_HAVE_MODULE_ITERATOR_SUPPORT
+#define HPX_HAVE_MODULE_ITT_NOTIFY
+#define HPX_HAVE_MODULE_LCOS_LOCAL
+#define HPX_HAVE_MODULE_LOCK_REGISTRATION
+#define HPX_HAVE_MODULE_LOGGING
+#define HPX_HAVE_MODULE_MEMORY
+#define HPX_HAVE_MODULE_PACK_TRAVERSAL
+#define HPX_HAVE_MODULE_PARCELSET
+#define HPX_HAVE_MODULE_PARCELSET_BASE
+#define HPX_HAVE_MODULE_PLUGIN
+#define HPX_HAVE_MODULE_PLUGIN_FACTORIES
+#define HPX_HAVE_MODULE_PREFIX
+#define HPX_HAVE_MODULE_PREPROCESSOR
+#define HPX_HAVE_MODULE_PROGRAM_OPTIONS
+#define HPX_HAVE_MODULE_PROPERTIES
+#define HPX_HAVE_MODULE_RESILIENCY
+#define HPX_HAVE_MODULE_RESOURCE_PARTITIONER
+#define HPX_HAVE_MODULE_RUNTIME_CONFIGURATION
+#define HPX_HAVE_MODULE_RUNTIME_LOCAL
+#define HPX_HAVE_MODULE_SCHEDULERS
+#define HPX_HAVE_MODULE_SERIALIZATION
+#define HPX_HAVE_MODULE_STATIC_REINIT
+#define HPX_HAVE_MODULE_STRING_UTIL
+#define HPX_HAVE_MODULE_SYNCHRONIZATION
+#define HPX_HAVE_MODULE_TAG_INVOKE
+#define HPX_HAVE_MODULE_TESTING
+#define HPX_HAVE_MODULE_THREAD_POOL_UTIL
+#define HPX_HAVE_MODULE_THREAD_POOLS
+#define HPX_HAVE_MODULE_THREAD_SUPPORT
+#define HPX_HAVE_MODULE_THREADING
+#define HPX_HAVE_MODULE_THREADING_BASE
+#define HPX_HAVE_MODULE_THREADMANAGER
+#define HPX_HAVE_MODULE_TIMED_EXECUTION
+#define HPX_HAVE_MODULE_TIMING
+#define HPX_HAVE_MODULE_TOPOLOGY
+#define HPX_HAVE_MODULE_TYPE_SUPPORT
+#define HPX_HAVE_MODULE_UTIL
+#define HPX_HAVE_MODULE_VERSION
+
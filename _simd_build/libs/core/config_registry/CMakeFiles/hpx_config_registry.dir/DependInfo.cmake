@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs/core/config_registry/src/config_entries.cpp" "libs/core/config_registry/CMakeFiles/hpx_config_registry.dir/src/config_entries.cpp.o" "gcc" "libs/core/config_registry/CMakeFiles/hpx_config_registry.dir/src/config_entries.cpp.o.d"
+  "/root/repo/libs/core/config_registry/src/config_registry.cpp" "libs/core/config_registry/CMakeFiles/hpx_config_registry.dir/src/config_registry.cpp.o" "gcc" "libs/core/config_registry/CMakeFiles/hpx_config_registry.dir/src/config_registry.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
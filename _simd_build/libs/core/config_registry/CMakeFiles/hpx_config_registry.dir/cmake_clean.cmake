@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_config_registry.a"
+  "../../../lib/libhpx_config_registry.pdb"
+  "CMakeFiles/hpx_config_registry.dir/src/config_entries.cpp.o"
+  "CMakeFiles/hpx_config_registry.dir/src/config_entries.cpp.o.d"
+  "CMakeFiles/hpx_config_registry.dir/src/config_registry.cpp.o"
+  "CMakeFiles/hpx_config_registry.dir/src/config_registry.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_config_registry.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/config_registry_test"
+  "../../../../../bin/config_registry_test.pdb"
+  "CMakeFiles/config_registry_test.dir/config_registry.cpp.o"
+  "CMakeFiles/config_registry_test.dir/config_registry.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/config_registry_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_coroutines.a"
+  "../../../lib/libhpx_coroutines.pdb"
+  "CMakeFiles/hpx_coroutines.dir/src/config_entries.cpp.o"
+  "CMakeFiles/hpx_coroutines.dir/src/config_entries.cpp.o.d"
+  "CMakeFiles/hpx_coroutines.dir/src/detail/context_base.cpp.o"
+  "CMakeFiles/hpx_coroutines.dir/src/detail/context_base.cpp.o.d"
+  "CMakeFiles/hpx_coroutines.dir/src/detail/context_posix.cpp.o"
+  "CMakeFiles/hpx_coroutines.dir/src/detail/context_posix.cpp.o.d"
+  "CMakeFiles/hpx_coroutines.dir/src/detail/coroutine_impl.cpp.o"
+  "CMakeFiles/hpx_coroutines.dir/src/detail/coroutine_impl.cpp.o.d"
+  "CMakeFiles/hpx_coroutines.dir/src/detail/coroutine_self.cpp.o"
+  "CMakeFiles/hpx_coroutines.dir/src/detail/coroutine_self.cpp.o.d"
+  "CMakeFiles/hpx_coroutines.dir/src/detail/growable_stacks.cpp.o"
+  "CMakeFiles/hpx_coroutines.dir/src/detail/growable_stacks.cpp.o.d"
+  "CMakeFiles/hpx_coroutines.dir/src/detail/posix_utility.cpp.o"
+  "CMakeFiles/hpx_coroutines.dir/src/detail/posix_utility.cpp.o.d"
+  "CMakeFiles/hpx_coroutines.dir/src/detail/stack_arena.cpp.o"
+  "CMakeFiles/hpx_coroutines.dir/src/detail/stack_arena.cpp.o.d"
+  "CMakeFiles/hpx_coroutines.dir/src/detail/tss.cpp.o"
+  "CMakeFiles/hpx_coroutines.dir/src/detail/tss.cpp.o.d"
+  "CMakeFiles/hpx_coroutines.dir/src/signal_handler_debugging.cpp.o"
+  "CMakeFiles/hpx_coroutines.dir/src/signal_handler_debugging.cpp.o.d"
+  "CMakeFiles/hpx_coroutines.dir/src/swapcontext.cpp.o"
+  "CMakeFiles/hpx_coroutines.dir/src/swapcontext.cpp.o.d"
+  "CMakeFiles/hpx_coroutines.dir/src/thread_enums.cpp.o"
+  "CMakeFiles/hpx_coroutines.dir/src/thread_enums.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_coroutines.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
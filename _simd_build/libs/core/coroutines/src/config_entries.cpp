@@ -0,0 +1,20 @@
+//  Copyright (c) 2017-2021 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Do not edit this file! It has been generated by the cmake configuration step.
+
+#include <hpx/modules/config_registry.hpp>
+
+namespace hpx { namespace coroutines_cfg {
+
+    config_registry::add_module_config_helper add_config{
+    {
+        "coroutines",
+        {
+        "HPX_COROUTINES_WITH_SWAP_CONTEXT_EMULATION=OFF",
+        }
+    }};
+}}
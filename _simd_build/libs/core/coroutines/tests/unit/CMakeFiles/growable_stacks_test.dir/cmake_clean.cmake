@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/growable_stacks_test"
+  "../../../../../bin/growable_stacks_test.pdb"
+  "CMakeFiles/growable_stacks_test.dir/growable_stacks.cpp.o"
+  "CMakeFiles/growable_stacks_test.dir/growable_stacks.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/growable_stacks_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
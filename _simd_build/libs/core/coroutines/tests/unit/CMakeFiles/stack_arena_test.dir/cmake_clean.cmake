@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/stack_arena_test"
+  "../../../../../bin/stack_arena_test.pdb"
+  "CMakeFiles/stack_arena_test.dir/stack_arena.cpp.o"
+  "CMakeFiles/stack_arena_test.dir/stack_arena.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stack_arena_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_datastructures.a"
+  "../../../lib/libhpx_datastructures.pdb"
+  "CMakeFiles/hpx_datastructures.dir/src/config_entries.cpp.o"
+  "CMakeFiles/hpx_datastructures.dir/src/config_entries.cpp.o.d"
+  "CMakeFiles/hpx_datastructures.dir/src/serializable_any.cpp.o"
+  "CMakeFiles/hpx_datastructures.dir/src/serializable_any.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_datastructures.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
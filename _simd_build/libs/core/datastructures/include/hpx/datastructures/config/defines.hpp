@@ -0,0 +1,11 @@
+//  Copyright (c) 2019-2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Do not edit this file! It has been generated by the cmake configuration step.
+
+#pragma once
+#define HPX_DATASTRUCTURES_HAVE_ADAPT_STD_TUPLE
+
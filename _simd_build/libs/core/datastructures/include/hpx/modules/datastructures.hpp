@@ -0,0 +1,22 @@
+//  Copyright (c) 2019-2022 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Do not edit this file! It has been generated by the cmake configuration step.
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_MODULE_DATASTRUCTURES)
+#include <hpx/datastructures/any.hpp>
+#include <hpx/datastructures/member_pack.hpp>
+#include <hpx/datastructures/optional.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/datastructures/traits/supports_streaming_with_any.hpp>
+#include <hpx/datastructures/traits/is_tuple_like.hpp>
+#include <hpx/datastructures/variant.hpp>
+#endif
+
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/any_serialization_test"
+  "../../../../../bin/any_serialization_test.pdb"
+  "CMakeFiles/any_serialization_test.dir/any_serialization.cpp.o"
+  "CMakeFiles/any_serialization_test.dir/any_serialization.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/any_serialization_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/any_test"
+  "../../../../../bin/any_test.pdb"
+  "CMakeFiles/any_test.dir/any.cpp.o"
+  "CMakeFiles/any_test.dir/any.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/any_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
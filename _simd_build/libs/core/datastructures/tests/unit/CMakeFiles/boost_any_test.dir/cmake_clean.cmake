@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/boost_any_test"
+  "../../../../../bin/boost_any_test.pdb"
+  "CMakeFiles/boost_any_test.dir/boost_any.cpp.o"
+  "CMakeFiles/boost_any_test.dir/boost_any.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/boost_any_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
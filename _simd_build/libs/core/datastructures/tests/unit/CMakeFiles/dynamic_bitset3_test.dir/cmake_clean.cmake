@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/dynamic_bitset3_test"
+  "../../../../../bin/dynamic_bitset3_test.pdb"
+  "CMakeFiles/dynamic_bitset3_test.dir/dynamic_bitset3.cpp.o"
+  "CMakeFiles/dynamic_bitset3_test.dir/dynamic_bitset3.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dynamic_bitset3_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/dynamic_bitset4_test"
+  "../../../../../bin/dynamic_bitset4_test.pdb"
+  "CMakeFiles/dynamic_bitset4_test.dir/dynamic_bitset4.cpp.o"
+  "CMakeFiles/dynamic_bitset4_test.dir/dynamic_bitset4.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dynamic_bitset4_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
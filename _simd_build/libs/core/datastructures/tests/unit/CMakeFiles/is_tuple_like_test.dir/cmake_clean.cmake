@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/is_tuple_like_test"
+  "../../../../../bin/is_tuple_like_test.pdb"
+  "CMakeFiles/is_tuple_like_test.dir/is_tuple_like.cpp.o"
+  "CMakeFiles/is_tuple_like_test.dir/is_tuple_like.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/is_tuple_like_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
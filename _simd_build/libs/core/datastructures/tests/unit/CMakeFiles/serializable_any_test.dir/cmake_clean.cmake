@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/serializable_any_test"
+  "../../../../../bin/serializable_any_test.pdb"
+  "CMakeFiles/serializable_any_test.dir/serializable_any.cpp.o"
+  "CMakeFiles/serializable_any_test.dir/serializable_any.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/serializable_any_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/serialization_optional_test"
+  "../../../../../bin/serialization_optional_test.pdb"
+  "CMakeFiles/serialization_optional_test.dir/serialization_optional.cpp.o"
+  "CMakeFiles/serialization_optional_test.dir/serialization_optional.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/serialization_optional_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
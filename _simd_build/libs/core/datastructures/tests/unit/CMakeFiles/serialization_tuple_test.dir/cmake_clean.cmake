@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/serialization_tuple_test"
+  "../../../../../bin/serialization_tuple_test.pdb"
+  "CMakeFiles/serialization_tuple_test.dir/serialization_tuple.cpp.o"
+  "CMakeFiles/serialization_tuple_test.dir/serialization_tuple.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/serialization_tuple_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/small_vector_test"
+  "../../../../../bin/small_vector_test.pdb"
+  "CMakeFiles/small_vector_test.dir/small_vector.cpp.o"
+  "CMakeFiles/small_vector_test.dir/small_vector.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/small_vector_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/tuple_test"
+  "../../../../../bin/tuple_test.pdb"
+  "CMakeFiles/tuple_test.dir/tuple.cpp.o"
+  "CMakeFiles/tuple_test.dir/tuple.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tuple_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/unique_any_test"
+  "../../../../../bin/unique_any_test.pdb"
+  "CMakeFiles/unique_any_test.dir/unique_any.cpp.o"
+  "CMakeFiles/unique_any_test.dir/unique_any.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unique_any_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
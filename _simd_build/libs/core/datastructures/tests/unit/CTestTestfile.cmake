@@ -0,0 +1,40 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/datastructures/tests/unit
+# Build directory: /root/repo/_simd_build/libs/core/datastructures/tests/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tests.unit.modules.datastructures.any "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/any_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.datastructures.any PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;45;add_hpx_unit_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.datastructures.any_serialization "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/any_serialization_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.datastructures.any_serialization PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;45;add_hpx_unit_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.datastructures.boost_any "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/boost_any_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.datastructures.boost_any PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;45;add_hpx_unit_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.datastructures.dynamic_bitset1 "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/dynamic_bitset1_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.datastructures.dynamic_bitset1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;45;add_hpx_unit_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.datastructures.dynamic_bitset2 "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/dynamic_bitset2_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.datastructures.dynamic_bitset2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;45;add_hpx_unit_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.datastructures.dynamic_bitset3 "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/dynamic_bitset3_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.datastructures.dynamic_bitset3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;45;add_hpx_unit_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.datastructures.dynamic_bitset4 "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/dynamic_bitset4_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.datastructures.dynamic_bitset4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;45;add_hpx_unit_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.datastructures.dynamic_bitset5 "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/dynamic_bitset5_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.datastructures.dynamic_bitset5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;45;add_hpx_unit_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.datastructures.is_tuple_like "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/is_tuple_like_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.datastructures.is_tuple_like PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;45;add_hpx_unit_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.datastructures.serializable_any "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/serializable_any_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.datastructures.serializable_any PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;45;add_hpx_unit_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.datastructures.serializable_boost_any "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/serializable_boost_any_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.datastructures.serializable_boost_any PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;45;add_hpx_unit_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.datastructures.serialization_optional "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/serialization_optional_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.datastructures.serialization_optional PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;45;add_hpx_unit_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.datastructures.serialization_raw_pointer_tuple "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/serialization_raw_pointer_tuple_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.datastructures.serialization_raw_pointer_tuple PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;45;add_hpx_unit_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.datastructures.serialization_tuple "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/serialization_tuple_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.datastructures.serialization_tuple PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;45;add_hpx_unit_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.datastructures.tuple "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/tuple_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.datastructures.tuple PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;45;add_hpx_unit_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.datastructures.unique_any "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/unique_any_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.datastructures.unique_any PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;45;add_hpx_unit_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.datastructures.small_vector "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/small_vector_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.datastructures.small_vector PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;45;add_hpx_unit_test;/root/repo/libs/core/datastructures/tests/unit/CMakeLists.txt;0;")
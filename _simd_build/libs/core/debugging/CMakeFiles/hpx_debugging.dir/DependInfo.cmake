@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs/core/debugging/src/attach_debugger.cpp" "libs/core/debugging/CMakeFiles/hpx_debugging.dir/src/attach_debugger.cpp.o" "gcc" "libs/core/debugging/CMakeFiles/hpx_debugging.dir/src/attach_debugger.cpp.o.d"
+  "/root/repo/libs/core/debugging/src/backtrace.cpp" "libs/core/debugging/CMakeFiles/hpx_debugging.dir/src/backtrace.cpp.o" "gcc" "libs/core/debugging/CMakeFiles/hpx_debugging.dir/src/backtrace.cpp.o.d"
+  "/root/repo/libs/core/debugging/src/print.cpp" "libs/core/debugging/CMakeFiles/hpx_debugging.dir/src/print.cpp.o" "gcc" "libs/core/debugging/CMakeFiles/hpx_debugging.dir/src/print.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_simd_build/libs/core/config/CMakeFiles/hpx_config.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/config_registry/CMakeFiles/hpx_config_registry.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/preprocessor/CMakeFiles/hpx_preprocessor.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
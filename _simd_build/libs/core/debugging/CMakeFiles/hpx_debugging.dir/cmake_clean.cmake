@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_debugging.a"
+  "../../../lib/libhpx_debugging.pdb"
+  "CMakeFiles/hpx_debugging.dir/src/attach_debugger.cpp.o"
+  "CMakeFiles/hpx_debugging.dir/src/attach_debugger.cpp.o.d"
+  "CMakeFiles/hpx_debugging.dir/src/backtrace.cpp.o"
+  "CMakeFiles/hpx_debugging.dir/src/backtrace.cpp.o.d"
+  "CMakeFiles/hpx_debugging.dir/src/print.cpp.o"
+  "CMakeFiles/hpx_debugging.dir/src/print.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_debugging.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
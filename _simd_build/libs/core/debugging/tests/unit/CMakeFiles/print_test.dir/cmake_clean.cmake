@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/print_test"
+  "../../../../../bin/print_test.pdb"
+  "CMakeFiles/print_test.dir/print.cpp.o"
+  "CMakeFiles/print_test.dir/print.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/print_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
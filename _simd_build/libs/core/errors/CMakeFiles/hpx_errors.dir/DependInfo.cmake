@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs/core/errors/src/error_code.cpp" "libs/core/errors/CMakeFiles/hpx_errors.dir/src/error_code.cpp.o" "gcc" "libs/core/errors/CMakeFiles/hpx_errors.dir/src/error_code.cpp.o.d"
+  "/root/repo/libs/core/errors/src/exception.cpp" "libs/core/errors/CMakeFiles/hpx_errors.dir/src/exception.cpp.o" "gcc" "libs/core/errors/CMakeFiles/hpx_errors.dir/src/exception.cpp.o.d"
+  "/root/repo/libs/core/errors/src/exception_list.cpp" "libs/core/errors/CMakeFiles/hpx_errors.dir/src/exception_list.cpp.o" "gcc" "libs/core/errors/CMakeFiles/hpx_errors.dir/src/exception_list.cpp.o.d"
+  "/root/repo/libs/core/errors/src/throw_exception.cpp" "libs/core/errors/CMakeFiles/hpx_errors.dir/src/throw_exception.cpp.o" "gcc" "libs/core/errors/CMakeFiles/hpx_errors.dir/src/throw_exception.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_simd_build/libs/core/assertion/CMakeFiles/hpx_assertion.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/config/CMakeFiles/hpx_config.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/filesystem/CMakeFiles/hpx_filesystem.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/format/CMakeFiles/hpx_format.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/logging/CMakeFiles/hpx_logging.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/preprocessor/CMakeFiles/hpx_preprocessor.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/thread_support/CMakeFiles/hpx_thread_support.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/config_registry/CMakeFiles/hpx_config_registry.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/timing/CMakeFiles/hpx_timing.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/type_support/CMakeFiles/hpx_type_support.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/concepts/CMakeFiles/hpx_concepts.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/hardware/CMakeFiles/hpx_hardware.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
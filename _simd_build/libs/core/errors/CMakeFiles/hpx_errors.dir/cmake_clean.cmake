@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_errors.a"
+  "../../../lib/libhpx_errors.pdb"
+  "CMakeFiles/hpx_errors.dir/src/error_code.cpp.o"
+  "CMakeFiles/hpx_errors.dir/src/error_code.cpp.o.d"
+  "CMakeFiles/hpx_errors.dir/src/exception.cpp.o"
+  "CMakeFiles/hpx_errors.dir/src/exception.cpp.o.d"
+  "CMakeFiles/hpx_errors.dir/src/exception_list.cpp.o"
+  "CMakeFiles/hpx_errors.dir/src/exception_list.cpp.o.d"
+  "CMakeFiles/hpx_errors.dir/src/throw_exception.cpp.o"
+  "CMakeFiles/hpx_errors.dir/src/throw_exception.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_errors.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
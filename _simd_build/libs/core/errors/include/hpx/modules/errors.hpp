@@ -0,0 +1,23 @@
+//  Copyright (c) 2019-2022 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Do not edit this file! It has been generated by the cmake configuration step.
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_MODULE_ERRORS)
+#include <hpx/errors/error.hpp>
+#include <hpx/errors/error_code.hpp>
+#include <hpx/errors/exception.hpp>
+#include <hpx/errors/exception_fwd.hpp>
+#include <hpx/errors/exception_info.hpp>
+#include <hpx/errors/exception_list.hpp>
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/errors/try_catch_exception_ptr.hpp>
+#endif
+
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_execution.a"
+  "../../../lib/libhpx_execution.pdb"
+  "CMakeFiles/hpx_execution.dir/src/autotuned_chunk_size.cpp.o"
+  "CMakeFiles/hpx_execution.dir/src/autotuned_chunk_size.cpp.o.d"
+  "CMakeFiles/hpx_execution.dir/src/execution_parameter_callbacks.cpp.o"
+  "CMakeFiles/hpx_execution.dir/src/execution_parameter_callbacks.cpp.o.d"
+  "CMakeFiles/hpx_execution.dir/src/polymorphic_executor.cpp.o"
+  "CMakeFiles/hpx_execution.dir/src/polymorphic_executor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_execution.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
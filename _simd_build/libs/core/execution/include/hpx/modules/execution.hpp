@@ -0,0 +1,71 @@
+//  Copyright (c) 2019-2022 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Do not edit this file! It has been generated by the cmake configuration step.
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_MODULE_EXECUTION)
+#include <hpx/execution/algorithms/as_sender.hpp>
+#include <hpx/execution/algorithms/bulk.hpp>
+#include <hpx/execution/algorithms/ensure_started.hpp>
+#include <hpx/execution/algorithms/execute.hpp>
+#include <hpx/execution/algorithms/just.hpp>
+#include <hpx/execution/algorithms/keep_future.hpp>
+#include <hpx/execution/algorithms/let_error.hpp>
+#include <hpx/execution/algorithms/let_stopped.hpp>
+#include <hpx/execution/algorithms/let_value.hpp>
+#include <hpx/execution/algorithms/make_future.hpp>
+#include <hpx/execution/algorithms/run_loop.hpp>
+#include <hpx/execution/algorithms/schedule_from.hpp>
+#include <hpx/execution/algorithms/split.hpp>
+#include <hpx/execution/algorithms/start_detached.hpp>
+#include <hpx/execution/algorithms/sync_wait.hpp>
+#include <hpx/execution/algorithms/then.hpp>
+#include <hpx/execution/algorithms/transfer.hpp>
+#include <hpx/execution/algorithms/transfer_just.hpp>
+#include <hpx/execution/algorithms/when_all.hpp>
+#include <hpx/execution/execution.hpp>
+#include <hpx/execution/executor_parameters.hpp>
+#include <hpx/execution/executors/adaptive_static_chunk_size.hpp>
+#include <hpx/execution/executors/auto_chunk_size.hpp>
+#include <hpx/execution/executors/autotuned_chunk_size.hpp>
+#include <hpx/execution/executors/dynamic_chunk_size.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_information.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution/executors/execution_parameters_fwd.hpp>
+#include <hpx/execution/executors/fused_bulk_execute.hpp>
+#include <hpx/execution/executors/guided_chunk_size.hpp>
+#include <hpx/execution/executors/lazy_binary_splitting.hpp>
+#include <hpx/execution/executors/memory_hints.hpp>
+#include <hpx/execution/executors/num_cores.hpp>
+#include <hpx/execution/executors/persistent_auto_chunk_size.hpp>
+#include <hpx/execution/executors/polymorphic_executor.hpp>
+#include <hpx/execution/executors/rebind_executor.hpp>
+#include <hpx/execution/executors/static_chunk_size.hpp>
+#include <hpx/execution/queries/get_allocator.hpp>
+#include <hpx/execution/queries/get_scheduler.hpp>
+#include <hpx/execution/queries/get_delegatee_scheduler.hpp>
+#include <hpx/execution/queries/get_stop_token.hpp>
+#include <hpx/execution/queries/read.hpp>
+#include <hpx/execution/traits/executor_traits.hpp>
+#include <hpx/execution/traits/future_then_result_exec.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_alignment_size.hpp>
+#include <hpx/execution/traits/vector_pack_all_any_none.hpp>
+#include <hpx/execution/traits/vector_pack_conditionals.hpp>
+#include <hpx/execution/traits/vector_pack_count_bits.hpp>
+#include <hpx/execution/traits/vector_pack_find.hpp>
+#include <hpx/execution/traits/vector_pack_get_set.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_reduce.hpp>
+#include <hpx/execution/traits/vector_pack_scan.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#endif
+
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/algorithm_as_sender_test"
+  "../../../../../bin/algorithm_as_sender_test.pdb"
+  "CMakeFiles/algorithm_as_sender_test.dir/algorithm_as_sender.cpp.o"
+  "CMakeFiles/algorithm_as_sender_test.dir/algorithm_as_sender.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/algorithm_as_sender_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
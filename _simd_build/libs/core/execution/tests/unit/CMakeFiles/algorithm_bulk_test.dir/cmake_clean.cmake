@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/algorithm_bulk_test"
+  "../../../../../bin/algorithm_bulk_test.pdb"
+  "CMakeFiles/algorithm_bulk_test.dir/algorithm_bulk.cpp.o"
+  "CMakeFiles/algorithm_bulk_test.dir/algorithm_bulk.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/algorithm_bulk_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/algorithm_ensure_started_test"
+  "../../../../../bin/algorithm_ensure_started_test.pdb"
+  "CMakeFiles/algorithm_ensure_started_test.dir/algorithm_ensure_started.cpp.o"
+  "CMakeFiles/algorithm_ensure_started_test.dir/algorithm_ensure_started.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/algorithm_ensure_started_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/algorithm_execute_test"
+  "../../../../../bin/algorithm_execute_test.pdb"
+  "CMakeFiles/algorithm_execute_test.dir/algorithm_execute.cpp.o"
+  "CMakeFiles/algorithm_execute_test.dir/algorithm_execute.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/algorithm_execute_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
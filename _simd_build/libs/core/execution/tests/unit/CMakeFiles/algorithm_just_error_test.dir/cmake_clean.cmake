@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/algorithm_just_error_test"
+  "../../../../../bin/algorithm_just_error_test.pdb"
+  "CMakeFiles/algorithm_just_error_test.dir/algorithm_just_error.cpp.o"
+  "CMakeFiles/algorithm_just_error_test.dir/algorithm_just_error.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/algorithm_just_error_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
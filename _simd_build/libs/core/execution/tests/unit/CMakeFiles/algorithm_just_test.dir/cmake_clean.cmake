@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/algorithm_just_test"
+  "../../../../../bin/algorithm_just_test.pdb"
+  "CMakeFiles/algorithm_just_test.dir/algorithm_just.cpp.o"
+  "CMakeFiles/algorithm_just_test.dir/algorithm_just.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/algorithm_just_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
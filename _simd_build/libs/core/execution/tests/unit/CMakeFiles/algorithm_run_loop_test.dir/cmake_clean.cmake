@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/algorithm_run_loop_test"
+  "../../../../../bin/algorithm_run_loop_test.pdb"
+  "CMakeFiles/algorithm_run_loop_test.dir/algorithm_run_loop.cpp.o"
+  "CMakeFiles/algorithm_run_loop_test.dir/algorithm_run_loop.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/algorithm_run_loop_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/algorithm_split_test"
+  "../../../../../bin/algorithm_split_test.pdb"
+  "CMakeFiles/algorithm_split_test.dir/algorithm_split.cpp.o"
+  "CMakeFiles/algorithm_split_test.dir/algorithm_split.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/algorithm_split_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
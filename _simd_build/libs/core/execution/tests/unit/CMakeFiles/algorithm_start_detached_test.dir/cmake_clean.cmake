@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/algorithm_start_detached_test"
+  "../../../../../bin/algorithm_start_detached_test.pdb"
+  "CMakeFiles/algorithm_start_detached_test.dir/algorithm_start_detached.cpp.o"
+  "CMakeFiles/algorithm_start_detached_test.dir/algorithm_start_detached.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/algorithm_start_detached_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/algorithm_sync_wait_test"
+  "../../../../../bin/algorithm_sync_wait_test.pdb"
+  "CMakeFiles/algorithm_sync_wait_test.dir/algorithm_sync_wait.cpp.o"
+  "CMakeFiles/algorithm_sync_wait_test.dir/algorithm_sync_wait.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/algorithm_sync_wait_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
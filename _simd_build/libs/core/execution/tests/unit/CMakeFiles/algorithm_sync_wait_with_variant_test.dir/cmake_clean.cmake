@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/algorithm_sync_wait_with_variant_test"
+  "../../../../../bin/algorithm_sync_wait_with_variant_test.pdb"
+  "CMakeFiles/algorithm_sync_wait_with_variant_test.dir/algorithm_sync_wait_with_variant.cpp.o"
+  "CMakeFiles/algorithm_sync_wait_with_variant_test.dir/algorithm_sync_wait_with_variant.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/algorithm_sync_wait_with_variant_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
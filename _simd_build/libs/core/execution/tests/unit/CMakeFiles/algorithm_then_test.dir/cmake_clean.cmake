@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/algorithm_then_test"
+  "../../../../../bin/algorithm_then_test.pdb"
+  "CMakeFiles/algorithm_then_test.dir/algorithm_then.cpp.o"
+  "CMakeFiles/algorithm_then_test.dir/algorithm_then.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/algorithm_then_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
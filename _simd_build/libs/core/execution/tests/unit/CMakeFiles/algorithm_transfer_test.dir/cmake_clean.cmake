@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/algorithm_transfer_test"
+  "../../../../../bin/algorithm_transfer_test.pdb"
+  "CMakeFiles/algorithm_transfer_test.dir/algorithm_transfer.cpp.o"
+  "CMakeFiles/algorithm_transfer_test.dir/algorithm_transfer.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/algorithm_transfer_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/algorithm_transfer_when_all_test"
+  "../../../../../bin/algorithm_transfer_when_all_test.pdb"
+  "CMakeFiles/algorithm_transfer_when_all_test.dir/algorithm_transfer_when_all.cpp.o"
+  "CMakeFiles/algorithm_transfer_when_all_test.dir/algorithm_transfer_when_all.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/algorithm_transfer_when_all_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
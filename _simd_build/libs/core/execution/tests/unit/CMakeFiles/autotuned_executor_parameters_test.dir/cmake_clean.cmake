@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/autotuned_executor_parameters_test"
+  "../../../../../bin/autotuned_executor_parameters_test.pdb"
+  "CMakeFiles/autotuned_executor_parameters_test.dir/autotuned_executor_parameters.cpp.o"
+  "CMakeFiles/autotuned_executor_parameters_test.dir/autotuned_executor_parameters.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/autotuned_executor_parameters_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/bulk_async_test"
+  "../../../../../bin/bulk_async_test.pdb"
+  "CMakeFiles/bulk_async_test.dir/bulk_async.cpp.o"
+  "CMakeFiles/bulk_async_test.dir/bulk_async.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bulk_async_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
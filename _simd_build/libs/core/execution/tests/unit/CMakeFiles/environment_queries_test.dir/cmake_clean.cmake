@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/environment_queries_test"
+  "../../../../../bin/environment_queries_test.pdb"
+  "CMakeFiles/environment_queries_test.dir/environment_queries.cpp.o"
+  "CMakeFiles/environment_queries_test.dir/environment_queries.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/environment_queries_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/executor_parameters_dispatching_test"
+  "../../../../../bin/executor_parameters_dispatching_test.pdb"
+  "CMakeFiles/executor_parameters_dispatching_test.dir/executor_parameters_dispatching.cpp.o"
+  "CMakeFiles/executor_parameters_dispatching_test.dir/executor_parameters_dispatching.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/executor_parameters_dispatching_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/executor_parameters_test"
+  "../../../../../bin/executor_parameters_test.pdb"
+  "CMakeFiles/executor_parameters_test.dir/executor_parameters.cpp.o"
+  "CMakeFiles/executor_parameters_test.dir/executor_parameters.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/executor_parameters_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
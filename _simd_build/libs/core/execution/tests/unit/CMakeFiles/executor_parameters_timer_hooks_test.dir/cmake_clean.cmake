@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/executor_parameters_timer_hooks_test"
+  "../../../../../bin/executor_parameters_timer_hooks_test.pdb"
+  "CMakeFiles/executor_parameters_timer_hooks_test.dir/executor_parameters_timer_hooks.cpp.o"
+  "CMakeFiles/executor_parameters_timer_hooks_test.dir/executor_parameters_timer_hooks.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/executor_parameters_timer_hooks_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/forward_progress_guarantee_test"
+  "../../../../../bin/forward_progress_guarantee_test.pdb"
+  "CMakeFiles/forward_progress_guarantee_test.dir/forward_progress_guarantee.cpp.o"
+  "CMakeFiles/forward_progress_guarantee_test.dir/forward_progress_guarantee.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/forward_progress_guarantee_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/forwarding_env_query_test"
+  "../../../../../bin/forwarding_env_query_test.pdb"
+  "CMakeFiles/forwarding_env_query_test.dir/forwarding_env_query.cpp.o"
+  "CMakeFiles/forwarding_env_query_test.dir/forwarding_env_query.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/forwarding_env_query_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
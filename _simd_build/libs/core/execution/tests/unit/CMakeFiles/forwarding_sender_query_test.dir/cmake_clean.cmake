@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/forwarding_sender_query_test"
+  "../../../../../bin/forwarding_sender_query_test.pdb"
+  "CMakeFiles/forwarding_sender_query_test.dir/forwarding_sender_query.cpp.o"
+  "CMakeFiles/forwarding_sender_query_test.dir/forwarding_sender_query.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/forwarding_sender_query_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
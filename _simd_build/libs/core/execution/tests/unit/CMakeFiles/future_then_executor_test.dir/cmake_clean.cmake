@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/future_then_executor_test"
+  "../../../../../bin/future_then_executor_test.pdb"
+  "CMakeFiles/future_then_executor_test.dir/future_then_executor.cpp.o"
+  "CMakeFiles/future_then_executor_test.dir/future_then_executor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/future_then_executor_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/minimal_async_executor_test"
+  "../../../../../bin/minimal_async_executor_test.pdb"
+  "CMakeFiles/minimal_async_executor_test.dir/minimal_async_executor.cpp.o"
+  "CMakeFiles/minimal_async_executor_test.dir/minimal_async_executor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/minimal_async_executor_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
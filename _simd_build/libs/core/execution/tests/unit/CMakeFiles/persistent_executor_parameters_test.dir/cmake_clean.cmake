@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/persistent_executor_parameters_test"
+  "../../../../../bin/persistent_executor_parameters_test.pdb"
+  "CMakeFiles/persistent_executor_parameters_test.dir/persistent_executor_parameters.cpp.o"
+  "CMakeFiles/persistent_executor_parameters_test.dir/persistent_executor_parameters.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/persistent_executor_parameters_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,5 @@
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/tests.unit.modules.execution.algorithm_sync_wait.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,74 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/execution/tests/unit
+# Build directory: /root/repo/_simd_build/libs/core/execution/tests/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tests.unit.modules.execution.algorithm_as_sender "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/algorithm_as_sender_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.algorithm_as_sender PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.algorithm_bulk "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/algorithm_bulk_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.algorithm_bulk PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.algorithm_ensure_started "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/algorithm_ensure_started_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.algorithm_ensure_started PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.algorithm_execute "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/algorithm_execute_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.algorithm_execute PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.algorithm_just "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/algorithm_just_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.algorithm_just PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.algorithm_just_error "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/algorithm_just_error_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.algorithm_just_error PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.algorithm_just_stopped "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/algorithm_just_stopped_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.algorithm_just_stopped PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.algorithm_let_error "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/algorithm_let_error_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.algorithm_let_error PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.algorithm_let_stopped "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/algorithm_let_stopped_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.algorithm_let_stopped PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.algorithm_let_value "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/algorithm_let_value_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.algorithm_let_value PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.algorithm_run_loop "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/algorithm_run_loop_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.algorithm_run_loop PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.algorithm_split "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/algorithm_split_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.algorithm_split PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.algorithm_start_detached "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/algorithm_start_detached_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.algorithm_start_detached PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.algorithm_sync_wait "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/algorithm_sync_wait_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.algorithm_sync_wait PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.algorithm_sync_wait_with_variant "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/algorithm_sync_wait_with_variant_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.algorithm_sync_wait_with_variant PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.algorithm_then "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/algorithm_then_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.algorithm_then PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.algorithm_transfer "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/algorithm_transfer_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.algorithm_transfer PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.algorithm_transfer_just "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/algorithm_transfer_just_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.algorithm_transfer_just PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.algorithm_transfer_when_all "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/algorithm_transfer_when_all_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.algorithm_transfer_when_all PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.algorithm_when_all "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/algorithm_when_all_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.algorithm_when_all PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.autotuned_executor_parameters "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/autotuned_executor_parameters_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.autotuned_executor_parameters PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.bulk_async "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/bulk_async_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.bulk_async PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.environment_queries "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/environment_queries_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.environment_queries PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.executor_parameters "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/executor_parameters_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.executor_parameters PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.executor_parameters_dispatching "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/executor_parameters_dispatching_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.executor_parameters_dispatching PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.executor_parameters_timer_hooks "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/executor_parameters_timer_hooks_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.executor_parameters_timer_hooks PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.forwarding_env_query "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/forwarding_env_query_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.forwarding_env_query PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.forwarding_scheduler_query "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/forwarding_scheduler_query_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.forwarding_scheduler_query PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.forwarding_sender_query "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/forwarding_sender_query_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.forwarding_sender_query PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.future_then_executor "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/future_then_executor_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.future_then_executor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.minimal_async_executor "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/minimal_async_executor_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.minimal_async_executor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.minimal_sync_executor "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/minimal_sync_executor_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.minimal_sync_executor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.persistent_executor_parameters "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/persistent_executor_parameters_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.persistent_executor_parameters PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution.forward_progress_guarantee "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/forward_progress_guarantee_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.execution.forward_progress_guarantee PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;66;add_hpx_unit_test;/root/repo/libs/core/execution/tests/unit/CMakeLists.txt;0;")
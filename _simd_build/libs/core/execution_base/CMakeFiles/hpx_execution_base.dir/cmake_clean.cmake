@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_execution_base.a"
+  "../../../lib/libhpx_execution_base.pdb"
+  "CMakeFiles/hpx_execution_base.dir/src/agent_ref.cpp.o"
+  "CMakeFiles/hpx_execution_base.dir/src/agent_ref.cpp.o.d"
+  "CMakeFiles/hpx_execution_base.dir/src/any_sender.cpp.o"
+  "CMakeFiles/hpx_execution_base.dir/src/any_sender.cpp.o.d"
+  "CMakeFiles/hpx_execution_base.dir/src/spinlock_deadlock_detection.cpp.o"
+  "CMakeFiles/hpx_execution_base.dir/src/spinlock_deadlock_detection.cpp.o.d"
+  "CMakeFiles/hpx_execution_base.dir/src/this_thread.cpp.o"
+  "CMakeFiles/hpx_execution_base.dir/src/this_thread.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_execution_base.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,32 @@
+//  Copyright (c) 2019-2022 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Do not edit this file! It has been generated by the cmake configuration step.
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_MODULE_EXECUTION_BASE)
+#include <hpx/execution_base/agent_base.hpp>
+#include <hpx/execution_base/agent_ref.hpp>
+#include <hpx/execution_base/any_sender.hpp>
+#include <hpx/execution_base/completion_scheduler.hpp>
+#include <hpx/execution_base/completion_signatures.hpp>
+#include <hpx/execution_base/context_base.hpp>
+#include <hpx/execution_base/coroutine_utils.hpp>
+#include <hpx/execution_base/execution.hpp>
+#include <hpx/execution_base/get_env.hpp>
+#include <hpx/execution_base/operation_state.hpp>
+#include <hpx/execution_base/receiver.hpp>
+#include <hpx/execution_base/resource_base.hpp>
+#include <hpx/execution_base/sender.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/execution_base/traits/is_executor.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
+#include <hpx/execution_base/traits/coroutine_traits.hpp>
+#endif
+
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/any_sender_test"
+  "../../../../../bin/any_sender_test.pdb"
+  "CMakeFiles/any_sender_test.dir/any_sender.cpp.o"
+  "CMakeFiles/any_sender_test.dir/any_sender.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/any_sender_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/basic_operation_state_test"
+  "../../../../../bin/basic_operation_state_test.pdb"
+  "CMakeFiles/basic_operation_state_test.dir/basic_operation_state.cpp.o"
+  "CMakeFiles/basic_operation_state_test.dir/basic_operation_state.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/basic_operation_state_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/basic_receiver_test"
+  "../../../../../bin/basic_receiver_test.pdb"
+  "CMakeFiles/basic_receiver_test.dir/basic_receiver.cpp.o"
+  "CMakeFiles/basic_receiver_test.dir/basic_receiver.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/basic_receiver_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/basic_schedule_test"
+  "../../../../../bin/basic_schedule_test.pdb"
+  "CMakeFiles/basic_schedule_test.dir/basic_schedule.cpp.o"
+  "CMakeFiles/basic_schedule_test.dir/basic_schedule.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/basic_schedule_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
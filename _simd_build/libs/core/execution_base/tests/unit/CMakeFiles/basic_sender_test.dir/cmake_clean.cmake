@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/basic_sender_test"
+  "../../../../../bin/basic_sender_test.pdb"
+  "CMakeFiles/basic_sender_test.dir/basic_sender.cpp.o"
+  "CMakeFiles/basic_sender_test.dir/basic_sender.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/basic_sender_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/completion_signatures_test"
+  "../../../../../bin/completion_signatures_test.pdb"
+  "CMakeFiles/completion_signatures_test.dir/completion_signatures.cpp.o"
+  "CMakeFiles/completion_signatures_test.dir/completion_signatures.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/completion_signatures_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
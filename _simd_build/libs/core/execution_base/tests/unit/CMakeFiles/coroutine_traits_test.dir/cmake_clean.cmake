@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/coroutine_traits_test"
+  "../../../../../bin/coroutine_traits_test.pdb"
+  "CMakeFiles/coroutine_traits_test.dir/coroutine_traits.cpp.o"
+  "CMakeFiles/coroutine_traits_test.dir/coroutine_traits.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/coroutine_traits_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/coroutine_utils_test"
+  "../../../../../bin/coroutine_utils_test.pdb"
+  "CMakeFiles/coroutine_utils_test.dir/coroutine_utils.cpp.o"
+  "CMakeFiles/coroutine_utils_test.dir/coroutine_utils.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/coroutine_utils_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
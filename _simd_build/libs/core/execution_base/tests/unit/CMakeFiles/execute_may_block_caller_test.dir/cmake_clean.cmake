@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/execute_may_block_caller_test"
+  "../../../../../bin/execute_may_block_caller_test.pdb"
+  "CMakeFiles/execute_may_block_caller_test.dir/execute_may_block_caller.cpp.o"
+  "CMakeFiles/execute_may_block_caller_test.dir/execute_may_block_caller.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/execute_may_block_caller_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
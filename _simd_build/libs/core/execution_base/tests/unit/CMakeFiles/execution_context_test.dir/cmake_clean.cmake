@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/execution_context_test"
+  "../../../../../bin/execution_context_test.pdb"
+  "CMakeFiles/execution_context_test.dir/execution_context.cpp.o"
+  "CMakeFiles/execution_context_test.dir/execution_context.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/execution_context_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
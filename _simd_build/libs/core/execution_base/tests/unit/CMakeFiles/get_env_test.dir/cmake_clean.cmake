@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/get_env_test"
+  "../../../../../bin/get_env_test.pdb"
+  "CMakeFiles/get_env_test.dir/get_env.cpp.o"
+  "CMakeFiles/get_env_test.dir/get_env.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/get_env_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,5 @@
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/tests.unit.modules.execution_base.get_env.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
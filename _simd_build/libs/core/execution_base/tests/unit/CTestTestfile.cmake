@@ -0,0 +1,28 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/execution_base/tests/unit
+# Build directory: /root/repo/_simd_build/libs/core/execution_base/tests/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tests.unit.modules.execution_base.any_sender "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/any_sender_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.execution_base.any_sender PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution_base/tests/unit/CMakeLists.txt;41;add_hpx_unit_test;/root/repo/libs/core/execution_base/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution_base.basic_operation_state "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/basic_operation_state_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.execution_base.basic_operation_state PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution_base/tests/unit/CMakeLists.txt;41;add_hpx_unit_test;/root/repo/libs/core/execution_base/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution_base.basic_receiver "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/basic_receiver_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.execution_base.basic_receiver PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution_base/tests/unit/CMakeLists.txt;41;add_hpx_unit_test;/root/repo/libs/core/execution_base/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution_base.basic_sender "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/basic_sender_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.execution_base.basic_sender PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution_base/tests/unit/CMakeLists.txt;41;add_hpx_unit_test;/root/repo/libs/core/execution_base/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution_base.basic_schedule "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/basic_schedule_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.execution_base.basic_schedule PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution_base/tests/unit/CMakeLists.txt;41;add_hpx_unit_test;/root/repo/libs/core/execution_base/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution_base.completion_signatures "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/completion_signatures_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.execution_base.completion_signatures PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution_base/tests/unit/CMakeLists.txt;41;add_hpx_unit_test;/root/repo/libs/core/execution_base/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution_base.execution_context "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/execution_context_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.execution_base.execution_context PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution_base/tests/unit/CMakeLists.txt;41;add_hpx_unit_test;/root/repo/libs/core/execution_base/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution_base.get_env "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/get_env_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.execution_base.get_env PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution_base/tests/unit/CMakeLists.txt;41;add_hpx_unit_test;/root/repo/libs/core/execution_base/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution_base.execute_may_block_caller "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/execute_may_block_caller_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.execution_base.execute_may_block_caller PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution_base/tests/unit/CMakeLists.txt;41;add_hpx_unit_test;/root/repo/libs/core/execution_base/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution_base.coroutine_traits "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/coroutine_traits_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.execution_base.coroutine_traits PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution_base/tests/unit/CMakeLists.txt;41;add_hpx_unit_test;/root/repo/libs/core/execution_base/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.execution_base.coroutine_utils "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/coroutine_utils_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.execution_base.coroutine_utils PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/execution_base/tests/unit/CMakeLists.txt;41;add_hpx_unit_test;/root/repo/libs/core/execution_base/tests/unit/CMakeLists.txt;0;")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_executors.a"
+  "../../../lib/libhpx_executors.pdb"
+  "CMakeFiles/hpx_executors.dir/src/current_executor.cpp.o"
+  "CMakeFiles/hpx_executors.dir/src/current_executor.cpp.o.d"
+  "CMakeFiles/hpx_executors.dir/src/exception_list_callbacks.cpp.o"
+  "CMakeFiles/hpx_executors.dir/src/exception_list_callbacks.cpp.o.d"
+  "CMakeFiles/hpx_executors.dir/src/fork_join_executor.cpp.o"
+  "CMakeFiles/hpx_executors.dir/src/fork_join_executor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_executors.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,44 @@
+//  Copyright (c) 2019-2022 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Do not edit this file! It has been generated by the cmake configuration step.
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_MODULE_EXECUTORS)
+#include <hpx/executors/annotating_executor.hpp>
+#include <hpx/executors/current_executor.hpp>
+#include <hpx/executors/guided_pool_executor.hpp>
+#include <hpx/executors/apply.hpp>
+#include <hpx/executors/async.hpp>
+#include <hpx/executors/dataflow.hpp>
+#include <hpx/executors/exception_list.hpp>
+#include <hpx/executors/execution_policy_annotation.hpp>
+#include <hpx/executors/execution_policy_fwd.hpp>
+#include <hpx/executors/execution_policy_mappings.hpp>
+#include <hpx/executors/execution_policy_parameters.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/executors/explicit_scheduler_executor.hpp>
+#include <hpx/executors/fork_join_executor.hpp>
+#include <hpx/executors/limiting_executor.hpp>
+#include <hpx/executors/parallel_executor_aggregated.hpp>
+#include <hpx/executors/parallel_executor.hpp>
+#include <hpx/executors/restricted_thread_pool_executor.hpp>
+#include <hpx/executors/scheduler_executor.hpp>
+#include <hpx/executors/sequenced_executor.hpp>
+#include <hpx/executors/service_executors.hpp>
+#include <hpx/executors/std_execution_policy.hpp>
+#include <hpx/executors/sync.hpp>
+#include <hpx/executors/thread_pool_executor.hpp>
+#include <hpx/executors/thread_pool_scheduler.hpp>
+#include <hpx/executors/thread_pool_scheduler_bulk.hpp>
+#include <hpx/executors/datapar/execution_policy_fwd.hpp>
+#include <hpx/executors/datapar/execution_policy_mappings.hpp>
+#include <hpx/executors/datapar/execution_policy.hpp>
+#endif
+
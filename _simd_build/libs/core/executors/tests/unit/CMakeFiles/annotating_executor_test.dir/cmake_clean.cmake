@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/annotating_executor_test"
+  "../../../../../bin/annotating_executor_test.pdb"
+  "CMakeFiles/annotating_executor_test.dir/annotating_executor.cpp.o"
+  "CMakeFiles/annotating_executor_test.dir/annotating_executor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/annotating_executor_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
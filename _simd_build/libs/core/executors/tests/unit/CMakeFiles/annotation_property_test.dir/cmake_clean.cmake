@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/annotation_property_test"
+  "../../../../../bin/annotation_property_test.pdb"
+  "CMakeFiles/annotation_property_test.dir/annotation_property.cpp.o"
+  "CMakeFiles/annotation_property_test.dir/annotation_property.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/annotation_property_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
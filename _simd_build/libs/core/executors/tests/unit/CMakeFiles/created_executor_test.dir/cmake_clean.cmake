@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/created_executor_test"
+  "../../../../../bin/created_executor_test.pdb"
+  "CMakeFiles/created_executor_test.dir/created_executor.cpp.o"
+  "CMakeFiles/created_executor_test.dir/created_executor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/created_executor_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/execution_policy_mappings_test"
+  "../../../../../bin/execution_policy_mappings_test.pdb"
+  "CMakeFiles/execution_policy_mappings_test.dir/execution_policy_mappings.cpp.o"
+  "CMakeFiles/execution_policy_mappings_test.dir/execution_policy_mappings.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/execution_policy_mappings_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/explicit_scheduler_executor_test"
+  "../../../../../bin/explicit_scheduler_executor_test.pdb"
+  "CMakeFiles/explicit_scheduler_executor_test.dir/explicit_scheduler_executor.cpp.o"
+  "CMakeFiles/explicit_scheduler_executor_test.dir/explicit_scheduler_executor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/explicit_scheduler_executor_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
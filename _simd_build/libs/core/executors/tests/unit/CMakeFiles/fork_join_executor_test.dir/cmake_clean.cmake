@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/fork_join_executor_test"
+  "../../../../../bin/fork_join_executor_test.pdb"
+  "CMakeFiles/fork_join_executor_test.dir/fork_join_executor.cpp.o"
+  "CMakeFiles/fork_join_executor_test.dir/fork_join_executor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fork_join_executor_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/limiting_executor_test"
+  "../../../../../bin/limiting_executor_test.pdb"
+  "CMakeFiles/limiting_executor_test.dir/limiting_executor.cpp.o"
+  "CMakeFiles/limiting_executor_test.dir/limiting_executor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/limiting_executor_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
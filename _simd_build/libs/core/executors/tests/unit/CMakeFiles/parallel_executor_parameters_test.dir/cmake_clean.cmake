@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/parallel_executor_parameters_test"
+  "../../../../../bin/parallel_executor_parameters_test.pdb"
+  "CMakeFiles/parallel_executor_parameters_test.dir/parallel_executor_parameters.cpp.o"
+  "CMakeFiles/parallel_executor_parameters_test.dir/parallel_executor_parameters.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/parallel_executor_parameters_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
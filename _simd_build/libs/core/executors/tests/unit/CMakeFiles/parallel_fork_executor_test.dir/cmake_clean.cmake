@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/parallel_fork_executor_test"
+  "../../../../../bin/parallel_fork_executor_test.pdb"
+  "CMakeFiles/parallel_fork_executor_test.dir/parallel_fork_executor.cpp.o"
+  "CMakeFiles/parallel_fork_executor_test.dir/parallel_fork_executor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/parallel_fork_executor_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
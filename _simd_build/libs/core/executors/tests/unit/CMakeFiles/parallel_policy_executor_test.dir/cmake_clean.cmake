@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/parallel_policy_executor_test"
+  "../../../../../bin/parallel_policy_executor_test.pdb"
+  "CMakeFiles/parallel_policy_executor_test.dir/parallel_policy_executor.cpp.o"
+  "CMakeFiles/parallel_policy_executor_test.dir/parallel_policy_executor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/parallel_policy_executor_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
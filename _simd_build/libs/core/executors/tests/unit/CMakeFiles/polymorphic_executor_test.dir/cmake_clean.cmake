@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/polymorphic_executor_test"
+  "../../../../../bin/polymorphic_executor_test.pdb"
+  "CMakeFiles/polymorphic_executor_test.dir/polymorphic_executor.cpp.o"
+  "CMakeFiles/polymorphic_executor_test.dir/polymorphic_executor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/polymorphic_executor_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
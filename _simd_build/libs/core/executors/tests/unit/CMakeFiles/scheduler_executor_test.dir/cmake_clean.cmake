@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/scheduler_executor_test"
+  "../../../../../bin/scheduler_executor_test.pdb"
+  "CMakeFiles/scheduler_executor_test.dir/scheduler_executor.cpp.o"
+  "CMakeFiles/scheduler_executor_test.dir/scheduler_executor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scheduler_executor_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/sequenced_executor_test"
+  "../../../../../bin/sequenced_executor_test.pdb"
+  "CMakeFiles/sequenced_executor_test.dir/sequenced_executor.cpp.o"
+  "CMakeFiles/sequenced_executor_test.dir/sequenced_executor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sequenced_executor_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/service_executors_test"
+  "../../../../../bin/service_executors_test.pdb"
+  "CMakeFiles/service_executors_test.dir/service_executors.cpp.o"
+  "CMakeFiles/service_executors_test.dir/service_executors.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/service_executors_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/shared_parallel_executor_test"
+  "../../../../../bin/shared_parallel_executor_test.pdb"
+  "CMakeFiles/shared_parallel_executor_test.dir/shared_parallel_executor.cpp.o"
+  "CMakeFiles/shared_parallel_executor_test.dir/shared_parallel_executor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shared_parallel_executor_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/standalone_thread_pool_executor_test"
+  "../../../../../bin/standalone_thread_pool_executor_test.pdb"
+  "CMakeFiles/standalone_thread_pool_executor_test.dir/standalone_thread_pool_executor.cpp.o"
+  "CMakeFiles/standalone_thread_pool_executor_test.dir/standalone_thread_pool_executor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/standalone_thread_pool_executor_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,5 @@
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/tests.unit.modules.executors.shared_parallel_executor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
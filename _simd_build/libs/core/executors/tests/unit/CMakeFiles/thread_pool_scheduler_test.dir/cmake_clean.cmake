@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/thread_pool_scheduler_test"
+  "../../../../../bin/thread_pool_scheduler_test.pdb"
+  "CMakeFiles/thread_pool_scheduler_test.dir/thread_pool_scheduler.cpp.o"
+  "CMakeFiles/thread_pool_scheduler_test.dir/thread_pool_scheduler.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/thread_pool_scheduler_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
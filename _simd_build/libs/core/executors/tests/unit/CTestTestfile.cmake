@@ -0,0 +1,42 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/executors/tests/unit
+# Build directory: /root/repo/_simd_build/libs/core/executors/tests/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tests.unit.modules.executors.annotating_executor "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/annotating_executor_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.executors.annotating_executor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;50;add_hpx_unit_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.executors.annotation_property "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/annotation_property_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.executors.annotation_property PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;50;add_hpx_unit_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.executors.created_executor "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/created_executor_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.executors.created_executor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;50;add_hpx_unit_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.executors.execution_policy_mappings "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/execution_policy_mappings_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.executors.execution_policy_mappings PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;50;add_hpx_unit_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.executors.explicit_scheduler_executor "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/explicit_scheduler_executor_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.executors.explicit_scheduler_executor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;50;add_hpx_unit_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.executors.fork_join_executor "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/fork_join_executor_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.executors.fork_join_executor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;50;add_hpx_unit_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.executors.limiting_executor "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/limiting_executor_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.executors.limiting_executor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;50;add_hpx_unit_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.executors.parallel_executor "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/parallel_executor_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.executors.parallel_executor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;50;add_hpx_unit_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.executors.parallel_executor_parameters "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/parallel_executor_parameters_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.executors.parallel_executor_parameters PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;50;add_hpx_unit_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.executors.parallel_fork_executor "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/parallel_fork_executor_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.executors.parallel_fork_executor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;50;add_hpx_unit_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.executors.parallel_policy_executor "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/parallel_policy_executor_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.executors.parallel_policy_executor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;50;add_hpx_unit_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.executors.polymorphic_executor "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/polymorphic_executor_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.executors.polymorphic_executor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;50;add_hpx_unit_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.executors.scheduler_executor "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/scheduler_executor_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.executors.scheduler_executor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;50;add_hpx_unit_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.executors.sequenced_executor "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/sequenced_executor_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.executors.sequenced_executor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;50;add_hpx_unit_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.executors.service_executors "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/service_executors_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.executors.service_executors PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;50;add_hpx_unit_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.executors.shared_parallel_executor "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/shared_parallel_executor_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.executors.shared_parallel_executor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;50;add_hpx_unit_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.executors.standalone_thread_pool_executor "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/standalone_thread_pool_executor_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.executors.standalone_thread_pool_executor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;50;add_hpx_unit_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.executors.thread_pool_scheduler "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/thread_pool_scheduler_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.executors.thread_pool_scheduler PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;50;add_hpx_unit_test;/root/repo/libs/core/executors/tests/unit/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_filesystem.a"
+  "../../../lib/libhpx_filesystem.pdb"
+  "CMakeFiles/hpx_filesystem.dir/__/__/src/empty.cpp.o"
+  "CMakeFiles/hpx_filesystem.dir/__/__/src/empty.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_filesystem.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
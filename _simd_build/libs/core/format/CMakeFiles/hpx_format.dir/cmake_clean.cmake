@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_format.a"
+  "../../../lib/libhpx_format.pdb"
+  "CMakeFiles/hpx_format.dir/src/format.cpp.o"
+  "CMakeFiles/hpx_format.dir/src/format.cpp.o.d"
+  "CMakeFiles/hpx_format.dir/src/util/bad_lexical_cast.cpp.o"
+  "CMakeFiles/hpx_format.dir/src/util/bad_lexical_cast.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_format.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
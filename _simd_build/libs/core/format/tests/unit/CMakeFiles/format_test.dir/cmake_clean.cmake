@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/format_test"
+  "../../../../../bin/format_test.pdb"
+  "CMakeFiles/format_test.dir/format.cpp.o"
+  "CMakeFiles/format_test.dir/format.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/format_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_functional.a"
+  "../../../lib/libhpx_functional.pdb"
+  "CMakeFiles/hpx_functional.dir/src/basic_function.cpp.o"
+  "CMakeFiles/hpx_functional.dir/src/basic_function.cpp.o.d"
+  "CMakeFiles/hpx_functional.dir/src/empty_function.cpp.o"
+  "CMakeFiles/hpx_functional.dir/src/empty_function.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_functional.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
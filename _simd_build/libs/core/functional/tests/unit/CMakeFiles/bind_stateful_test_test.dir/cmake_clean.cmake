@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/bind_stateful_test_test"
+  "../../../../../bin/bind_stateful_test_test.pdb"
+  "CMakeFiles/bind_stateful_test_test.dir/bind_stateful_test.cpp.o"
+  "CMakeFiles/bind_stateful_test_test.dir/bind_stateful_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bind_stateful_test_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/contains_test_test"
+  "../../../../../bin/contains_test_test.pdb"
+  "CMakeFiles/contains_test_test.dir/contains_test.cpp.o"
+  "CMakeFiles/contains_test_test.dir/contains_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/contains_test_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
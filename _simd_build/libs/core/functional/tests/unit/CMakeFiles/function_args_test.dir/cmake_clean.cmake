@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/function_args_test"
+  "../../../../../bin/function_args_test.pdb"
+  "CMakeFiles/function_args_test.dir/function_args.cpp.o"
+  "CMakeFiles/function_args_test.dir/function_args.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/function_args_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/function_arith_test"
+  "../../../../../bin/function_arith_test.pdb"
+  "CMakeFiles/function_arith_test.dir/function_arith.cpp.o"
+  "CMakeFiles/function_arith_test.dir/function_arith.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/function_arith_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/function_bind_test_test"
+  "../../../../../bin/function_bind_test_test.pdb"
+  "CMakeFiles/function_bind_test_test.dir/function_bind_test.cpp.o"
+  "CMakeFiles/function_bind_test_test.dir/function_bind_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/function_bind_test_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
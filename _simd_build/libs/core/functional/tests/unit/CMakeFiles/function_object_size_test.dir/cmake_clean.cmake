@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/function_object_size_test"
+  "../../../../../bin/function_object_size_test.pdb"
+  "CMakeFiles/function_object_size_test.dir/function_object_size.cpp.o"
+  "CMakeFiles/function_object_size_test.dir/function_object_size.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/function_object_size_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/function_ref_wrapper_test"
+  "../../../../../bin/function_ref_wrapper_test.pdb"
+  "CMakeFiles/function_ref_wrapper_test.dir/function_ref_wrapper.cpp.o"
+  "CMakeFiles/function_ref_wrapper_test.dir/function_ref_wrapper.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/function_ref_wrapper_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
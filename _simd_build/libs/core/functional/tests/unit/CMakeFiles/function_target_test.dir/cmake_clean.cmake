@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/function_target_test"
+  "../../../../../bin/function_target_test.pdb"
+  "CMakeFiles/function_target_test.dir/function_target.cpp.o"
+  "CMakeFiles/function_target_test.dir/function_target.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/function_target_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/function_test_test"
+  "../../../../../bin/function_test_test.pdb"
+  "CMakeFiles/function_test_test.dir/function_test.cpp.o"
+  "CMakeFiles/function_test_test.dir/function_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/function_test_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/is_invocable_test"
+  "../../../../../bin/is_invocable_test.pdb"
+  "CMakeFiles/is_invocable_test.dir/is_invocable.cpp.o"
+  "CMakeFiles/is_invocable_test.dir/is_invocable.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/is_invocable_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
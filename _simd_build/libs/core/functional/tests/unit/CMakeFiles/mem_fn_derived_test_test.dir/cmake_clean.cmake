@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/mem_fn_derived_test_test"
+  "../../../../../bin/mem_fn_derived_test_test.pdb"
+  "CMakeFiles/mem_fn_derived_test_test.dir/mem_fn_derived_test.cpp.o"
+  "CMakeFiles/mem_fn_derived_test_test.dir/mem_fn_derived_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mem_fn_derived_test_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/nothrow_swap_test"
+  "../../../../../bin/nothrow_swap_test.pdb"
+  "CMakeFiles/nothrow_swap_test.dir/nothrow_swap.cpp.o"
+  "CMakeFiles/nothrow_swap_test.dir/nothrow_swap.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nothrow_swap_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
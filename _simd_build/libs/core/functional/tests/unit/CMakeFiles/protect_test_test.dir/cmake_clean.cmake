@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/protect_test_test"
+  "../../../../../bin/protect_test_test.pdb"
+  "CMakeFiles/protect_test_test.dir/protect_test.cpp.o"
+  "CMakeFiles/protect_test_test.dir/protect_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/protect_test_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/stateless_test_test"
+  "../../../../../bin/stateless_test_test.pdb"
+  "CMakeFiles/stateless_test_test.dir/stateless_test.cpp.o"
+  "CMakeFiles/stateless_test_test.dir/stateless_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stateless_test_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/sum_avg_test"
+  "../../../../../bin/sum_avg_test.pdb"
+  "CMakeFiles/sum_avg_test.dir/sum_avg.cpp.o"
+  "CMakeFiles/sum_avg_test.dir/sum_avg.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sum_avg_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,66 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/functional/tests/unit
+# Build directory: /root/repo/_simd_build/libs/core/functional/tests/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tests.unit.modules.functional.bind_const_test "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/bind_const_test_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.functional.bind_const_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;57;add_hpx_unit_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.functional.bind_cv_test "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/bind_cv_test_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.functional.bind_cv_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;57;add_hpx_unit_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.functional.bind_dm2_test "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/bind_dm2_test_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.functional.bind_dm2_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;57;add_hpx_unit_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.functional.bind_dm3_test "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/bind_dm3_test_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.functional.bind_dm3_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;57;add_hpx_unit_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.functional.bind_dm_test "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/bind_dm_test_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.functional.bind_dm_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;57;add_hpx_unit_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.functional.bind_placeholder_test "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/bind_placeholder_test_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.functional.bind_placeholder_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;57;add_hpx_unit_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.functional.bind_rv_sp_test "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/bind_rv_sp_test_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.functional.bind_rv_sp_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;57;add_hpx_unit_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.functional.bind_rvalue_test "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/bind_rvalue_test_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.functional.bind_rvalue_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;57;add_hpx_unit_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.functional.bind_stateful_test "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/bind_stateful_test_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.functional.bind_stateful_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;57;add_hpx_unit_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.functional.bind_test "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/bind_test_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.functional.bind_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;57;add_hpx_unit_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.functional.contains_test "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/contains_test_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.functional.contains_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;57;add_hpx_unit_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.functional.function_args "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/function_args_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.functional.function_args PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;57;add_hpx_unit_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.functional.function_arith "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/function_arith_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.functional.function_arith PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;57;add_hpx_unit_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.functional.function_bind_test "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/function_bind_test_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.functional.function_bind_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;57;add_hpx_unit_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.functional.function_object_size "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/function_object_size_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.functional.function_object_size PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;57;add_hpx_unit_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.functional.function_ref "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/function_ref_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.functional.function_ref PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;57;add_hpx_unit_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.functional.function_ref_wrapper "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/function_ref_wrapper_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.functional.function_ref_wrapper PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;57;add_hpx_unit_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.functional.function_target "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/function_target_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.functional.function_target PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;57;add_hpx_unit_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.functional.function_test "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/function_test_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.functional.function_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;57;add_hpx_unit_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.functional.is_invocable "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/is_invocable_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.functional.is_invocable PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;57;add_hpx_unit_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.functional.mem_fn_derived_test "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/mem_fn_derived_test_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.functional.mem_fn_derived_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;57;add_hpx_unit_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.functional.mem_fn_dm_test "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/mem_fn_dm_test_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.functional.mem_fn_dm_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;57;add_hpx_unit_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.functional.mem_fn_rv_test "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/mem_fn_rv_test_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.functional.mem_fn_rv_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;57;add_hpx_unit_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.functional.mem_fn_test "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/mem_fn_test_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.functional.mem_fn_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;57;add_hpx_unit_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.functional.mem_fn_unary_addr_test "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/mem_fn_unary_addr_test_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.functional.mem_fn_unary_addr_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;57;add_hpx_unit_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.functional.mem_fn_void_test "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/mem_fn_void_test_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.functional.mem_fn_void_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;57;add_hpx_unit_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.functional.nothrow_swap "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/nothrow_swap_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.functional.nothrow_swap PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;57;add_hpx_unit_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.functional.protect_test "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/protect_test_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.functional.protect_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;57;add_hpx_unit_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.functional.stateless_test "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/stateless_test_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.functional.stateless_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;57;add_hpx_unit_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.functional.sum_avg "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/sum_avg_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.functional.sum_avg PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;57;add_hpx_unit_test;/root/repo/libs/core/functional/tests/unit/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_futures.a"
+  "../../../lib/libhpx_futures.pdb"
+  "CMakeFiles/hpx_futures.dir/src/future_data.cpp.o"
+  "CMakeFiles/hpx_futures.dir/src/future_data.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_futures.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,33 @@
+//  Copyright (c) 2019-2022 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Do not edit this file! It has been generated by the cmake configuration step.
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_MODULE_FUTURES)
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/future_fwd.hpp>
+#include <hpx/futures/futures_factory.hpp>
+#include <hpx/futures/detail/future_transforms.hpp>
+#include <hpx/futures/packaged_continuation.hpp>
+#include <hpx/futures/packaged_task.hpp>
+#include <hpx/futures/promise.hpp>
+#include <hpx/futures/traits/acquire_future.hpp>
+#include <hpx/futures/traits/acquire_shared_state.hpp>
+#include <hpx/futures/traits/future_access.hpp>
+#include <hpx/futures/traits/future_then_result.hpp>
+#include <hpx/futures/traits/future_traits.hpp>
+#include <hpx/futures/traits/get_remote_result.hpp>
+#include <hpx/futures/traits/is_future.hpp>
+#include <hpx/futures/traits/is_future_range.hpp>
+#include <hpx/futures/traits/is_future_tuple.hpp>
+#include <hpx/futures/traits/promise_local_result.hpp>
+#include <hpx/futures/traits/promise_remote_result.hpp>
+#endif
+
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/await_test"
+  "../../../../../bin/await_test.pdb"
+  "CMakeFiles/await_test.dir/await.cpp.o"
+  "CMakeFiles/await_test.dir/await.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/await_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
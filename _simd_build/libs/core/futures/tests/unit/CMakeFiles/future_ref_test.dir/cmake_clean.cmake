@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/future_ref_test"
+  "../../../../../bin/future_ref_test.pdb"
+  "CMakeFiles/future_ref_test.dir/future_ref.cpp.o"
+  "CMakeFiles/future_ref_test.dir/future_ref.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/future_ref_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
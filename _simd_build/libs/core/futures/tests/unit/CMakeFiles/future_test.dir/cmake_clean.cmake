@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/future_test"
+  "../../../../../bin/future_test.pdb"
+  "CMakeFiles/future_test.dir/future.cpp.o"
+  "CMakeFiles/future_test.dir/future.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/future_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/local_promise_allocator_test"
+  "../../../../../bin/local_promise_allocator_test.pdb"
+  "CMakeFiles/local_promise_allocator_test.dir/local_promise_allocator.cpp.o"
+  "CMakeFiles/local_promise_allocator_test.dir/local_promise_allocator.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/local_promise_allocator_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
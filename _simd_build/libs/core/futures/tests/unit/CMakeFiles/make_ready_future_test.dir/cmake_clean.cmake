@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/make_ready_future_test"
+  "../../../../../bin/make_ready_future_test.pdb"
+  "CMakeFiles/make_ready_future_test.dir/make_ready_future.cpp.o"
+  "CMakeFiles/make_ready_future_test.dir/make_ready_future.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/make_ready_future_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
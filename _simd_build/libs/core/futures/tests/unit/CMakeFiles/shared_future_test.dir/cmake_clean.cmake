@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/shared_future_test"
+  "../../../../../bin/shared_future_test.pdb"
+  "CMakeFiles/shared_future_test.dir/shared_future.cpp.o"
+  "CMakeFiles/shared_future_test.dir/shared_future.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shared_future_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
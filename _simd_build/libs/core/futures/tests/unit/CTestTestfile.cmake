@@ -0,0 +1,24 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/futures/tests/unit
+# Build directory: /root/repo/_simd_build/libs/core/futures/tests/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tests.unit.modules.futures.future "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/future_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.futures.future PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/futures/tests/unit/CMakeLists.txt;42;add_hpx_unit_test;/root/repo/libs/core/futures/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.futures.future_ref "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/future_ref_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.futures.future_ref PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/futures/tests/unit/CMakeLists.txt;42;add_hpx_unit_test;/root/repo/libs/core/futures/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.futures.future_then "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/future_then_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.futures.future_then PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/futures/tests/unit/CMakeLists.txt;42;add_hpx_unit_test;/root/repo/libs/core/futures/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.futures.local_promise_allocator "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/local_promise_allocator_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.futures.local_promise_allocator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/futures/tests/unit/CMakeLists.txt;42;add_hpx_unit_test;/root/repo/libs/core/futures/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.futures.local_use_allocator "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/local_use_allocator_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.futures.local_use_allocator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/futures/tests/unit/CMakeLists.txt;42;add_hpx_unit_test;/root/repo/libs/core/futures/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.futures.make_future "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/make_future_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.futures.make_future PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/futures/tests/unit/CMakeLists.txt;42;add_hpx_unit_test;/root/repo/libs/core/futures/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.futures.make_ready_future "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/make_ready_future_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.futures.make_ready_future PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/futures/tests/unit/CMakeLists.txt;42;add_hpx_unit_test;/root/repo/libs/core/futures/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.futures.shared_future "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/shared_future_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.futures.shared_future PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/futures/tests/unit/CMakeLists.txt;42;add_hpx_unit_test;/root/repo/libs/core/futures/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.futures.await "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/await_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.futures.await PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/futures/tests/unit/CMakeLists.txt;42;add_hpx_unit_test;/root/repo/libs/core/futures/tests/unit/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_hardware.a"
+  "../../../lib/libhpx_hardware.pdb"
+  "CMakeFiles/hpx_hardware.dir/__/__/src/empty.cpp.o"
+  "CMakeFiles/hpx_hardware.dir/__/__/src/empty.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_hardware.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
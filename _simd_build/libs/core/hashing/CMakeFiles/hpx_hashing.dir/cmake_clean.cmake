@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_hashing.a"
+  "../../../lib/libhpx_hashing.pdb"
+  "CMakeFiles/hpx_hashing.dir/__/__/src/empty.cpp.o"
+  "CMakeFiles/hpx_hashing.dir/__/__/src/empty.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_hashing.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_ini.a"
+  "../../../lib/libhpx_ini.pdb"
+  "CMakeFiles/hpx_ini.dir/src/ini.cpp.o"
+  "CMakeFiles/hpx_ini.dir/src/ini.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_ini.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
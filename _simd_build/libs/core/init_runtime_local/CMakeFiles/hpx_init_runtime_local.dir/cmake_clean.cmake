@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_init_runtime_local.a"
+  "../../../lib/libhpx_init_runtime_local.pdb"
+  "CMakeFiles/hpx_init_runtime_local.dir/src/init_logging.cpp.o"
+  "CMakeFiles/hpx_init_runtime_local.dir/src/init_logging.cpp.o.d"
+  "CMakeFiles/hpx_init_runtime_local.dir/src/init_runtime_local.cpp.o"
+  "CMakeFiles/hpx_init_runtime_local.dir/src/init_runtime_local.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_init_runtime_local.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/shutdown_suspended_thread_local_test"
+  "../../../../../bin/shutdown_suspended_thread_local_test.pdb"
+  "CMakeFiles/shutdown_suspended_thread_local_test.dir/shutdown_suspended_thread_local.cpp.o"
+  "CMakeFiles/shutdown_suspended_thread_local_test.dir/shutdown_suspended_thread_local.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shutdown_suspended_thread_local_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
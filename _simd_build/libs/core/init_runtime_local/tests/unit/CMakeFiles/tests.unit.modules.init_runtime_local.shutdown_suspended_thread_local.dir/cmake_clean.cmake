@@ -0,0 +1,5 @@
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/tests.unit.modules.init_runtime_local.shutdown_suspended_thread_local.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
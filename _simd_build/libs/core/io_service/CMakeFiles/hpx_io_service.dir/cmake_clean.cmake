@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_io_service.a"
+  "../../../lib/libhpx_io_service.pdb"
+  "CMakeFiles/hpx_io_service.dir/src/io_service_pool.cpp.o"
+  "CMakeFiles/hpx_io_service.dir/src/io_service_pool.cpp.o.d"
+  "CMakeFiles/hpx_io_service.dir/src/io_service_thread_pool.cpp.o"
+  "CMakeFiles/hpx_io_service.dir/src/io_service_thread_pool.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_io_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
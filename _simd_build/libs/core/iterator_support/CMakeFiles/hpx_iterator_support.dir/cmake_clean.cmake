@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_iterator_support.a"
+  "../../../lib/libhpx_iterator_support.pdb"
+  "CMakeFiles/hpx_iterator_support.dir/__/__/src/empty.cpp.o"
+  "CMakeFiles/hpx_iterator_support.dir/__/__/src/empty.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_iterator_support.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
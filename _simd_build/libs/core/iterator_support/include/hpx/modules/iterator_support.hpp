@@ -0,0 +1,26 @@
+//  Copyright (c) 2019-2022 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Do not edit this file! It has been generated by the cmake configuration step.
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_MODULE_ITERATOR_SUPPORT)
+#include <hpx/iterator_support/traits/is_sentinel_for.hpp>
+#include <hpx/iterator_support/boost_iterator_categories.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
+#include <hpx/iterator_support/counting_shape.hpp>
+#include <hpx/iterator_support/generator_iterator.hpp>
+#include <hpx/iterator_support/iterator_adaptor.hpp>
+#include <hpx/iterator_support/iterator_facade.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/iterator_support/range.hpp>
+#include <hpx/iterator_support/transform_iterator.hpp>
+#include <hpx/iterator_support/zip_iterator.hpp>
+#endif
+
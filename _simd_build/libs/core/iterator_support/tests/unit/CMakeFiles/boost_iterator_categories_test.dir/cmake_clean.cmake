@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/boost_iterator_categories_test"
+  "../../../../../bin/boost_iterator_categories_test.pdb"
+  "CMakeFiles/boost_iterator_categories_test.dir/boost_iterator_categories.cpp.o"
+  "CMakeFiles/boost_iterator_categories_test.dir/boost_iterator_categories.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/boost_iterator_categories_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/counting_iterator_test"
+  "../../../../../bin/counting_iterator_test.pdb"
+  "CMakeFiles/counting_iterator_test.dir/counting_iterator.cpp.o"
+  "CMakeFiles/counting_iterator_test.dir/counting_iterator.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/counting_iterator_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/is_iterator_test"
+  "../../../../../bin/is_iterator_test.pdb"
+  "CMakeFiles/is_iterator_test.dir/is_iterator.cpp.o"
+  "CMakeFiles/is_iterator_test.dir/is_iterator.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/is_iterator_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
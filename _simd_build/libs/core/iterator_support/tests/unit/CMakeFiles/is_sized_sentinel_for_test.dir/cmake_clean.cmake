@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/is_sized_sentinel_for_test"
+  "../../../../../bin/is_sized_sentinel_for_test.pdb"
+  "CMakeFiles/is_sized_sentinel_for_test.dir/is_sized_sentinel_for.cpp.o"
+  "CMakeFiles/is_sized_sentinel_for_test.dir/is_sized_sentinel_for.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/is_sized_sentinel_for_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
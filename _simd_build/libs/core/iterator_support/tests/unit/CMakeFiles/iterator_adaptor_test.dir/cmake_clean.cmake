@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/iterator_adaptor_test"
+  "../../../../../bin/iterator_adaptor_test.pdb"
+  "CMakeFiles/iterator_adaptor_test.dir/iterator_adaptor.cpp.o"
+  "CMakeFiles/iterator_adaptor_test.dir/iterator_adaptor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/iterator_adaptor_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/iterator_facade_test"
+  "../../../../../bin/iterator_facade_test.pdb"
+  "CMakeFiles/iterator_facade_test.dir/iterator_facade.cpp.o"
+  "CMakeFiles/iterator_facade_test.dir/iterator_facade.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/iterator_facade_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
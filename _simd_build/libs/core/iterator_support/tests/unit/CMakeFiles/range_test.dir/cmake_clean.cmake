@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/range_test"
+  "../../../../../bin/range_test.pdb"
+  "CMakeFiles/range_test.dir/range.cpp.o"
+  "CMakeFiles/range_test.dir/range.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/range_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/stencil3_iterator_test"
+  "../../../../../bin/stencil3_iterator_test.pdb"
+  "CMakeFiles/stencil3_iterator_test.dir/stencil3_iterator.cpp.o"
+  "CMakeFiles/stencil3_iterator_test.dir/stencil3_iterator.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stencil3_iterator_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
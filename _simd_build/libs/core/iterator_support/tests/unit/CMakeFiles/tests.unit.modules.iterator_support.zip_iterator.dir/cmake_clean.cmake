@@ -0,0 +1,5 @@
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/tests.unit.modules.iterator_support.zip_iterator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
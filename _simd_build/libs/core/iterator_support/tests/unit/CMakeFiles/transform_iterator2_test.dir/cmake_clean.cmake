@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/transform_iterator2_test"
+  "../../../../../bin/transform_iterator2_test.pdb"
+  "CMakeFiles/transform_iterator2_test.dir/transform_iterator2.cpp.o"
+  "CMakeFiles/transform_iterator2_test.dir/transform_iterator2.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/transform_iterator2_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/transform_iterator_test"
+  "../../../../../bin/transform_iterator_test.pdb"
+  "CMakeFiles/transform_iterator_test.dir/transform_iterator.cpp.o"
+  "CMakeFiles/transform_iterator_test.dir/transform_iterator.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/transform_iterator_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
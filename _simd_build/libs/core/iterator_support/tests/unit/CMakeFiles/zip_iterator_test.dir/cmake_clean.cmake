@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/zip_iterator_test"
+  "../../../../../bin/zip_iterator_test.pdb"
+  "CMakeFiles/zip_iterator_test.dir/zip_iterator.cpp.o"
+  "CMakeFiles/zip_iterator_test.dir/zip_iterator.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/zip_iterator_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
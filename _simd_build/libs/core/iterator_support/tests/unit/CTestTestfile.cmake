@@ -0,0 +1,32 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/iterator_support/tests/unit
+# Build directory: /root/repo/_simd_build/libs/core/iterator_support/tests/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tests.unit.modules.iterator_support.boost_iterator_categories "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/boost_iterator_categories_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.iterator_support.boost_iterator_categories PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/iterator_support/tests/unit/CMakeLists.txt;47;add_hpx_unit_test;/root/repo/libs/core/iterator_support/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.iterator_support.counting_iterator "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/counting_iterator_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.iterator_support.counting_iterator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/iterator_support/tests/unit/CMakeLists.txt;47;add_hpx_unit_test;/root/repo/libs/core/iterator_support/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.iterator_support.is_iterator "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/is_iterator_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.iterator_support.is_iterator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/iterator_support/tests/unit/CMakeLists.txt;47;add_hpx_unit_test;/root/repo/libs/core/iterator_support/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.iterator_support.is_range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/is_range_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.iterator_support.is_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/iterator_support/tests/unit/CMakeLists.txt;47;add_hpx_unit_test;/root/repo/libs/core/iterator_support/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.iterator_support.iterator_adaptor "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/iterator_adaptor_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.iterator_support.iterator_adaptor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/iterator_support/tests/unit/CMakeLists.txt;47;add_hpx_unit_test;/root/repo/libs/core/iterator_support/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.iterator_support.iterator_facade "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/iterator_facade_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.iterator_support.iterator_facade PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/iterator_support/tests/unit/CMakeLists.txt;47;add_hpx_unit_test;/root/repo/libs/core/iterator_support/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.iterator_support.range "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/range_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.iterator_support.range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/iterator_support/tests/unit/CMakeLists.txt;47;add_hpx_unit_test;/root/repo/libs/core/iterator_support/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.iterator_support.stencil3_iterator "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/stencil3_iterator_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.iterator_support.stencil3_iterator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/iterator_support/tests/unit/CMakeLists.txt;47;add_hpx_unit_test;/root/repo/libs/core/iterator_support/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.iterator_support.transform_iterator "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/transform_iterator_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.iterator_support.transform_iterator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/iterator_support/tests/unit/CMakeLists.txt;47;add_hpx_unit_test;/root/repo/libs/core/iterator_support/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.iterator_support.transform_iterator2 "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/transform_iterator2_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.iterator_support.transform_iterator2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/iterator_support/tests/unit/CMakeLists.txt;47;add_hpx_unit_test;/root/repo/libs/core/iterator_support/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.iterator_support.zip_iterator "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/zip_iterator_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.iterator_support.zip_iterator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/iterator_support/tests/unit/CMakeLists.txt;47;add_hpx_unit_test;/root/repo/libs/core/iterator_support/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.iterator_support.is_sentinel_for "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/is_sentinel_for_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.iterator_support.is_sentinel_for PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/iterator_support/tests/unit/CMakeLists.txt;47;add_hpx_unit_test;/root/repo/libs/core/iterator_support/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.iterator_support.is_sized_sentinel_for "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/is_sized_sentinel_for_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.iterator_support.is_sized_sentinel_for PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/iterator_support/tests/unit/CMakeLists.txt;47;add_hpx_unit_test;/root/repo/libs/core/iterator_support/tests/unit/CMakeLists.txt;0;")
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs/core/itt_notify/src/itt_notify.cpp" "libs/core/itt_notify/CMakeFiles/hpx_itt_notify.dir/src/itt_notify.cpp.o" "gcc" "libs/core/itt_notify/CMakeFiles/hpx_itt_notify.dir/src/itt_notify.cpp.o.d"
+  "/root/repo/libs/core/itt_notify/src/thread_name.cpp" "libs/core/itt_notify/CMakeFiles/hpx_itt_notify.dir/src/thread_name.cpp.o" "gcc" "libs/core/itt_notify/CMakeFiles/hpx_itt_notify.dir/src/thread_name.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_simd_build/libs/core/config/CMakeFiles/hpx_config.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/config_registry/CMakeFiles/hpx_config_registry.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/preprocessor/CMakeFiles/hpx_preprocessor.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_itt_notify.a"
+  "../../../lib/libhpx_itt_notify.pdb"
+  "CMakeFiles/hpx_itt_notify.dir/src/itt_notify.cpp.o"
+  "CMakeFiles/hpx_itt_notify.dir/src/itt_notify.cpp.o.d"
+  "CMakeFiles/hpx_itt_notify.dir/src/thread_name.cpp.o"
+  "CMakeFiles/hpx_itt_notify.dir/src/thread_name.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_itt_notify.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_lcos_local.a"
+  "../../../lib/libhpx_lcos_local.pdb"
+  "CMakeFiles/hpx_lcos_local.dir/src/composable_guard.cpp.o"
+  "CMakeFiles/hpx_lcos_local.dir/src/composable_guard.cpp.o.d"
+  "CMakeFiles/hpx_lcos_local.dir/src/preprocess_future.cpp.o"
+  "CMakeFiles/hpx_lcos_local.dir/src/preprocess_future.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_lcos_local.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
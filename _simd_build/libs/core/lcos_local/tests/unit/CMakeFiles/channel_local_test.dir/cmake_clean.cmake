@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/channel_local_test"
+  "../../../../../bin/channel_local_test.pdb"
+  "CMakeFiles/channel_local_test.dir/channel_local.cpp.o"
+  "CMakeFiles/channel_local_test.dir/channel_local.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/channel_local_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/local_dataflow_test"
+  "../../../../../bin/local_dataflow_test.pdb"
+  "CMakeFiles/local_dataflow_test.dir/local_dataflow.cpp.o"
+  "CMakeFiles/local_dataflow_test.dir/local_dataflow.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/local_dataflow_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/run_guarded_test"
+  "../../../../../bin/run_guarded_test.pdb"
+  "CMakeFiles/run_guarded_test.dir/run_guarded.cpp.o"
+  "CMakeFiles/run_guarded_test.dir/run_guarded.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_guarded_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
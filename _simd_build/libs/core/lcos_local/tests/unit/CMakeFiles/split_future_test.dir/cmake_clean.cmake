@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/split_future_test"
+  "../../../../../bin/split_future_test.pdb"
+  "CMakeFiles/split_future_test.dir/split_future.cpp.o"
+  "CMakeFiles/split_future_test.dir/split_future.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/split_future_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
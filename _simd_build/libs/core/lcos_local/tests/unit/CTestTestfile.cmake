@@ -0,0 +1,24 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/lcos_local/tests/unit
+# Build directory: /root/repo/_simd_build/libs/core/lcos_local/tests/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tests.unit.modules.lcos_local.channel_local "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/channel_local_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.lcos_local.channel_local PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/lcos_local/tests/unit/CMakeLists.txt;42;add_hpx_unit_test;/root/repo/libs/core/lcos_local/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.lcos_local.local_dataflow "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/local_dataflow_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.lcos_local.local_dataflow PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/lcos_local/tests/unit/CMakeLists.txt;42;add_hpx_unit_test;/root/repo/libs/core/lcos_local/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.lcos_local.local_dataflow_small_vector "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/local_dataflow_small_vector_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.lcos_local.local_dataflow_small_vector PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/lcos_local/tests/unit/CMakeLists.txt;42;add_hpx_unit_test;/root/repo/libs/core/lcos_local/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.lcos_local.local_dataflow_executor "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/local_dataflow_executor_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.lcos_local.local_dataflow_executor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/lcos_local/tests/unit/CMakeLists.txt;42;add_hpx_unit_test;/root/repo/libs/core/lcos_local/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.lcos_local.local_dataflow_external_future "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/local_dataflow_external_future_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.lcos_local.local_dataflow_external_future PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/lcos_local/tests/unit/CMakeLists.txt;42;add_hpx_unit_test;/root/repo/libs/core/lcos_local/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.lcos_local.local_dataflow_executor_additional_arguments "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/local_dataflow_executor_additional_arguments_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.lcos_local.local_dataflow_executor_additional_arguments PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/lcos_local/tests/unit/CMakeLists.txt;42;add_hpx_unit_test;/root/repo/libs/core/lcos_local/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.lcos_local.local_dataflow_std_array "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/local_dataflow_std_array_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.lcos_local.local_dataflow_std_array PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/lcos_local/tests/unit/CMakeLists.txt;42;add_hpx_unit_test;/root/repo/libs/core/lcos_local/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.lcos_local.run_guarded "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/run_guarded_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.lcos_local.run_guarded PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/lcos_local/tests/unit/CMakeLists.txt;42;add_hpx_unit_test;/root/repo/libs/core/lcos_local/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.lcos_local.split_future "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/split_future_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.lcos_local.split_future PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/lcos_local/tests/unit/CMakeLists.txt;42;add_hpx_unit_test;/root/repo/libs/core/lcos_local/tests/unit/CMakeLists.txt;0;")
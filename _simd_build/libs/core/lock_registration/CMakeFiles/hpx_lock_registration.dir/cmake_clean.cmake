@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_lock_registration.a"
+  "../../../lib/libhpx_lock_registration.pdb"
+  "CMakeFiles/hpx_lock_registration.dir/src/register_locks.cpp.o"
+  "CMakeFiles/hpx_lock_registration.dir/src/register_locks.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_lock_registration.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
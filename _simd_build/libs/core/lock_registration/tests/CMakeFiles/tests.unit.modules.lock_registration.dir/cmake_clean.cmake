@@ -0,0 +1,5 @@
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/tests.unit.modules.lock_registration.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
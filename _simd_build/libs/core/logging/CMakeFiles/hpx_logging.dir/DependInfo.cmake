@@ -0,0 +1,38 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs/core/logging/src/format/destination/defaults_destination.cpp" "libs/core/logging/CMakeFiles/hpx_logging.dir/src/format/destination/defaults_destination.cpp.o" "gcc" "libs/core/logging/CMakeFiles/hpx_logging.dir/src/format/destination/defaults_destination.cpp.o.d"
+  "/root/repo/libs/core/logging/src/format/destination/file.cpp" "libs/core/logging/CMakeFiles/hpx_logging.dir/src/format/destination/file.cpp.o" "gcc" "libs/core/logging/CMakeFiles/hpx_logging.dir/src/format/destination/file.cpp.o.d"
+  "/root/repo/libs/core/logging/src/format/formatter/defaults_formatter.cpp" "libs/core/logging/CMakeFiles/hpx_logging.dir/src/format/formatter/defaults_formatter.cpp.o" "gcc" "libs/core/logging/CMakeFiles/hpx_logging.dir/src/format/formatter/defaults_formatter.cpp.o.d"
+  "/root/repo/libs/core/logging/src/format/formatter/high_precision_time.cpp" "libs/core/logging/CMakeFiles/hpx_logging.dir/src/format/formatter/high_precision_time.cpp.o" "gcc" "libs/core/logging/CMakeFiles/hpx_logging.dir/src/format/formatter/high_precision_time.cpp.o.d"
+  "/root/repo/libs/core/logging/src/format/formatter/thread_id.cpp" "libs/core/logging/CMakeFiles/hpx_logging.dir/src/format/formatter/thread_id.cpp.o" "gcc" "libs/core/logging/CMakeFiles/hpx_logging.dir/src/format/formatter/thread_id.cpp.o.d"
+  "/root/repo/libs/core/logging/src/format/named_write.cpp" "libs/core/logging/CMakeFiles/hpx_logging.dir/src/format/named_write.cpp.o" "gcc" "libs/core/logging/CMakeFiles/hpx_logging.dir/src/format/named_write.cpp.o.d"
+  "/root/repo/libs/core/logging/src/level.cpp" "libs/core/logging/CMakeFiles/hpx_logging.dir/src/level.cpp.o" "gcc" "libs/core/logging/CMakeFiles/hpx_logging.dir/src/level.cpp.o.d"
+  "/root/repo/libs/core/logging/src/logging.cpp" "libs/core/logging/CMakeFiles/hpx_logging.dir/src/logging.cpp.o" "gcc" "libs/core/logging/CMakeFiles/hpx_logging.dir/src/logging.cpp.o.d"
+  "/root/repo/libs/core/logging/src/manipulator.cpp" "libs/core/logging/CMakeFiles/hpx_logging.dir/src/manipulator.cpp.o" "gcc" "libs/core/logging/CMakeFiles/hpx_logging.dir/src/manipulator.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_simd_build/libs/core/assertion/CMakeFiles/hpx_assertion.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/config/CMakeFiles/hpx_config.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/format/CMakeFiles/hpx_format.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/filesystem/CMakeFiles/hpx_filesystem.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/timing/CMakeFiles/hpx_timing.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/thread_support/CMakeFiles/hpx_thread_support.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/config_registry/CMakeFiles/hpx_config_registry.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/hardware/CMakeFiles/hpx_hardware.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/type_support/CMakeFiles/hpx_type_support.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/concepts/CMakeFiles/hpx_concepts.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/preprocessor/CMakeFiles/hpx_preprocessor.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
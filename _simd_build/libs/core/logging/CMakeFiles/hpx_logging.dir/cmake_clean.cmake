@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_logging.a"
+  "../../../lib/libhpx_logging.pdb"
+  "CMakeFiles/hpx_logging.dir/src/format/destination/defaults_destination.cpp.o"
+  "CMakeFiles/hpx_logging.dir/src/format/destination/defaults_destination.cpp.o.d"
+  "CMakeFiles/hpx_logging.dir/src/format/destination/file.cpp.o"
+  "CMakeFiles/hpx_logging.dir/src/format/destination/file.cpp.o.d"
+  "CMakeFiles/hpx_logging.dir/src/format/formatter/defaults_formatter.cpp.o"
+  "CMakeFiles/hpx_logging.dir/src/format/formatter/defaults_formatter.cpp.o.d"
+  "CMakeFiles/hpx_logging.dir/src/format/formatter/high_precision_time.cpp.o"
+  "CMakeFiles/hpx_logging.dir/src/format/formatter/high_precision_time.cpp.o.d"
+  "CMakeFiles/hpx_logging.dir/src/format/formatter/thread_id.cpp.o"
+  "CMakeFiles/hpx_logging.dir/src/format/formatter/thread_id.cpp.o.d"
+  "CMakeFiles/hpx_logging.dir/src/format/named_write.cpp.o"
+  "CMakeFiles/hpx_logging.dir/src/format/named_write.cpp.o.d"
+  "CMakeFiles/hpx_logging.dir/src/level.cpp.o"
+  "CMakeFiles/hpx_logging.dir/src/level.cpp.o.d"
+  "CMakeFiles/hpx_logging.dir/src/logging.cpp.o"
+  "CMakeFiles/hpx_logging.dir/src/logging.cpp.o.d"
+  "CMakeFiles/hpx_logging.dir/src/manipulator.cpp.o"
+  "CMakeFiles/hpx_logging.dir/src/manipulator.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_logging.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_memory.a"
+  "../../../lib/libhpx_memory.pdb"
+  "CMakeFiles/hpx_memory.dir/__/__/src/empty.cpp.o"
+  "CMakeFiles/hpx_memory.dir/__/__/src/empty.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_memory.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/intrusive_ptr_move_test"
+  "../../../../../bin/intrusive_ptr_move_test.pdb"
+  "CMakeFiles/intrusive_ptr_move_test.dir/intrusive_ptr_move.cpp.o"
+  "CMakeFiles/intrusive_ptr_move_test.dir/intrusive_ptr_move.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/intrusive_ptr_move_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
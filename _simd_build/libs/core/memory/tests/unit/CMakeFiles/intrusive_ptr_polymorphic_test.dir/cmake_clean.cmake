@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/intrusive_ptr_polymorphic_test"
+  "../../../../../bin/intrusive_ptr_polymorphic_test.pdb"
+  "CMakeFiles/intrusive_ptr_polymorphic_test.dir/intrusive_ptr_polymorphic.cpp.o"
+  "CMakeFiles/intrusive_ptr_polymorphic_test.dir/intrusive_ptr_polymorphic.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/intrusive_ptr_polymorphic_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
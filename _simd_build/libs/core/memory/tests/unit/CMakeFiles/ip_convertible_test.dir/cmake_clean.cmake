@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/ip_convertible_test"
+  "../../../../../bin/ip_convertible_test.pdb"
+  "CMakeFiles/ip_convertible_test.dir/ip_convertible.cpp.o"
+  "CMakeFiles/ip_convertible_test.dir/ip_convertible.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ip_convertible_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/ip_hash_test"
+  "../../../../../bin/ip_hash_test.pdb"
+  "CMakeFiles/ip_hash_test.dir/ip_hash.cpp.o"
+  "CMakeFiles/ip_hash_test.dir/ip_hash.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ip_hash_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
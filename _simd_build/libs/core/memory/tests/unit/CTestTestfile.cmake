@@ -0,0 +1,20 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/memory/tests/unit
+# Build directory: /root/repo/_simd_build/libs/core/memory/tests/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tests.unit.modules.memory.intrusive_ptr "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/intrusive_ptr_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.memory.intrusive_ptr PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/memory/tests/unit/CMakeLists.txt;31;add_hpx_unit_test;/root/repo/libs/core/memory/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.memory.intrusive_ptr_move "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/intrusive_ptr_move_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.memory.intrusive_ptr_move PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/memory/tests/unit/CMakeLists.txt;31;add_hpx_unit_test;/root/repo/libs/core/memory/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.memory.intrusive_ptr_polymorphic "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/intrusive_ptr_polymorphic_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.memory.intrusive_ptr_polymorphic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/memory/tests/unit/CMakeLists.txt;31;add_hpx_unit_test;/root/repo/libs/core/memory/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.memory.intrusive_ptr_polymorphic_nonintrusive "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/intrusive_ptr_polymorphic_nonintrusive_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.memory.intrusive_ptr_polymorphic_nonintrusive PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/memory/tests/unit/CMakeLists.txt;31;add_hpx_unit_test;/root/repo/libs/core/memory/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.memory.ip_convertible "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/ip_convertible_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.memory.ip_convertible PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/memory/tests/unit/CMakeLists.txt;31;add_hpx_unit_test;/root/repo/libs/core/memory/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.memory.ip_hash "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/ip_hash_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.memory.ip_hash PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/memory/tests/unit/CMakeLists.txt;31;add_hpx_unit_test;/root/repo/libs/core/memory/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.memory.serialization_intrusive_ptr "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/serialization_intrusive_ptr_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.memory.serialization_intrusive_ptr PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/memory/tests/unit/CMakeLists.txt;31;add_hpx_unit_test;/root/repo/libs/core/memory/tests/unit/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_pack_traversal.a"
+  "../../../lib/libhpx_pack_traversal.pdb"
+  "CMakeFiles/hpx_pack_traversal.dir/__/__/src/empty.cpp.o"
+  "CMakeFiles/hpx_pack_traversal.dir/__/__/src/empty.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_pack_traversal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
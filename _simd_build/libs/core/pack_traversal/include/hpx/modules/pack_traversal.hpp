@@ -0,0 +1,19 @@
+//  Copyright (c) 2019-2022 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Do not edit this file! It has been generated by the cmake configuration step.
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_MODULE_PACK_TRAVERSAL)
+#include <hpx/pack_traversal/pack_traversal.hpp>
+#include <hpx/pack_traversal/pack_traversal_async.hpp>
+#include <hpx/pack_traversal/traits/pack_traversal_rebind_container.hpp>
+#include <hpx/pack_traversal/unwrap.hpp>
+#endif
+
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/pack_traversal_async_test"
+  "../../../../../bin/pack_traversal_async_test.pdb"
+  "CMakeFiles/pack_traversal_async_test.dir/pack_traversal_async.cpp.o"
+  "CMakeFiles/pack_traversal_async_test.dir/pack_traversal_async.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pack_traversal_async_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
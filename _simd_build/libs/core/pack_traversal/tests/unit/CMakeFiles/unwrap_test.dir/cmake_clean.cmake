@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/unwrap_test"
+  "../../../../../bin/unwrap_test.pdb"
+  "CMakeFiles/unwrap_test.dir/unwrap.cpp.o"
+  "CMakeFiles/unwrap_test.dir/unwrap.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unwrap_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
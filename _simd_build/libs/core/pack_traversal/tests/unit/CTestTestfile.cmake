@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/pack_traversal/tests/unit
+# Build directory: /root/repo/_simd_build/libs/core/pack_traversal/tests/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tests.unit.modules.pack_traversal.pack_traversal "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/pack_traversal_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.pack_traversal.pack_traversal PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/pack_traversal/tests/unit/CMakeLists.txt;21;add_hpx_unit_test;/root/repo/libs/core/pack_traversal/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.pack_traversal.pack_traversal_async "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/pack_traversal_async_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.pack_traversal.pack_traversal_async PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/pack_traversal/tests/unit/CMakeLists.txt;21;add_hpx_unit_test;/root/repo/libs/core/pack_traversal/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.pack_traversal.unwrap "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/unwrap_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.pack_traversal.unwrap PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/pack_traversal/tests/unit/CMakeLists.txt;21;add_hpx_unit_test;/root/repo/libs/core/pack_traversal/tests/unit/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_plugin.a"
+  "../../../lib/libhpx_plugin.pdb"
+  "CMakeFiles/hpx_plugin.dir/__/__/src/empty.cpp.o"
+  "CMakeFiles/hpx_plugin.dir/__/__/src/empty.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_plugin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
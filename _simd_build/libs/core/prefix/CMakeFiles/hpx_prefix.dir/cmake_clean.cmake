@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_prefix.a"
+  "../../../lib/libhpx_prefix.pdb"
+  "CMakeFiles/hpx_prefix.dir/src/find_prefix.cpp.o"
+  "CMakeFiles/hpx_prefix.dir/src/find_prefix.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_prefix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_preprocessor.a"
+  "../../../lib/libhpx_preprocessor.pdb"
+  "CMakeFiles/hpx_preprocessor.dir/__/__/src/empty.cpp.o"
+  "CMakeFiles/hpx_preprocessor.dir/__/__/src/empty.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_preprocessor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,49 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs/core/program_options/src/cmdline.cpp" "libs/core/program_options/CMakeFiles/hpx_program_options.dir/src/cmdline.cpp.o" "gcc" "libs/core/program_options/CMakeFiles/hpx_program_options.dir/src/cmdline.cpp.o.d"
+  "/root/repo/libs/core/program_options/src/config_file.cpp" "libs/core/program_options/CMakeFiles/hpx_program_options.dir/src/config_file.cpp.o" "gcc" "libs/core/program_options/CMakeFiles/hpx_program_options.dir/src/config_file.cpp.o.d"
+  "/root/repo/libs/core/program_options/src/convert.cpp" "libs/core/program_options/CMakeFiles/hpx_program_options.dir/src/convert.cpp.o" "gcc" "libs/core/program_options/CMakeFiles/hpx_program_options.dir/src/convert.cpp.o.d"
+  "/root/repo/libs/core/program_options/src/options_description.cpp" "libs/core/program_options/CMakeFiles/hpx_program_options.dir/src/options_description.cpp.o" "gcc" "libs/core/program_options/CMakeFiles/hpx_program_options.dir/src/options_description.cpp.o.d"
+  "/root/repo/libs/core/program_options/src/parsers.cpp" "libs/core/program_options/CMakeFiles/hpx_program_options.dir/src/parsers.cpp.o" "gcc" "libs/core/program_options/CMakeFiles/hpx_program_options.dir/src/parsers.cpp.o.d"
+  "/root/repo/libs/core/program_options/src/positional_options.cpp" "libs/core/program_options/CMakeFiles/hpx_program_options.dir/src/positional_options.cpp.o" "gcc" "libs/core/program_options/CMakeFiles/hpx_program_options.dir/src/positional_options.cpp.o.d"
+  "/root/repo/libs/core/program_options/src/split.cpp" "libs/core/program_options/CMakeFiles/hpx_program_options.dir/src/split.cpp.o" "gcc" "libs/core/program_options/CMakeFiles/hpx_program_options.dir/src/split.cpp.o.d"
+  "/root/repo/libs/core/program_options/src/utf8_codecvt_facet.cpp" "libs/core/program_options/CMakeFiles/hpx_program_options.dir/src/utf8_codecvt_facet.cpp.o" "gcc" "libs/core/program_options/CMakeFiles/hpx_program_options.dir/src/utf8_codecvt_facet.cpp.o.d"
+  "/root/repo/libs/core/program_options/src/value_semantic.cpp" "libs/core/program_options/CMakeFiles/hpx_program_options.dir/src/value_semantic.cpp.o" "gcc" "libs/core/program_options/CMakeFiles/hpx_program_options.dir/src/value_semantic.cpp.o.d"
+  "/root/repo/libs/core/program_options/src/variables_map.cpp" "libs/core/program_options/CMakeFiles/hpx_program_options.dir/src/variables_map.cpp.o" "gcc" "libs/core/program_options/CMakeFiles/hpx_program_options.dir/src/variables_map.cpp.o.d"
+  "/root/repo/libs/core/program_options/src/winmain.cpp" "libs/core/program_options/CMakeFiles/hpx_program_options.dir/src/winmain.cpp.o" "gcc" "libs/core/program_options/CMakeFiles/hpx_program_options.dir/src/winmain.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_simd_build/libs/core/config/CMakeFiles/hpx_config.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/datastructures/CMakeFiles/hpx_datastructures.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/format/CMakeFiles/hpx_format.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/iterator_support/CMakeFiles/hpx_iterator_support.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/config_registry/CMakeFiles/hpx_config_registry.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/functional/CMakeFiles/hpx_functional.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/serialization/CMakeFiles/hpx_serialization.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/errors/CMakeFiles/hpx_errors.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/logging/CMakeFiles/hpx_logging.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/filesystem/CMakeFiles/hpx_filesystem.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/timing/CMakeFiles/hpx_timing.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/hardware/CMakeFiles/hpx_hardware.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/thread_support/CMakeFiles/hpx_thread_support.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/debugging/CMakeFiles/hpx_debugging.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/itt_notify/CMakeFiles/hpx_itt_notify.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/tag_invoke/CMakeFiles/hpx_tag_invoke.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/type_support/CMakeFiles/hpx_type_support.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/assertion/CMakeFiles/hpx_assertion.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/concepts/CMakeFiles/hpx_concepts.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/preprocessor/CMakeFiles/hpx_preprocessor.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
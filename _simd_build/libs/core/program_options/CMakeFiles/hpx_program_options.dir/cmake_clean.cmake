@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_program_options.a"
+  "../../../lib/libhpx_program_options.pdb"
+  "CMakeFiles/hpx_program_options.dir/src/cmdline.cpp.o"
+  "CMakeFiles/hpx_program_options.dir/src/cmdline.cpp.o.d"
+  "CMakeFiles/hpx_program_options.dir/src/config_file.cpp.o"
+  "CMakeFiles/hpx_program_options.dir/src/config_file.cpp.o.d"
+  "CMakeFiles/hpx_program_options.dir/src/convert.cpp.o"
+  "CMakeFiles/hpx_program_options.dir/src/convert.cpp.o.d"
+  "CMakeFiles/hpx_program_options.dir/src/options_description.cpp.o"
+  "CMakeFiles/hpx_program_options.dir/src/options_description.cpp.o.d"
+  "CMakeFiles/hpx_program_options.dir/src/parsers.cpp.o"
+  "CMakeFiles/hpx_program_options.dir/src/parsers.cpp.o.d"
+  "CMakeFiles/hpx_program_options.dir/src/positional_options.cpp.o"
+  "CMakeFiles/hpx_program_options.dir/src/positional_options.cpp.o.d"
+  "CMakeFiles/hpx_program_options.dir/src/split.cpp.o"
+  "CMakeFiles/hpx_program_options.dir/src/split.cpp.o.d"
+  "CMakeFiles/hpx_program_options.dir/src/utf8_codecvt_facet.cpp.o"
+  "CMakeFiles/hpx_program_options.dir/src/utf8_codecvt_facet.cpp.o.d"
+  "CMakeFiles/hpx_program_options.dir/src/value_semantic.cpp.o"
+  "CMakeFiles/hpx_program_options.dir/src/value_semantic.cpp.o.d"
+  "CMakeFiles/hpx_program_options.dir/src/variables_map.cpp.o"
+  "CMakeFiles/hpx_program_options.dir/src/variables_map.cpp.o.d"
+  "CMakeFiles/hpx_program_options.dir/src/winmain.cpp.o"
+  "CMakeFiles/hpx_program_options.dir/src/winmain.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_program_options.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
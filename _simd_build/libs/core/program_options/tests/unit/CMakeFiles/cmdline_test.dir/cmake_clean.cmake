@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/cmdline_test"
+  "../../../../../bin/cmdline_test.pdb"
+  "CMakeFiles/cmdline_test.dir/cmdline.cpp.o"
+  "CMakeFiles/cmdline_test.dir/cmdline.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cmdline_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/optional_test"
+  "../../../../../bin/optional_test.pdb"
+  "CMakeFiles/optional_test.dir/optional.cpp.o"
+  "CMakeFiles/optional_test.dir/optional.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/optional_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
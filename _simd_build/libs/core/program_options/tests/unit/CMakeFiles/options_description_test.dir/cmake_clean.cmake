@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/options_description_test"
+  "../../../../../bin/options_description_test.pdb"
+  "CMakeFiles/options_description_test.dir/options_description.cpp.o"
+  "CMakeFiles/options_description_test.dir/options_description.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/options_description_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
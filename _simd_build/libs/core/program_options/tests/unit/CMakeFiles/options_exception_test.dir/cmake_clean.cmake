@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/options_exception_test"
+  "../../../../../bin/options_exception_test.pdb"
+  "CMakeFiles/options_exception_test.dir/options_exception.cpp.o"
+  "CMakeFiles/options_exception_test.dir/options_exception.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/options_exception_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/parsers_test"
+  "../../../../../bin/parsers_test.pdb"
+  "CMakeFiles/parsers_test.dir/parsers.cpp.o"
+  "CMakeFiles/parsers_test.dir/parsers.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/parsers_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
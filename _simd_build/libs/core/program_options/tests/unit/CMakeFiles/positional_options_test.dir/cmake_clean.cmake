@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/positional_options_test"
+  "../../../../../bin/positional_options_test.pdb"
+  "CMakeFiles/positional_options_test.dir/positional_options.cpp.o"
+  "CMakeFiles/positional_options_test.dir/positional_options.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/positional_options_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/required_test"
+  "../../../../../bin/required_test.pdb"
+  "CMakeFiles/required_test.dir/required.cpp.o"
+  "CMakeFiles/required_test.dir/required.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/required_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/split_test"
+  "../../../../../bin/split_test.pdb"
+  "CMakeFiles/split_test.dir/split.cpp.o"
+  "CMakeFiles/split_test.dir/split.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/split_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
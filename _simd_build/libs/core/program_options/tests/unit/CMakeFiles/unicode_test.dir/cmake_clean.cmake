@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/unicode_test"
+  "../../../../../bin/unicode_test.pdb"
+  "CMakeFiles/unicode_test.dir/unicode.cpp.o"
+  "CMakeFiles/unicode_test.dir/unicode.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unicode_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/unrecognized_test"
+  "../../../../../bin/unrecognized_test.pdb"
+  "CMakeFiles/unrecognized_test.dir/unrecognized.cpp.o"
+  "CMakeFiles/unrecognized_test.dir/unrecognized.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unrecognized_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/variable_map_test"
+  "../../../../../bin/variable_map_test.pdb"
+  "CMakeFiles/variable_map_test.dir/variable_map.cpp.o"
+  "CMakeFiles/variable_map_test.dir/variable_map.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/variable_map_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/winmain_test"
+  "../../../../../bin/winmain_test.pdb"
+  "CMakeFiles/winmain_test.dir/winmain.cpp.o"
+  "CMakeFiles/winmain_test.dir/winmain.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/winmain_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,30 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/program_options/tests/unit
+# Build directory: /root/repo/_simd_build/libs/core/program_options/tests/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tests.unit.modules.program_options.cmdline "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/cmdline_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.program_options.cmdline PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/program_options/tests/unit/CMakeLists.txt;37;add_hpx_unit_test;/root/repo/libs/core/program_options/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.program_options.options_exception "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/options_exception_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.program_options.options_exception PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/program_options/tests/unit/CMakeLists.txt;37;add_hpx_unit_test;/root/repo/libs/core/program_options/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.program_options.optional "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/optional_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.program_options.optional PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/program_options/tests/unit/CMakeLists.txt;37;add_hpx_unit_test;/root/repo/libs/core/program_options/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.program_options.options_description "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/options_description_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.program_options.options_description PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/program_options/tests/unit/CMakeLists.txt;37;add_hpx_unit_test;/root/repo/libs/core/program_options/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.program_options.parsers "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/parsers_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.program_options.parsers PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/program_options/tests/unit/CMakeLists.txt;37;add_hpx_unit_test;/root/repo/libs/core/program_options/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.program_options.positional_options "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/positional_options_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.program_options.positional_options PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/program_options/tests/unit/CMakeLists.txt;37;add_hpx_unit_test;/root/repo/libs/core/program_options/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.program_options.required "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/required_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.program_options.required PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/program_options/tests/unit/CMakeLists.txt;37;add_hpx_unit_test;/root/repo/libs/core/program_options/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.program_options.split "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/split_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.program_options.split PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/program_options/tests/unit/CMakeLists.txt;37;add_hpx_unit_test;/root/repo/libs/core/program_options/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.program_options.unicode "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/unicode_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.program_options.unicode PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/program_options/tests/unit/CMakeLists.txt;37;add_hpx_unit_test;/root/repo/libs/core/program_options/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.program_options.unrecognized "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/unrecognized_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.program_options.unrecognized PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/program_options/tests/unit/CMakeLists.txt;37;add_hpx_unit_test;/root/repo/libs/core/program_options/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.program_options.variable_map "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/variable_map_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.program_options.variable_map PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/program_options/tests/unit/CMakeLists.txt;37;add_hpx_unit_test;/root/repo/libs/core/program_options/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.program_options.winmain "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/winmain_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.program_options.winmain PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/program_options/tests/unit/CMakeLists.txt;37;add_hpx_unit_test;/root/repo/libs/core/program_options/tests/unit/CMakeLists.txt;0;")
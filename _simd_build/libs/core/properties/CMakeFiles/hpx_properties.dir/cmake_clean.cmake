@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_properties.a"
+  "../../../lib/libhpx_properties.pdb"
+  "CMakeFiles/hpx_properties.dir/__/__/src/empty.cpp.o"
+  "CMakeFiles/hpx_properties.dir/__/__/src/empty.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_properties.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
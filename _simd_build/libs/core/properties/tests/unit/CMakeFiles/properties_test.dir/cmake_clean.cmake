@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/properties_test"
+  "../../../../../bin/properties_test.pdb"
+  "CMakeFiles/properties_test.dir/properties.cpp.o"
+  "CMakeFiles/properties_test.dir/properties.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/properties_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
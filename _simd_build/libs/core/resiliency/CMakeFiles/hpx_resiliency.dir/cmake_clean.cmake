@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_resiliency.a"
+  "../../../lib/libhpx_resiliency.pdb"
+  "CMakeFiles/hpx_resiliency.dir/src/resiliency.cpp.o"
+  "CMakeFiles/hpx_resiliency.dir/src/resiliency.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_resiliency.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,26 @@
+//  Copyright (c) 2019-2022 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Do not edit this file! It has been generated by the cmake configuration step.
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_MODULE_RESILIENCY)
+#include <hpx/resiliency/async_replay.hpp>
+#include <hpx/resiliency/async_replay_executor.hpp>
+#include <hpx/resiliency/async_replicate.hpp>
+#include <hpx/resiliency/async_replicate_executor.hpp>
+#include <hpx/resiliency/config.hpp>
+#include <hpx/resiliency/replay_executor.hpp>
+#include <hpx/resiliency/replicate_executor.hpp>
+#include <hpx/resiliency/resiliency.hpp>
+#include <hpx/resiliency/resiliency_cpos.hpp>
+#include <hpx/resiliency/util.hpp>
+#include <hpx/resiliency/version.hpp>
+#endif
+
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/async_replicate_plain_test"
+  "../../../../../bin/async_replicate_plain_test.pdb"
+  "CMakeFiles/async_replicate_plain_test.dir/async_replicate_plain.cpp.o"
+  "CMakeFiles/async_replicate_plain_test.dir/async_replicate_plain.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/async_replicate_plain_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
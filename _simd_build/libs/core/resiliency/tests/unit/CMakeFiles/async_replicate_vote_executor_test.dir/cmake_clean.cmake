@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/async_replicate_vote_executor_test"
+  "../../../../../bin/async_replicate_vote_executor_test.pdb"
+  "CMakeFiles/async_replicate_vote_executor_test.dir/async_replicate_vote_executor.cpp.o"
+  "CMakeFiles/async_replicate_vote_executor_test.dir/async_replicate_vote_executor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/async_replicate_vote_executor_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
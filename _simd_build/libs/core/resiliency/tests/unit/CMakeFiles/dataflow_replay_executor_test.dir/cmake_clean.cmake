@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/dataflow_replay_executor_test"
+  "../../../../../bin/dataflow_replay_executor_test.pdb"
+  "CMakeFiles/dataflow_replay_executor_test.dir/dataflow_replay_executor.cpp.o"
+  "CMakeFiles/dataflow_replay_executor_test.dir/dataflow_replay_executor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dataflow_replay_executor_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/dataflow_replay_plain_test"
+  "../../../../../bin/dataflow_replay_plain_test.pdb"
+  "CMakeFiles/dataflow_replay_plain_test.dir/dataflow_replay_plain.cpp.o"
+  "CMakeFiles/dataflow_replay_plain_test.dir/dataflow_replay_plain.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dataflow_replay_plain_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
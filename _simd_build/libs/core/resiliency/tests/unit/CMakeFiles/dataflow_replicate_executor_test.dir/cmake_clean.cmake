@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/dataflow_replicate_executor_test"
+  "../../../../../bin/dataflow_replicate_executor_test.pdb"
+  "CMakeFiles/dataflow_replicate_executor_test.dir/dataflow_replicate_executor.cpp.o"
+  "CMakeFiles/dataflow_replicate_executor_test.dir/dataflow_replicate_executor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dataflow_replicate_executor_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
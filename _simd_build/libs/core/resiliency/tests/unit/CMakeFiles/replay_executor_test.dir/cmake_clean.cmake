@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/replay_executor_test"
+  "../../../../../bin/replay_executor_test.pdb"
+  "CMakeFiles/replay_executor_test.dir/replay_executor.cpp.o"
+  "CMakeFiles/replay_executor_test.dir/replay_executor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/replay_executor_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/replicate_executor_test"
+  "../../../../../bin/replicate_executor_test.pdb"
+  "CMakeFiles/replicate_executor_test.dir/replicate_executor.cpp.o"
+  "CMakeFiles/replicate_executor_test.dir/replicate_executor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/replicate_executor_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
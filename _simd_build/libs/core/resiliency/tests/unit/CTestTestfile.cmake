@@ -0,0 +1,30 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/resiliency/tests/unit
+# Build directory: /root/repo/_simd_build/libs/core/resiliency/tests/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tests.unit.modules.resiliency.async_replay_executor "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/async_replay_executor_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.resiliency.async_replay_executor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/resiliency/tests/unit/CMakeLists.txt;41;add_hpx_unit_test;/root/repo/libs/core/resiliency/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.resiliency.async_replay_plain "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/async_replay_plain_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.resiliency.async_replay_plain PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/resiliency/tests/unit/CMakeLists.txt;41;add_hpx_unit_test;/root/repo/libs/core/resiliency/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.resiliency.async_replicate_executor "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/async_replicate_executor_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.resiliency.async_replicate_executor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/resiliency/tests/unit/CMakeLists.txt;41;add_hpx_unit_test;/root/repo/libs/core/resiliency/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.resiliency.async_replicate_plain "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/async_replicate_plain_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.resiliency.async_replicate_plain PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/resiliency/tests/unit/CMakeLists.txt;41;add_hpx_unit_test;/root/repo/libs/core/resiliency/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.resiliency.async_replicate_vote_executor "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/async_replicate_vote_executor_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.resiliency.async_replicate_vote_executor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/resiliency/tests/unit/CMakeLists.txt;41;add_hpx_unit_test;/root/repo/libs/core/resiliency/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.resiliency.async_replicate_vote_plain "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/async_replicate_vote_plain_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.resiliency.async_replicate_vote_plain PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/resiliency/tests/unit/CMakeLists.txt;41;add_hpx_unit_test;/root/repo/libs/core/resiliency/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.resiliency.replay_executor "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/replay_executor_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.resiliency.replay_executor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/resiliency/tests/unit/CMakeLists.txt;41;add_hpx_unit_test;/root/repo/libs/core/resiliency/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.resiliency.replicate_executor "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/replicate_executor_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.resiliency.replicate_executor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/resiliency/tests/unit/CMakeLists.txt;41;add_hpx_unit_test;/root/repo/libs/core/resiliency/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.resiliency.dataflow_replay_executor "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/dataflow_replay_executor_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.resiliency.dataflow_replay_executor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/resiliency/tests/unit/CMakeLists.txt;41;add_hpx_unit_test;/root/repo/libs/core/resiliency/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.resiliency.dataflow_replay_plain "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/dataflow_replay_plain_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.resiliency.dataflow_replay_plain PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/resiliency/tests/unit/CMakeLists.txt;41;add_hpx_unit_test;/root/repo/libs/core/resiliency/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.resiliency.dataflow_replicate_executor "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/dataflow_replicate_executor_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.resiliency.dataflow_replicate_executor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/resiliency/tests/unit/CMakeLists.txt;41;add_hpx_unit_test;/root/repo/libs/core/resiliency/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.resiliency.dataflow_replicate_plain "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/dataflow_replicate_plain_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.resiliency.dataflow_replicate_plain PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/resiliency/tests/unit/CMakeLists.txt;41;add_hpx_unit_test;/root/repo/libs/core/resiliency/tests/unit/CMakeLists.txt;0;")
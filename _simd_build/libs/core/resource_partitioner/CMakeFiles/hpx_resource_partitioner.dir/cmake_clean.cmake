@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_resource_partitioner.a"
+  "../../../lib/libhpx_resource_partitioner.pdb"
+  "CMakeFiles/hpx_resource_partitioner.dir/src/detail_partitioner.cpp.o"
+  "CMakeFiles/hpx_resource_partitioner.dir/src/detail_partitioner.cpp.o.d"
+  "CMakeFiles/hpx_resource_partitioner.dir/src/partitioner.cpp.o"
+  "CMakeFiles/hpx_resource_partitioner.dir/src/partitioner.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_resource_partitioner.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
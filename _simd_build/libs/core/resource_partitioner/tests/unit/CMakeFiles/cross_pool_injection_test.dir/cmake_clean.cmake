@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/cross_pool_injection_test"
+  "../../../../../bin/cross_pool_injection_test.pdb"
+  "CMakeFiles/cross_pool_injection_test.dir/cross_pool_injection.cpp.o"
+  "CMakeFiles/cross_pool_injection_test.dir/cross_pool_injection.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cross_pool_injection_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/named_pool_executor_test"
+  "../../../../../bin/named_pool_executor_test.pdb"
+  "CMakeFiles/named_pool_executor_test.dir/named_pool_executor.cpp.o"
+  "CMakeFiles/named_pool_executor_test.dir/named_pool_executor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/named_pool_executor_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
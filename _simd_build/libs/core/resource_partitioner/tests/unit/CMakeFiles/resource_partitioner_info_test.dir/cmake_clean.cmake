@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/resource_partitioner_info_test"
+  "../../../../../bin/resource_partitioner_info_test.pdb"
+  "CMakeFiles/resource_partitioner_info_test.dir/resource_partitioner_info.cpp.o"
+  "CMakeFiles/resource_partitioner_info_test.dir/resource_partitioner_info.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/resource_partitioner_info_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/scheduler_binding_check_test"
+  "../../../../../bin/scheduler_binding_check_test.pdb"
+  "CMakeFiles/scheduler_binding_check_test.dir/scheduler_binding_check.cpp.o"
+  "CMakeFiles/scheduler_binding_check_test.dir/scheduler_binding_check.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scheduler_binding_check_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/shutdown_suspended_pus_test"
+  "../../../../../bin/shutdown_suspended_pus_test.pdb"
+  "CMakeFiles/shutdown_suspended_pus_test.dir/shutdown_suspended_pus.cpp.o"
+  "CMakeFiles/shutdown_suspended_pus_test.dir/shutdown_suspended_pus.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shutdown_suspended_pus_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
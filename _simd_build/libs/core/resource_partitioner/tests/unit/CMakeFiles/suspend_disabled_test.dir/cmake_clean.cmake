@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/suspend_disabled_test"
+  "../../../../../bin/suspend_disabled_test.pdb"
+  "CMakeFiles/suspend_disabled_test.dir/suspend_disabled.cpp.o"
+  "CMakeFiles/suspend_disabled_test.dir/suspend_disabled.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/suspend_disabled_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
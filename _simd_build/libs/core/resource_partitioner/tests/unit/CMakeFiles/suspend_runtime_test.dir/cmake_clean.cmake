@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/suspend_runtime_test"
+  "../../../../../bin/suspend_runtime_test.pdb"
+  "CMakeFiles/suspend_runtime_test.dir/suspend_runtime.cpp.o"
+  "CMakeFiles/suspend_runtime_test.dir/suspend_runtime.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/suspend_runtime_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
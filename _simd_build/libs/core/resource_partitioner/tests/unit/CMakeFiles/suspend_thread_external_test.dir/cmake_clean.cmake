@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/suspend_thread_external_test"
+  "../../../../../bin/suspend_thread_external_test.pdb"
+  "CMakeFiles/suspend_thread_external_test.dir/suspend_thread_external.cpp.o"
+  "CMakeFiles/suspend_thread_external_test.dir/suspend_thread_external.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/suspend_thread_external_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/used_pus_test"
+  "../../../../../bin/used_pus_test.pdb"
+  "CMakeFiles/used_pus_test.dir/used_pus.cpp.o"
+  "CMakeFiles/used_pus_test.dir/used_pus.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/used_pus_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,32 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/resource_partitioner/tests/unit
+# Build directory: /root/repo/_simd_build/libs/core/resource_partitioner/tests/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tests.unit.modules.resource_partitioner.cross_pool_injection "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/cross_pool_injection_test" "-e" "0" "-t" "-1" "-v" "--")
+set_tests_properties(tests.unit.modules.resource_partitioner.cross_pool_injection PROPERTIES  RUN_SERIAL "TRUE" TIMEOUT "300" _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/resource_partitioner/tests/unit/CMakeLists.txt;55;add_hpx_unit_test;/root/repo/libs/core/resource_partitioner/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.resource_partitioner.named_pool_executor "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/named_pool_executor_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.resource_partitioner.named_pool_executor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/resource_partitioner/tests/unit/CMakeLists.txt;55;add_hpx_unit_test;/root/repo/libs/core/resource_partitioner/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.resource_partitioner.resource_partitioner_info "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/resource_partitioner_info_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.resource_partitioner.resource_partitioner_info PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/resource_partitioner/tests/unit/CMakeLists.txt;55;add_hpx_unit_test;/root/repo/libs/core/resource_partitioner/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.resource_partitioner.scheduler_binding_check "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/scheduler_binding_check_test" "-e" "0" "-t" "-1" "-v" "--")
+set_tests_properties(tests.unit.modules.resource_partitioner.scheduler_binding_check PROPERTIES  RUN_SERIAL "TRUE" _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/resource_partitioner/tests/unit/CMakeLists.txt;55;add_hpx_unit_test;/root/repo/libs/core/resource_partitioner/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.resource_partitioner.scheduler_priority_check "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/scheduler_priority_check_test" "-e" "0" "-t" "-1" "-v" "--")
+set_tests_properties(tests.unit.modules.resource_partitioner.scheduler_priority_check PROPERTIES  RUN_SERIAL "TRUE" _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/resource_partitioner/tests/unit/CMakeLists.txt;55;add_hpx_unit_test;/root/repo/libs/core/resource_partitioner/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.resource_partitioner.shutdown_suspended_pus "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/shutdown_suspended_pus_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.resource_partitioner.shutdown_suspended_pus PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/resource_partitioner/tests/unit/CMakeLists.txt;55;add_hpx_unit_test;/root/repo/libs/core/resource_partitioner/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.resource_partitioner.suspend_disabled "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/suspend_disabled_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.resource_partitioner.suspend_disabled PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/resource_partitioner/tests/unit/CMakeLists.txt;55;add_hpx_unit_test;/root/repo/libs/core/resource_partitioner/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.resource_partitioner.suspend_pool "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/suspend_pool_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.resource_partitioner.suspend_pool PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/resource_partitioner/tests/unit/CMakeLists.txt;55;add_hpx_unit_test;/root/repo/libs/core/resource_partitioner/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.resource_partitioner.suspend_pool_external "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/suspend_pool_external_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.resource_partitioner.suspend_pool_external PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/resource_partitioner/tests/unit/CMakeLists.txt;55;add_hpx_unit_test;/root/repo/libs/core/resource_partitioner/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.resource_partitioner.suspend_runtime "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/suspend_runtime_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.resource_partitioner.suspend_runtime PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/resource_partitioner/tests/unit/CMakeLists.txt;55;add_hpx_unit_test;/root/repo/libs/core/resource_partitioner/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.resource_partitioner.suspend_thread "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/suspend_thread_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.resource_partitioner.suspend_thread PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/resource_partitioner/tests/unit/CMakeLists.txt;55;add_hpx_unit_test;/root/repo/libs/core/resource_partitioner/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.resource_partitioner.suspend_thread_external "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/suspend_thread_external_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.resource_partitioner.suspend_thread_external PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/resource_partitioner/tests/unit/CMakeLists.txt;55;add_hpx_unit_test;/root/repo/libs/core/resource_partitioner/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.resource_partitioner.used_pus "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/used_pus_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.resource_partitioner.used_pus PROPERTIES  RUN_SERIAL "TRUE" _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/resource_partitioner/tests/unit/CMakeLists.txt;55;add_hpx_unit_test;/root/repo/libs/core/resource_partitioner/tests/unit/CMakeLists.txt;0;")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_runtime_configuration.a"
+  "../../../lib/libhpx_runtime_configuration.pdb"
+  "CMakeFiles/hpx_runtime_configuration.dir/src/init_ini_data.cpp.o"
+  "CMakeFiles/hpx_runtime_configuration.dir/src/init_ini_data.cpp.o.d"
+  "CMakeFiles/hpx_runtime_configuration.dir/src/runtime_configuration.cpp.o"
+  "CMakeFiles/hpx_runtime_configuration.dir/src/runtime_configuration.cpp.o.d"
+  "CMakeFiles/hpx_runtime_configuration.dir/src/runtime_mode.cpp.o"
+  "CMakeFiles/hpx_runtime_configuration.dir/src/runtime_mode.cpp.o.d"
+  "CMakeFiles/hpx_runtime_configuration.dir/src/static_factory_data.cpp.o"
+  "CMakeFiles/hpx_runtime_configuration.dir/src/static_factory_data.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_runtime_configuration.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
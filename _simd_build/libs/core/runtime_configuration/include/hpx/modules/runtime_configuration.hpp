@@ -0,0 +1,25 @@
+//  Copyright (c) 2019-2022 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Do not edit this file! It has been generated by the cmake configuration step.
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_MODULE_RUNTIME_CONFIGURATION)
+#include <hpx/runtime_configuration/agas_service_mode.hpp>
+#include <hpx/runtime_configuration/component_commandline_base.hpp>
+#include <hpx/runtime_configuration/component_factory_base.hpp>
+#include <hpx/runtime_configuration/component_registry_base.hpp>
+#include <hpx/runtime_configuration/init_ini_data.hpp>
+#include <hpx/runtime_configuration/plugin_registry_base.hpp>
+#include <hpx/runtime_configuration/runtime_configuration.hpp>
+#include <hpx/runtime_configuration/runtime_configuration_fwd.hpp>
+#include <hpx/runtime_configuration/runtime_mode.hpp>
+#include <hpx/runtime_configuration/static_factory_data.hpp>
+#endif
+
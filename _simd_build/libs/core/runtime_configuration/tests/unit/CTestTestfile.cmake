@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/runtime_configuration/tests/unit
+# Build directory: /root/repo/_simd_build/libs/core/runtime_configuration/tests/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_runtime_local.a"
+  "../../../lib/libhpx_runtime_local.pdb"
+  "CMakeFiles/hpx_runtime_local.dir/src/custom_exception_info.cpp.o"
+  "CMakeFiles/hpx_runtime_local.dir/src/custom_exception_info.cpp.o.d"
+  "CMakeFiles/hpx_runtime_local.dir/src/debugging.cpp.o"
+  "CMakeFiles/hpx_runtime_local.dir/src/debugging.cpp.o.d"
+  "CMakeFiles/hpx_runtime_local.dir/src/get_locality_name.cpp.o"
+  "CMakeFiles/hpx_runtime_local.dir/src/get_locality_name.cpp.o.d"
+  "CMakeFiles/hpx_runtime_local.dir/src/interval_timer.cpp.o"
+  "CMakeFiles/hpx_runtime_local.dir/src/interval_timer.cpp.o.d"
+  "CMakeFiles/hpx_runtime_local.dir/src/os_thread_type.cpp.o"
+  "CMakeFiles/hpx_runtime_local.dir/src/os_thread_type.cpp.o.d"
+  "CMakeFiles/hpx_runtime_local.dir/src/pool_timer.cpp.o"
+  "CMakeFiles/hpx_runtime_local.dir/src/pool_timer.cpp.o.d"
+  "CMakeFiles/hpx_runtime_local.dir/src/runtime_handlers.cpp.o"
+  "CMakeFiles/hpx_runtime_local.dir/src/runtime_handlers.cpp.o.d"
+  "CMakeFiles/hpx_runtime_local.dir/src/runtime_local.cpp.o"
+  "CMakeFiles/hpx_runtime_local.dir/src/runtime_local.cpp.o.d"
+  "CMakeFiles/hpx_runtime_local.dir/src/serialize_exception.cpp.o"
+  "CMakeFiles/hpx_runtime_local.dir/src/serialize_exception.cpp.o.d"
+  "CMakeFiles/hpx_runtime_local.dir/src/state.cpp.o"
+  "CMakeFiles/hpx_runtime_local.dir/src/state.cpp.o.d"
+  "CMakeFiles/hpx_runtime_local.dir/src/thread_mapper.cpp.o"
+  "CMakeFiles/hpx_runtime_local.dir/src/thread_mapper.cpp.o.d"
+  "CMakeFiles/hpx_runtime_local.dir/src/thread_pool_helpers.cpp.o"
+  "CMakeFiles/hpx_runtime_local.dir/src/thread_pool_helpers.cpp.o.d"
+  "CMakeFiles/hpx_runtime_local.dir/src/thread_stacktrace.cpp.o"
+  "CMakeFiles/hpx_runtime_local.dir/src/thread_stacktrace.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_runtime_local.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,42 @@
+//  Copyright (c) 2019-2022 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Do not edit this file! It has been generated by the cmake configuration step.
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_MODULE_RUNTIME_LOCAL)
+#include <hpx/runtime_local/component_startup_shutdown_base.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/runtime_local/custom_exception_info.hpp>
+#include <hpx/runtime_local/debugging.hpp>
+#include <hpx/runtime_local/get_locality_id.hpp>
+#include <hpx/runtime_local/get_locality_name.hpp>
+#include <hpx/runtime_local/get_num_all_localities.hpp>
+#include <hpx/runtime_local/get_os_thread_count.hpp>
+#include <hpx/runtime_local/get_thread_name.hpp>
+#include <hpx/runtime_local/get_worker_thread_num.hpp>
+#include <hpx/runtime_local/interval_timer.hpp>
+#include <hpx/runtime_local/os_thread_type.hpp>
+#include <hpx/runtime_local/pool_timer.hpp>
+#include <hpx/runtime_local/report_error.hpp>
+#include <hpx/runtime_local/run_as_hpx_thread.hpp>
+#include <hpx/runtime_local/run_as_os_thread.hpp>
+#include <hpx/runtime_local/runtime_handlers.hpp>
+#include <hpx/runtime_local/runtime_local.hpp>
+#include <hpx/runtime_local/runtime_local_fwd.hpp>
+#include <hpx/runtime_local/service_executors.hpp>
+#include <hpx/runtime_local/state.hpp>
+#include <hpx/runtime_local/shutdown_function.hpp>
+#include <hpx/runtime_local/startup_function.hpp>
+#include <hpx/runtime_local/thread_hooks.hpp>
+#include <hpx/runtime_local/thread_mapper.hpp>
+#include <hpx/runtime_local/thread_pool_helpers.hpp>
+#include <hpx/runtime_local/thread_stacktrace.hpp>
+#endif
+
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/thread_mapper_test"
+  "../../../../../bin/thread_mapper_test.pdb"
+  "CMakeFiles/thread_mapper_test.dir/thread_mapper.cpp.o"
+  "CMakeFiles/thread_mapper_test.dir/thread_mapper.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/thread_mapper_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
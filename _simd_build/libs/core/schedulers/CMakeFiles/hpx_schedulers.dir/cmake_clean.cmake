@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_schedulers.a"
+  "../../../lib/libhpx_schedulers.pdb"
+  "CMakeFiles/hpx_schedulers.dir/src/deadlock_detection.cpp.o"
+  "CMakeFiles/hpx_schedulers.dir/src/deadlock_detection.cpp.o.d"
+  "CMakeFiles/hpx_schedulers.dir/src/maintain_queue_wait_times.cpp.o"
+  "CMakeFiles/hpx_schedulers.dir/src/maintain_queue_wait_times.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_schedulers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
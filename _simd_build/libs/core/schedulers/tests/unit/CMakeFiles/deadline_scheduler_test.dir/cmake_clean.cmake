@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/deadline_scheduler_test"
+  "../../../../../bin/deadline_scheduler_test.pdb"
+  "CMakeFiles/deadline_scheduler_test.dir/deadline_scheduler.cpp.o"
+  "CMakeFiles/deadline_scheduler_test.dir/deadline_scheduler.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/deadline_scheduler_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/schedule_last_test"
+  "../../../../../bin/schedule_last_test.pdb"
+  "CMakeFiles/schedule_last_test.dir/schedule_last.cpp.o"
+  "CMakeFiles/schedule_last_test.dir/schedule_last.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/schedule_last_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/steal_attempts_test"
+  "../../../../../bin/steal_attempts_test.pdb"
+  "CMakeFiles/steal_attempts_test.dir/steal_attempts.cpp.o"
+  "CMakeFiles/steal_attempts_test.dir/steal_attempts.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/steal_attempts_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
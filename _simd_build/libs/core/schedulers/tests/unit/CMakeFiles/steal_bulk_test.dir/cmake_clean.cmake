@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/steal_bulk_test"
+  "../../../../../bin/steal_bulk_test.pdb"
+  "CMakeFiles/steal_bulk_test.dir/steal_bulk.cpp.o"
+  "CMakeFiles/steal_bulk_test.dir/steal_bulk.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/steal_bulk_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/schedulers/tests/unit
+# Build directory: /root/repo/_simd_build/libs/core/schedulers/tests/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tests.unit.modules.schedulers.deadline_scheduler "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/deadline_scheduler_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.schedulers.deadline_scheduler PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/schedulers/tests/unit/CMakeLists.txt;27;add_hpx_unit_test;/root/repo/libs/core/schedulers/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.schedulers.schedule_last "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/schedule_last_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.schedulers.schedule_last PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/schedulers/tests/unit/CMakeLists.txt;27;add_hpx_unit_test;/root/repo/libs/core/schedulers/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.schedulers.steal_attempts "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/steal_attempts_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.schedulers.steal_attempts PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/schedulers/tests/unit/CMakeLists.txt;27;add_hpx_unit_test;/root/repo/libs/core/schedulers/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.schedulers.steal_bulk "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/steal_bulk_test" "-e" "0" "-t" "4" "-v" "--")
+set_tests_properties(tests.unit.modules.schedulers.steal_bulk PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/schedulers/tests/unit/CMakeLists.txt;27;add_hpx_unit_test;/root/repo/libs/core/schedulers/tests/unit/CMakeLists.txt;0;")
@@ -0,0 +1,38 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_simd_build/libs/core/serialization/src/config_entries.cpp" "libs/core/serialization/CMakeFiles/hpx_serialization.dir/src/config_entries.cpp.o" "gcc" "libs/core/serialization/CMakeFiles/hpx_serialization.dir/src/config_entries.cpp.o.d"
+  "/root/repo/libs/core/serialization/src/detail/pointer.cpp" "libs/core/serialization/CMakeFiles/hpx_serialization.dir/src/detail/pointer.cpp.o" "gcc" "libs/core/serialization/CMakeFiles/hpx_serialization.dir/src/detail/pointer.cpp.o.d"
+  "/root/repo/libs/core/serialization/src/detail/polymorphic_id_factory.cpp" "libs/core/serialization/CMakeFiles/hpx_serialization.dir/src/detail/polymorphic_id_factory.cpp.o" "gcc" "libs/core/serialization/CMakeFiles/hpx_serialization.dir/src/detail/polymorphic_id_factory.cpp.o.d"
+  "/root/repo/libs/core/serialization/src/detail/polymorphic_intrusive_factory.cpp" "libs/core/serialization/CMakeFiles/hpx_serialization.dir/src/detail/polymorphic_intrusive_factory.cpp.o" "gcc" "libs/core/serialization/CMakeFiles/hpx_serialization.dir/src/detail/polymorphic_intrusive_factory.cpp.o.d"
+  "/root/repo/libs/core/serialization/src/detail/polymorphic_nonintrusive_factory.cpp" "libs/core/serialization/CMakeFiles/hpx_serialization.dir/src/detail/polymorphic_nonintrusive_factory.cpp.o" "gcc" "libs/core/serialization/CMakeFiles/hpx_serialization.dir/src/detail/polymorphic_nonintrusive_factory.cpp.o.d"
+  "/root/repo/libs/core/serialization/src/exception_ptr.cpp" "libs/core/serialization/CMakeFiles/hpx_serialization.dir/src/exception_ptr.cpp.o" "gcc" "libs/core/serialization/CMakeFiles/hpx_serialization.dir/src/exception_ptr.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_simd_build/libs/core/assertion/CMakeFiles/hpx_assertion.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/config/CMakeFiles/hpx_config.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/debugging/CMakeFiles/hpx_debugging.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/errors/CMakeFiles/hpx_errors.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/format/CMakeFiles/hpx_format.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/preprocessor/CMakeFiles/hpx_preprocessor.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/type_support/CMakeFiles/hpx_type_support.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/config_registry/CMakeFiles/hpx_config_registry.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/logging/CMakeFiles/hpx_logging.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/filesystem/CMakeFiles/hpx_filesystem.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/timing/CMakeFiles/hpx_timing.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/hardware/CMakeFiles/hpx_hardware.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/thread_support/CMakeFiles/hpx_thread_support.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/libs/core/concepts/CMakeFiles/hpx_concepts.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_serialization.a"
+  "../../../lib/libhpx_serialization.pdb"
+  "CMakeFiles/hpx_serialization.dir/src/config_entries.cpp.o"
+  "CMakeFiles/hpx_serialization.dir/src/config_entries.cpp.o.d"
+  "CMakeFiles/hpx_serialization.dir/src/detail/pointer.cpp.o"
+  "CMakeFiles/hpx_serialization.dir/src/detail/pointer.cpp.o.d"
+  "CMakeFiles/hpx_serialization.dir/src/detail/polymorphic_id_factory.cpp.o"
+  "CMakeFiles/hpx_serialization.dir/src/detail/polymorphic_id_factory.cpp.o.d"
+  "CMakeFiles/hpx_serialization.dir/src/detail/polymorphic_intrusive_factory.cpp.o"
+  "CMakeFiles/hpx_serialization.dir/src/detail/polymorphic_intrusive_factory.cpp.o.d"
+  "CMakeFiles/hpx_serialization.dir/src/detail/polymorphic_nonintrusive_factory.cpp.o"
+  "CMakeFiles/hpx_serialization.dir/src/detail/polymorphic_nonintrusive_factory.cpp.o.d"
+  "CMakeFiles/hpx_serialization.dir/src/exception_ptr.cpp.o"
+  "CMakeFiles/hpx_serialization.dir/src/exception_ptr.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_serialization.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/not_bitwise_serializable_test"
+  "../../../../../bin/not_bitwise_serializable_test.pdb"
+  "CMakeFiles/not_bitwise_serializable_test.dir/not_bitwise_serializable.cpp.o"
+  "CMakeFiles/not_bitwise_serializable_test.dir/not_bitwise_serializable.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/not_bitwise_serializable_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/serialization_array_test"
+  "../../../../../bin/serialization_array_test.pdb"
+  "CMakeFiles/serialization_array_test.dir/serialization_array.cpp.o"
+  "CMakeFiles/serialization_array_test.dir/serialization_array.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/serialization_array_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/serialization_brace_initializable_test"
+  "../../../../../bin/serialization_brace_initializable_test.pdb"
+  "CMakeFiles/serialization_brace_initializable_test.dir/serialization_brace_initializable.cpp.o"
+  "CMakeFiles/serialization_brace_initializable_test.dir/serialization_brace_initializable.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/serialization_brace_initializable_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
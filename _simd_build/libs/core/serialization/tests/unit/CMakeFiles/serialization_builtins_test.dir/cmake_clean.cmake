@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/serialization_builtins_test"
+  "../../../../../bin/serialization_builtins_test.pdb"
+  "CMakeFiles/serialization_builtins_test.dir/serialization_builtins.cpp.o"
+  "CMakeFiles/serialization_builtins_test.dir/serialization_builtins.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/serialization_builtins_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/serialization_complex_test"
+  "../../../../../bin/serialization_complex_test.pdb"
+  "CMakeFiles/serialization_complex_test.dir/serialization_complex.cpp.o"
+  "CMakeFiles/serialization_complex_test.dir/serialization_complex.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/serialization_complex_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
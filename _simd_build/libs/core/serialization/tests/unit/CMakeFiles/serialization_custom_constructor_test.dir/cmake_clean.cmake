@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/serialization_custom_constructor_test"
+  "../../../../../bin/serialization_custom_constructor_test.pdb"
+  "CMakeFiles/serialization_custom_constructor_test.dir/serialization_custom_constructor.cpp.o"
+  "CMakeFiles/serialization_custom_constructor_test.dir/serialization_custom_constructor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/serialization_custom_constructor_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
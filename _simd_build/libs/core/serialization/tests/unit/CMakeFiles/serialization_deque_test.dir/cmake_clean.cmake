@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/serialization_deque_test"
+  "../../../../../bin/serialization_deque_test.pdb"
+  "CMakeFiles/serialization_deque_test.dir/serialization_deque.cpp.o"
+  "CMakeFiles/serialization_deque_test.dir/serialization_deque.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/serialization_deque_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
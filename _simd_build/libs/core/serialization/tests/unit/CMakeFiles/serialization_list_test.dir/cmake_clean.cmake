@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/serialization_list_test"
+  "../../../../../bin/serialization_list_test.pdb"
+  "CMakeFiles/serialization_list_test.dir/serialization_list.cpp.o"
+  "CMakeFiles/serialization_list_test.dir/serialization_list.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/serialization_list_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/serialization_raw_pointer_test"
+  "../../../../../bin/serialization_raw_pointer_test.pdb"
+  "CMakeFiles/serialization_raw_pointer_test.dir/serialization_raw_pointer.cpp.o"
+  "CMakeFiles/serialization_raw_pointer_test.dir/serialization_raw_pointer.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/serialization_raw_pointer_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/serialization_set_test"
+  "../../../../../bin/serialization_set_test.pdb"
+  "CMakeFiles/serialization_set_test.dir/serialization_set.cpp.o"
+  "CMakeFiles/serialization_set_test.dir/serialization_set.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/serialization_set_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
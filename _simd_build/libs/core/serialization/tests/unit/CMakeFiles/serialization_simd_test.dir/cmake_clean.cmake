@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/serialization_simd_test"
+  "../../../../../bin/serialization_simd_test.pdb"
+  "CMakeFiles/serialization_simd_test.dir/serialization_simd.cpp.o"
+  "CMakeFiles/serialization_simd_test.dir/serialization_simd.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/serialization_simd_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
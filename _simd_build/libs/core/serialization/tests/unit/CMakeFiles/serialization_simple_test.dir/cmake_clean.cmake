@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/serialization_simple_test"
+  "../../../../../bin/serialization_simple_test.pdb"
+  "CMakeFiles/serialization_simple_test.dir/serialization_simple.cpp.o"
+  "CMakeFiles/serialization_simple_test.dir/serialization_simple.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/serialization_simple_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/serialization_smart_ptr_test"
+  "../../../../../bin/serialization_smart_ptr_test.pdb"
+  "CMakeFiles/serialization_smart_ptr_test.dir/serialization_smart_ptr.cpp.o"
+  "CMakeFiles/serialization_smart_ptr_test.dir/serialization_smart_ptr.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/serialization_smart_ptr_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/serialization_std_tuple_test"
+  "../../../../../bin/serialization_std_tuple_test.pdb"
+  "CMakeFiles/serialization_std_tuple_test.dir/serialization_std_tuple.cpp.o"
+  "CMakeFiles/serialization_std_tuple_test.dir/serialization_std_tuple.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/serialization_std_tuple_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
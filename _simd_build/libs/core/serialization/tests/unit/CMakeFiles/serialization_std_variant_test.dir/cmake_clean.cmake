@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/serialization_std_variant_test"
+  "../../../../../bin/serialization_std_variant_test.pdb"
+  "CMakeFiles/serialization_std_variant_test.dir/serialization_std_variant.cpp.o"
+  "CMakeFiles/serialization_std_variant_test.dir/serialization_std_variant.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/serialization_std_variant_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
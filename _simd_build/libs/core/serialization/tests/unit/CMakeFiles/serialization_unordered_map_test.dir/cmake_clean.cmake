@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/serialization_unordered_map_test"
+  "../../../../../bin/serialization_unordered_map_test.pdb"
+  "CMakeFiles/serialization_unordered_map_test.dir/serialization_unordered_map.cpp.o"
+  "CMakeFiles/serialization_unordered_map_test.dir/serialization_unordered_map.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/serialization_unordered_map_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/serialization_valarray_test"
+  "../../../../../bin/serialization_valarray_test.pdb"
+  "CMakeFiles/serialization_valarray_test.dir/serialization_valarray.cpp.o"
+  "CMakeFiles/serialization_valarray_test.dir/serialization_valarray.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/serialization_valarray_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
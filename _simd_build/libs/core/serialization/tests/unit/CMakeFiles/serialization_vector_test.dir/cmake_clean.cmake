@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/serialization_vector_test"
+  "../../../../../bin/serialization_vector_test.pdb"
+  "CMakeFiles/serialization_vector_test.dir/serialization_vector.cpp.o"
+  "CMakeFiles/serialization_vector_test.dir/serialization_vector.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/serialization_vector_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
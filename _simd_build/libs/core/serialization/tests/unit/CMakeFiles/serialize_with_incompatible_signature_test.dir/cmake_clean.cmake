@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/serialize_with_incompatible_signature_test"
+  "../../../../../bin/serialize_with_incompatible_signature_test.pdb"
+  "CMakeFiles/serialize_with_incompatible_signature_test.dir/serialize_with_incompatible_signature.cpp.o"
+  "CMakeFiles/serialize_with_incompatible_signature_test.dir/serialize_with_incompatible_signature.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/serialize_with_incompatible_signature_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
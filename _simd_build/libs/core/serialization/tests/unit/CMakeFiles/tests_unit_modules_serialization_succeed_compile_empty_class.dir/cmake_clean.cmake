@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/tests_unit_modules_serialization_succeed_compile_empty_class"
+  "../../../../../bin/tests_unit_modules_serialization_succeed_compile_empty_class.pdb"
+  "CMakeFiles/tests_unit_modules_serialization_succeed_compile_empty_class.dir/succeed_compile_empty_class.cpp.o"
+  "CMakeFiles/tests_unit_modules_serialization_succeed_compile_empty_class.dir/succeed_compile_empty_class.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests_unit_modules_serialization_succeed_compile_empty_class.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
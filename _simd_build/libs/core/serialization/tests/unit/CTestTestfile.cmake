@@ -0,0 +1,49 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/serialization/tests/unit
+# Build directory: /root/repo/_simd_build/libs/core/serialization/tests/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tests.unit.modules.serialization.not_bitwise_serializable "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/not_bitwise_serializable_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.serialization.not_bitwise_serializable PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;59;add_hpx_unit_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.serialization.serialization_array "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/serialization_array_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.serialization.serialization_array PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;59;add_hpx_unit_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.serialization.serialization_brace_initializable "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/serialization_brace_initializable_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.serialization.serialization_brace_initializable PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;59;add_hpx_unit_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.serialization.serialization_valarray "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/serialization_valarray_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.serialization.serialization_valarray PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;59;add_hpx_unit_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.serialization.serialization_builtins "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/serialization_builtins_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.serialization.serialization_builtins PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;59;add_hpx_unit_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.serialization.serialization_complex "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/serialization_complex_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.serialization.serialization_complex PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;59;add_hpx_unit_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.serialization.serialization_custom_constructor "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/serialization_custom_constructor_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.serialization.serialization_custom_constructor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;59;add_hpx_unit_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.serialization.serialization_deque "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/serialization_deque_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.serialization.serialization_deque PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;59;add_hpx_unit_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.serialization.serialization_list "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/serialization_list_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.serialization.serialization_list PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;59;add_hpx_unit_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.serialization.serialization_map "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/serialization_map_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.serialization.serialization_map PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;59;add_hpx_unit_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.serialization.serialization_set "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/serialization_set_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.serialization.serialization_set PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;59;add_hpx_unit_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.serialization.serialization_simple "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/serialization_simple_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.serialization.serialization_simple PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;59;add_hpx_unit_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.serialization.serialization_smart_ptr "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/serialization_smart_ptr_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.serialization.serialization_smart_ptr PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;59;add_hpx_unit_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.serialization.serialization_std_tuple "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/serialization_std_tuple_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.serialization.serialization_std_tuple PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;59;add_hpx_unit_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.serialization.serialization_unordered_map "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/serialization_unordered_map_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.serialization.serialization_unordered_map PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;59;add_hpx_unit_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.serialization.serialization_vector "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/serialization_vector_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.serialization.serialization_vector PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;59;add_hpx_unit_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.serialization.serialize_with_incompatible_signature "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/serialize_with_incompatible_signature_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.serialization.serialize_with_incompatible_signature PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;59;add_hpx_unit_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.serialization.serialization_std_variant "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/serialization_std_variant_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.serialization.serialization_std_variant PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;59;add_hpx_unit_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.serialization.serialization_simd "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/serialization_simd_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.serialization.serialization_simd PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;59;add_hpx_unit_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.serialization.serialization_raw_pointer "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/serialization_raw_pointer_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.serialization.serialization_raw_pointer PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;80;add_hpx_unit_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.serialization.succeed_compile_empty_class "/usr/bin/cmake" "--build" "/root/repo/_simd_build" "--target" "tests_unit_modules_serialization_succeed_compile_empty_class" "--config" "Release")
+set_tests_properties(tests.unit.modules.serialization.succeed_compile_empty_class PROPERTIES  RUN_SERIAL "TRUE" WORKING_DIRECTORY "/root/repo/_simd_build" _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddCompileTest.cmake;48;add_test;/root/repo/cmake/HPX_AddCompileTest.cmake;74;add_hpx_compile_test;/root/repo/cmake/HPX_AddCompileTest.cmake;82;add_test_and_deps_compile_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;102;add_hpx_unit_compile_test;/root/repo/libs/core/serialization/tests/unit/CMakeLists.txt;0;")
+subdirs("polymorphic")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/polymorphic_nonintrusive_abstract_test"
+  "../../../../../../bin/polymorphic_nonintrusive_abstract_test.pdb"
+  "CMakeFiles/polymorphic_nonintrusive_abstract_test.dir/polymorphic_nonintrusive_abstract.cpp.o"
+  "CMakeFiles/polymorphic_nonintrusive_abstract_test.dir/polymorphic_nonintrusive_abstract.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/polymorphic_nonintrusive_abstract_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs/core/serialization/tests/unit/polymorphic/polymorphic_nonintrusive.cpp" "libs/core/serialization/tests/unit/polymorphic/CMakeFiles/polymorphic_nonintrusive_test.dir/polymorphic_nonintrusive.cpp.o" "gcc" "libs/core/serialization/tests/unit/polymorphic/CMakeFiles/polymorphic_nonintrusive_test.dir/polymorphic_nonintrusive.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_simd_build/libs/CMakeFiles/hpx_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
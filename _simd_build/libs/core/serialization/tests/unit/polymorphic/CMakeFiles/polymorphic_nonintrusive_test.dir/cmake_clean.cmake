@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/polymorphic_nonintrusive_test"
+  "../../../../../../bin/polymorphic_nonintrusive_test.pdb"
+  "CMakeFiles/polymorphic_nonintrusive_test.dir/polymorphic_nonintrusive.cpp.o"
+  "CMakeFiles/polymorphic_nonintrusive_test.dir/polymorphic_nonintrusive.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/polymorphic_nonintrusive_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
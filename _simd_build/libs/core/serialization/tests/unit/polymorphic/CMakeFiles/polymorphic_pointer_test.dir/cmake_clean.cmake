@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/polymorphic_pointer_test"
+  "../../../../../../bin/polymorphic_pointer_test.pdb"
+  "CMakeFiles/polymorphic_pointer_test.dir/polymorphic_pointer.cpp.o"
+  "CMakeFiles/polymorphic_pointer_test.dir/polymorphic_pointer.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/polymorphic_pointer_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/polymorphic_reference_test"
+  "../../../../../../bin/polymorphic_reference_test.pdb"
+  "CMakeFiles/polymorphic_reference_test.dir/polymorphic_reference.cpp.o"
+  "CMakeFiles/polymorphic_reference_test.dir/polymorphic_reference.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/polymorphic_reference_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
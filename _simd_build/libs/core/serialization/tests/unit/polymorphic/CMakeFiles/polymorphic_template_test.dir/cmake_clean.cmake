@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/polymorphic_template_test"
+  "../../../../../../bin/polymorphic_template_test.pdb"
+  "CMakeFiles/polymorphic_template_test.dir/polymorphic_template.cpp.o"
+  "CMakeFiles/polymorphic_template_test.dir/polymorphic_template.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/polymorphic_template_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/smart_ptr_polymorphic_nonintrusive_test"
+  "../../../../../../bin/smart_ptr_polymorphic_nonintrusive_test.pdb"
+  "CMakeFiles/smart_ptr_polymorphic_nonintrusive_test.dir/smart_ptr_polymorphic_nonintrusive.cpp.o"
+  "CMakeFiles/smart_ptr_polymorphic_nonintrusive_test.dir/smart_ptr_polymorphic_nonintrusive.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/smart_ptr_polymorphic_nonintrusive_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../bin/smart_ptr_polymorphic_test"
+  "../../../../../../bin/smart_ptr_polymorphic_test.pdb"
+  "CMakeFiles/smart_ptr_polymorphic_test.dir/smart_ptr_polymorphic.cpp.o"
+  "CMakeFiles/smart_ptr_polymorphic_test.dir/smart_ptr_polymorphic.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/smart_ptr_polymorphic_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
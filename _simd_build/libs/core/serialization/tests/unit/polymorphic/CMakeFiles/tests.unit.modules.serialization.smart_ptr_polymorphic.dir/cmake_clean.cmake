@@ -0,0 +1,5 @@
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/tests.unit.modules.serialization.smart_ptr_polymorphic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/serialization/tests/unit/polymorphic
+# Build directory: /root/repo/_simd_build/libs/core/serialization/tests/unit/polymorphic
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tests.unit.modules.serialization.polymorphic_reference "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/polymorphic_reference_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.serialization.polymorphic_reference PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/serialization/tests/unit/polymorphic/CMakeLists.txt;32;add_hpx_unit_test;/root/repo/libs/core/serialization/tests/unit/polymorphic/CMakeLists.txt;0;")
+add_test(tests.unit.modules.serialization.polymorphic_pointer "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/polymorphic_pointer_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.serialization.polymorphic_pointer PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/serialization/tests/unit/polymorphic/CMakeLists.txt;32;add_hpx_unit_test;/root/repo/libs/core/serialization/tests/unit/polymorphic/CMakeLists.txt;0;")
+add_test(tests.unit.modules.serialization.polymorphic_nonintrusive "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/polymorphic_nonintrusive_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.serialization.polymorphic_nonintrusive PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/serialization/tests/unit/polymorphic/CMakeLists.txt;32;add_hpx_unit_test;/root/repo/libs/core/serialization/tests/unit/polymorphic/CMakeLists.txt;0;")
+add_test(tests.unit.modules.serialization.polymorphic_nonintrusive_abstract "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/polymorphic_nonintrusive_abstract_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.serialization.polymorphic_nonintrusive_abstract PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/serialization/tests/unit/polymorphic/CMakeLists.txt;32;add_hpx_unit_test;/root/repo/libs/core/serialization/tests/unit/polymorphic/CMakeLists.txt;0;")
+add_test(tests.unit.modules.serialization.polymorphic_semiintrusive_template "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/polymorphic_semiintrusive_template_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.serialization.polymorphic_semiintrusive_template PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/serialization/tests/unit/polymorphic/CMakeLists.txt;32;add_hpx_unit_test;/root/repo/libs/core/serialization/tests/unit/polymorphic/CMakeLists.txt;0;")
+add_test(tests.unit.modules.serialization.polymorphic_template "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/polymorphic_template_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.serialization.polymorphic_template PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/serialization/tests/unit/polymorphic/CMakeLists.txt;32;add_hpx_unit_test;/root/repo/libs/core/serialization/tests/unit/polymorphic/CMakeLists.txt;0;")
+add_test(tests.unit.modules.serialization.smart_ptr_polymorphic "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/smart_ptr_polymorphic_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.serialization.smart_ptr_polymorphic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/serialization/tests/unit/polymorphic/CMakeLists.txt;32;add_hpx_unit_test;/root/repo/libs/core/serialization/tests/unit/polymorphic/CMakeLists.txt;0;")
+add_test(tests.unit.modules.serialization.smart_ptr_polymorphic_nonintrusive "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/smart_ptr_polymorphic_nonintrusive_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.serialization.smart_ptr_polymorphic_nonintrusive PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/serialization/tests/unit/polymorphic/CMakeLists.txt;32;add_hpx_unit_test;/root/repo/libs/core/serialization/tests/unit/polymorphic/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_static_reinit.a"
+  "../../../lib/libhpx_static_reinit.pdb"
+  "CMakeFiles/hpx_static_reinit.dir/src/static_reinit.cpp.o"
+  "CMakeFiles/hpx_static_reinit.dir/src/static_reinit.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_static_reinit.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
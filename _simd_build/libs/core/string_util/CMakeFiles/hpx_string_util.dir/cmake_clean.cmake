@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_string_util.a"
+  "../../../lib/libhpx_string_util.pdb"
+  "CMakeFiles/hpx_string_util.dir/__/__/src/empty.cpp.o"
+  "CMakeFiles/hpx_string_util.dir/__/__/src/empty.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_string_util.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/string_split_test"
+  "../../../../../bin/string_split_test.pdb"
+  "CMakeFiles/string_split_test.dir/string_split.cpp.o"
+  "CMakeFiles/string_split_test.dir/string_split.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/string_split_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/string_to_lower_test"
+  "../../../../../bin/string_to_lower_test.pdb"
+  "CMakeFiles/string_to_lower_test.dir/string_to_lower.cpp.o"
+  "CMakeFiles/string_to_lower_test.dir/string_to_lower.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/string_to_lower_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/string_trim_test"
+  "../../../../../bin/string_trim_test.pdb"
+  "CMakeFiles/string_trim_test.dir/string_trim.cpp.o"
+  "CMakeFiles/string_trim_test.dir/string_trim.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/string_trim_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/core/string_util/tests/unit
+# Build directory: /root/repo/_simd_build/libs/core/string_util/tests/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tests.unit.modules.string_util.string_to_lower "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/string_to_lower_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.string_util.string_to_lower PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/string_util/tests/unit/CMakeLists.txt;24;add_hpx_unit_test;/root/repo/libs/core/string_util/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.string_util.string_split "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/string_split_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.string_util.string_split PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/string_util/tests/unit/CMakeLists.txt;24;add_hpx_unit_test;/root/repo/libs/core/string_util/tests/unit/CMakeLists.txt;0;")
+add_test(tests.unit.modules.string_util.string_trim "/root/.pyenv/shims/python" "/root/repo/_simd_build/bin/hpxrun.py" "/root/repo/_simd_build/bin/string_trim_test" "-e" "0" "-t" "1" "-v" "--")
+set_tests_properties(tests.unit.modules.string_util.string_trim PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/HPX_AddTest.cmake;117;add_test;/root/repo/cmake/HPX_AddTest.cmake;230;add_hpx_test;/root/repo/cmake/HPX_AddTest.cmake;238;add_test_and_deps_test;/root/repo/libs/core/string_util/tests/unit/CMakeLists.txt;24;add_hpx_unit_test;/root/repo/libs/core/string_util/tests/unit/CMakeLists.txt;0;")
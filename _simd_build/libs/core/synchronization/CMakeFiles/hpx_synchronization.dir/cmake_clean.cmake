@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "../../../lib/libhpx_synchronization.a"
+  "../../../lib/libhpx_synchronization.pdb"
+  "CMakeFiles/hpx_synchronization.dir/src/detail/condition_variable.cpp.o"
+  "CMakeFiles/hpx_synchronization.dir/src/detail/condition_variable.cpp.o.d"
+  "CMakeFiles/hpx_synchronization.dir/src/detail/counting_semaphore.cpp.o"
+  "CMakeFiles/hpx_synchronization.dir/src/detail/counting_semaphore.cpp.o.d"
+  "CMakeFiles/hpx_synchronization.dir/src/detail/sliding_semaphore.cpp.o"
+  "CMakeFiles/hpx_synchronization.dir/src/detail/sliding_semaphore.cpp.o.d"
+  "CMakeFiles/hpx_synchronization.dir/src/local_barrier.cpp.o"
+  "CMakeFiles/hpx_synchronization.dir/src/local_barrier.cpp.o.d"
+  "CMakeFiles/hpx_synchronization.dir/src/mutex.cpp.o"
+  "CMakeFiles/hpx_synchronization.dir/src/mutex.cpp.o.d"
+  "CMakeFiles/hpx_synchronization.dir/src/stop_token.cpp.o"
+  "CMakeFiles/hpx_synchronization.dir/src/stop_token.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpx_synchronization.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
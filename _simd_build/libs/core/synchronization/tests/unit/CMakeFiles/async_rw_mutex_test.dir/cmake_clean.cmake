@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/async_rw_mutex_test"
+  "../../../../../bin/async_rw_mutex_test.pdb"
+  "CMakeFiles/async_rw_mutex_test.dir/async_rw_mutex.cpp.o"
+  "CMakeFiles/async_rw_mutex_test.dir/async_rw_mutex.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/async_rw_mutex_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
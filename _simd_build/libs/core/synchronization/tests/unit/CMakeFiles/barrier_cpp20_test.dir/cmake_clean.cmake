@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/barrier_cpp20_test"
+  "../../../../../bin/barrier_cpp20_test.pdb"
+  "CMakeFiles/barrier_cpp20_test.dir/barrier_cpp20.cpp.o"
+  "CMakeFiles/barrier_cpp20_test.dir/barrier_cpp20.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/barrier_cpp20_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
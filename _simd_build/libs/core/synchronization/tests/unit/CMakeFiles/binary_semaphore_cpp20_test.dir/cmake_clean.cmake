@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/binary_semaphore_cpp20_test"
+  "../../../../../bin/binary_semaphore_cpp20_test.pdb"
+  "CMakeFiles/binary_semaphore_cpp20_test.dir/binary_semaphore_cpp20.cpp.o"
+  "CMakeFiles/binary_semaphore_cpp20_test.dir/binary_semaphore_cpp20.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/binary_semaphore_cpp20_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/channel_mpmc_fib_test"
+  "../../../../../bin/channel_mpmc_fib_test.pdb"
+  "CMakeFiles/channel_mpmc_fib_test.dir/channel_mpmc_fib.cpp.o"
+  "CMakeFiles/channel_mpmc_fib_test.dir/channel_mpmc_fib.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/channel_mpmc_fib_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/condition_variable_test"
+  "../../../../../bin/condition_variable_test.pdb"
+  "CMakeFiles/condition_variable_test.dir/condition_variable.cpp.o"
+  "CMakeFiles/condition_variable_test.dir/condition_variable.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/condition_variable_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/counting_semaphore_cpp20_test"
+  "../../../../../bin/counting_semaphore_cpp20_test.pdb"
+  "CMakeFiles/counting_semaphore_cpp20_test.dir/counting_semaphore_cpp20.cpp.o"
+  "CMakeFiles/counting_semaphore_cpp20_test.dir/counting_semaphore_cpp20.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/counting_semaphore_cpp20_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
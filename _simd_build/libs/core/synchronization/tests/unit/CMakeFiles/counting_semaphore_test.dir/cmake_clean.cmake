@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/counting_semaphore_test"
+  "../../../../../bin/counting_semaphore_test.pdb"
+  "CMakeFiles/counting_semaphore_test.dir/counting_semaphore.cpp.o"
+  "CMakeFiles/counting_semaphore_test.dir/counting_semaphore.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/counting_semaphore_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
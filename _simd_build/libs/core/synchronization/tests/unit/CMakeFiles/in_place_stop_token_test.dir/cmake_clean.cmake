@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/in_place_stop_token_test"
+  "../../../../../bin/in_place_stop_token_test.pdb"
+  "CMakeFiles/in_place_stop_token_test.dir/in_place_stop_token.cpp.o"
+  "CMakeFiles/in_place_stop_token_test.dir/in_place_stop_token.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/in_place_stop_token_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
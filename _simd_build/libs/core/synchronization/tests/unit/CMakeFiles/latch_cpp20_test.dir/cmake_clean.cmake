@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/latch_cpp20_test"
+  "../../../../../bin/latch_cpp20_test.pdb"
+  "CMakeFiles/latch_cpp20_test.dir/latch_cpp20.cpp.o"
+  "CMakeFiles/latch_cpp20_test.dir/latch_cpp20.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/latch_cpp20_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/local_barrier_count_up_test"
+  "../../../../../bin/local_barrier_count_up_test.pdb"
+  "CMakeFiles/local_barrier_count_up_test.dir/local_barrier_count_up.cpp.o"
+  "CMakeFiles/local_barrier_count_up_test.dir/local_barrier_count_up.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/local_barrier_count_up_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/local_barrier_test"
+  "../../../../../bin/local_barrier_test.pdb"
+  "CMakeFiles/local_barrier_test.dir/local_barrier.cpp.o"
+  "CMakeFiles/local_barrier_test.dir/local_barrier.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/local_barrier_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
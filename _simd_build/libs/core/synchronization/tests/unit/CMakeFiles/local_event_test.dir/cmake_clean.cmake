@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/local_event_test"
+  "../../../../../bin/local_event_test.pdb"
+  "CMakeFiles/local_event_test.dir/local_event.cpp.o"
+  "CMakeFiles/local_event_test.dir/local_event.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/local_event_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/local_latch_test"
+  "../../../../../bin/local_latch_test.pdb"
+  "CMakeFiles/local_latch_test.dir/local_latch.cpp.o"
+  "CMakeFiles/local_latch_test.dir/local_latch.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/local_latch_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
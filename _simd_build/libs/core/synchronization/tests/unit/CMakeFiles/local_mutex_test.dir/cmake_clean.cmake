@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/local_mutex_test"
+  "../../../../../bin/local_mutex_test.pdb"
+  "CMakeFiles/local_mutex_test.dir/local_mutex.cpp.o"
+  "CMakeFiles/local_mutex_test.dir/local_mutex.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/local_mutex_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/sliding_semaphore_test"
+  "../../../../../bin/sliding_semaphore_test.pdb"
+  "CMakeFiles/sliding_semaphore_test.dir/sliding_semaphore.cpp.o"
+  "CMakeFiles/sliding_semaphore_test.dir/sliding_semaphore.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sliding_semaphore_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
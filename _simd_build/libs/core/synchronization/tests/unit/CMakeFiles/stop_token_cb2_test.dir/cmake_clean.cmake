@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/stop_token_cb2_test"
+  "../../../../../bin/stop_token_cb2_test.pdb"
+  "CMakeFiles/stop_token_cb2_test.dir/stop_token_cb2.cpp.o"
+  "CMakeFiles/stop_token_cb2_test.dir/stop_token_cb2.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stop_token_cb2_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
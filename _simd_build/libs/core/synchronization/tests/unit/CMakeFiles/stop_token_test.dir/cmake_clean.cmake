@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/stop_token_test"
+  "../../../../../bin/stop_token_test.pdb"
+  "CMakeFiles/stop_token_test.dir/stop_token.cpp.o"
+  "CMakeFiles/stop_token_test.dir/stop_token.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stop_token_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()